@@ -0,0 +1,383 @@
+#include "AircraftFleet.h"
+#include "EulerAngleCalculation.h"
+#include "SimdKernels.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+// 经纬高与ECEF互换时每批处理的点数（交错存放的临时缓冲区大小）
+const std::size_t CONVERT_BLOCK_SIZE = 256;
+const double DEG_TO_RAD = 3.14159265358979323846 / 180.0;
+} // namespace
+
+void AircraftFleet::reserve(std::size_t capacity) {
+    latitude.reserve(capacity);
+    longitude.reserve(capacity);
+    altitude.reserve(capacity);
+    velocityNorth.reserve(capacity);
+    velocityUp.reserve(capacity);
+    velocityEast.reserve(capacity);
+    pitch.reserve(capacity);
+    roll.reserve(capacity);
+    yaw.reserve(capacity);
+    attitudeStale.reserve(capacity);
+    thrust.reserve(capacity);
+    dragCoefficient.reserve(capacity);
+    mass.reserve(capacity);
+    performance.reserve(capacity);
+    stepSize.reserve(capacity);
+    if (kinematicsFrame == KinematicsFrame::ECEF) {
+        for (std::vector<double>* field : ecefState()) {
+            field->reserve(capacity);
+        }
+    }
+}
+
+void AircraftFleet::clear() {
+    latitude.clear();
+    longitude.clear();
+    altitude.clear();
+    velocityNorth.clear();
+    velocityUp.clear();
+    velocityEast.clear();
+    pitch.clear();
+    roll.clear();
+    yaw.clear();
+    attitudeStale.clear();
+    anyAttitudeStale = false;
+    thrust.clear();
+    dragCoefficient.clear();
+    mass.clear();
+    performance.clear();
+    stepSize.clear();
+    for (std::vector<double>* field : ecefState()) {
+        field->clear();
+    }
+    geodeticStale = false;
+}
+
+std::size_t AircraftFleet::addAircraft(const GeoPosition& position, const Vector3& velocity,
+                                       const AircraftPerformance& perf) {
+    std::size_t index = size();
+    latitude.push_back(position.latitude);
+    longitude.push_back(position.longitude);
+    altitude.push_back(position.altitude);
+    velocityNorth.push_back(velocity.north);
+    velocityUp.push_back(velocity.up);
+    velocityEast.push_back(velocity.east);
+    pitch.push_back(0.0);
+    roll.push_back(0.0);
+    yaw.push_back(0.0);
+    attitudeStale.push_back(0);
+    thrust.push_back(perf.maxThrust);
+    dragCoefficient.push_back(perf.dragCoefficient);
+    mass.push_back(perf.mass);
+    performance.push_back(perf);
+    stepSize.push_back(0.0);
+    if (kinematicsFrame == KinematicsFrame::ECEF) {
+        for (std::vector<double>* field : ecefState()) {
+            field->push_back(0.0);
+        }
+        convertToECEF(index, 1);
+    }
+    return index;
+}
+
+std::size_t AircraftFleet::addAircraft(const Aircraft& aircraft) {
+    std::size_t index = addAircraft(aircraft.position, aircraft.velocity, effectivePerformance(aircraft));
+    loadAttitude(index, aircraft);
+    return index;
+}
+
+const char* getIntegrationMethodName(IntegrationMethod method) {
+    switch (method) {
+    case IntegrationMethod::SemiImplicitEuler: return "SemiImplicitEuler";
+    case IntegrationMethod::RK4: return "RK4";
+    case IntegrationMethod::RK45: return "RK45";
+    }
+    return "Unknown";
+}
+
+void AircraftFleet::setIntegrator(const IntegratorSettings& settings) {
+    if (!(settings.positionTolerance > 0.0) || !(settings.velocityTolerance > 0.0)) {
+        throw std::invalid_argument("AircraftFleet: integrator tolerances must be positive");
+    }
+    if (kinematicsFrame == KinematicsFrame::ECEF && settings.method != IntegrationMethod::SemiImplicitEuler) {
+        throw std::invalid_argument("AircraftFleet: ECEF kinematics only supports semi-implicit Euler");
+    }
+    integrator = settings;
+    // 切换方法或容差后从 dt 重新估计子步长
+    std::fill(stepSize.begin(), stepSize.end(), 0.0);
+}
+
+void AircraftFleet::setKinematicsFrame(KinematicsFrame frame) {
+    if (frame == kinematicsFrame) return;
+    if (frame == KinematicsFrame::ECEF) {
+        if (integrator.method != IntegrationMethod::SemiImplicitEuler) {
+            throw std::invalid_argument("AircraftFleet: ECEF kinematics only supports semi-implicit Euler");
+        }
+        for (std::vector<double>* field : ecefState()) {
+            field->resize(size());
+        }
+        convertToECEF(0, size());
+    } else {
+        syncGeodetic();
+        for (std::vector<double>* field : ecefState()) {
+            field->clear();
+        }
+    }
+    kinematicsFrame = frame;
+}
+
+void AircraftFleet::convertToECEF(std::size_t first, std::size_t count) {
+    const SimdKernelTable& kernels = getSimdKernels();
+    GeoPosition block[CONVERT_BLOCK_SIZE];
+    double ecef[3 * CONVERT_BLOCK_SIZE];
+    for (std::size_t i = first; i < first + count; i += CONVERT_BLOCK_SIZE) {
+        std::size_t n = std::min(CONVERT_BLOCK_SIZE, first + count - i);
+        for (std::size_t k = 0; k < n; ++k) {
+            block[k] = { longitude[i + k], latitude[i + k], altitude[i + k] };
+        }
+        kernels.geodeticToECEF(block, ecef, n);
+        for (std::size_t k = 0; k < n; ++k) {
+            ecefX[i + k] = ecef[3 * k];
+            ecefY[i + k] = ecef[3 * k + 1];
+            ecefZ[i + k] = ecef[3 * k + 2];
+        }
+    }
+    // 当地坐标轴的初值（之后由运动学内核逐步更新）
+    for (std::size_t i = first; i < first + count; ++i) {
+        double lat = latitude[i] * DEG_TO_RAD;
+        double lon = longitude[i] * DEG_TO_RAD;
+        axisSinLat[i] = std::sin(lat);
+        axisCosLat[i] = std::cos(lat);
+        axisSinLon[i] = std::sin(lon);
+        axisCosLon[i] = std::cos(lon);
+    }
+}
+
+void AircraftFleet::convertToGeodetic() const {
+    const SimdKernelTable& kernels = getSimdKernels();
+    GeoPosition block[CONVERT_BLOCK_SIZE];
+    double ecef[3 * CONVERT_BLOCK_SIZE];
+    for (std::size_t i = 0; i < size(); i += CONVERT_BLOCK_SIZE) {
+        std::size_t n = std::min(CONVERT_BLOCK_SIZE, size() - i);
+        for (std::size_t k = 0; k < n; ++k) {
+            ecef[3 * k] = ecefX[i + k];
+            ecef[3 * k + 1] = ecefY[i + k];
+            ecef[3 * k + 2] = ecefZ[i + k];
+        }
+        kernels.ecefToGeodetic(ecef, block, n);
+        for (std::size_t k = 0; k < n; ++k) {
+            latitude[i + k] = block[k].latitude;
+            longitude[i + k] = block[k].longitude;
+            altitude[i + k] = block[k].altitude;
+        }
+    }
+    geodeticStale = false;
+}
+
+void AircraftFleet::stepKinematics(double dt) {
+    // 按CPU选择SIMD内核；半隐式欧拉的标量内核与 Aircraft::updateKinematics 结果逐位一致，
+    // SIMD内核与其差异在 updateGeoPositionBatch 说明的容差内
+    const SimdKernelTable& kernels = getSimdKernels();
+    if (kinematicsFrame == KinematicsFrame::ECEF) {
+        kernels.stepKinematicsECEF(ecefX.data(), ecefY.data(), ecefZ.data(),
+                                   velocityNorth.data(), velocityUp.data(), velocityEast.data(),
+                                   axisSinLat.data(), axisCosLat.data(), axisSinLon.data(), axisCosLon.data(),
+                                   thrust.data(), dragCoefficient.data(), mass.data(),
+                                   size(), dt);
+        geodeticStale = true;
+        return;
+    }
+    switch (integrator.method) {
+    case IntegrationMethod::SemiImplicitEuler:
+        kernels.stepKinematics(latitude.data(), longitude.data(), altitude.data(),
+                               velocityNorth.data(), velocityUp.data(), velocityEast.data(),
+                               thrust.data(), dragCoefficient.data(), mass.data(),
+                               size(), dt);
+        break;
+    case IntegrationMethod::RK4:
+        kernels.stepKinematicsRK4(latitude.data(), longitude.data(), altitude.data(),
+                                  velocityNorth.data(), velocityUp.data(), velocityEast.data(),
+                                  thrust.data(), dragCoefficient.data(), mass.data(),
+                                  size(), dt);
+        break;
+    case IntegrationMethod::RK45:
+        kernels.stepKinematicsRK45(latitude.data(), longitude.data(), altitude.data(),
+                                   velocityNorth.data(), velocityUp.data(), velocityEast.data(),
+                                   stepSize.data(),
+                                   thrust.data(), dragCoefficient.data(), mass.data(),
+                                   size(), dt, integrator.positionTolerance, integrator.velocityTolerance);
+        break;
+    }
+}
+
+GeoPosition AircraftFleet::getPosition(std::size_t index) const {
+    syncGeodetic();
+    return GeoPosition{ longitude[index], latitude[index], altitude[index] };
+}
+
+void AircraftFleet::setPosition(std::size_t index, const GeoPosition& position) {
+    latitude[index] = position.latitude;
+    longitude[index] = position.longitude;
+    altitude[index] = position.altitude;
+    if (kinematicsFrame == KinematicsFrame::ECEF) {
+        convertToECEF(index, 1);
+    }
+}
+
+Vector3 AircraftFleet::getVelocity(std::size_t index) const {
+    return Vector3{ velocityNorth[index], velocityUp[index], velocityEast[index] };
+}
+
+void AircraftFleet::setVelocity(std::size_t index, const Vector3& velocity) {
+    velocityNorth[index] = velocity.north;
+    velocityUp[index] = velocity.up;
+    velocityEast[index] = velocity.east;
+}
+
+// 全部过期时直接在字段数组上批量计算；否则把过期槽位的速度收集到连续缓冲区，批量计算后写回
+void AircraftFleet::computeStaleAttitudes() const {
+    const std::size_t n = size();
+    const std::size_t stale = static_cast<std::size_t>(std::count(attitudeStale.begin(), attitudeStale.end(), 1));
+    if (stale == n) {
+        EulerAngleCalculator::calculateFromVelocityBatch(velocityNorth.data(), velocityUp.data(),
+                                                         velocityEast.data(), pitch.data(), roll.data(),
+                                                         yaw.data(), n);
+    } else if (stale > 0) {
+        attitudeScratch.resize(6 * stale);
+        double* vn = attitudeScratch.data();
+        double* vu = vn + stale;
+        double* ve = vu + stale;
+        double* p = ve + stale;
+        double* r = p + stale;
+        double* y = r + stale;
+        for (std::size_t i = 0, k = 0; i < n; ++i) {
+            if (!attitudeStale[i]) continue;
+            vn[k] = velocityNorth[i];
+            vu[k] = velocityUp[i];
+            ve[k] = velocityEast[i];
+            ++k;
+        }
+        EulerAngleCalculator::calculateFromVelocityBatch(vn, vu, ve, p, r, y, stale);
+        for (std::size_t i = 0, k = 0; i < n; ++i) {
+            if (!attitudeStale[i]) continue;
+            pitch[i] = p[k];
+            roll[i] = r[k];
+            yaw[i] = y[k];
+            ++k;
+        }
+    }
+    std::fill(attitudeStale.begin(), attitudeStale.end(), 0);
+    attitudeStats.computed += stale;
+    anyAttitudeStale = false;
+}
+
+AttitudeAngles AircraftFleet::getAttitude(std::size_t index) const {
+    if (attitudeStale[index]) {
+        AttitudeAngles derived = EulerAngleCalculator::calculateFromVelocity(getVelocity(index));
+        pitch[index] = derived.pitch;
+        roll[index] = derived.roll;
+        yaw[index] = derived.yaw;
+        attitudeStale[index] = 0;
+        ++attitudeStats.computed;
+    }
+    AttitudeAngles attitude;
+    attitude.pitch = pitch[index];
+    attitude.roll = roll[index];
+    attitude.yaw = yaw[index];
+    return attitude;
+}
+
+void AircraftFleet::setAttitude(std::size_t index, const AttitudeAngles& attitude) {
+    attitudeStale[index] = 0;
+    pitch[index] = attitude.pitch;
+    roll[index] = attitude.roll;
+    yaw[index] = attitude.yaw;
+}
+
+AircraftPerformance AircraftFleet::getPerformance(std::size_t index) const {
+    return performance[index];
+}
+
+void AircraftFleet::setPerformance(std::size_t index, const AircraftPerformance& perf) {
+    performance[index] = perf;
+    thrust[index] = perf.maxThrust;
+    dragCoefficient[index] = perf.dragCoefficient;
+    mass[index] = perf.mass;
+}
+
+void AircraftFleet::loadFromAircraft(std::size_t index, const Aircraft& aircraft) {
+    setPosition(index, aircraft.position);
+    setVelocity(index, aircraft.velocity);
+    loadAttitude(index, aircraft);
+    setPerformance(index, effectivePerformance(aircraft));
+}
+
+// 推力与阻力系数取飞机自身 computeAcceleration 所用的数值（如 FighterJet 按型号设定），而不是性能参数表
+AircraftPerformance AircraftFleet::effectivePerformance(const Aircraft& aircraft) {
+    AircraftPerformance perf = aircraft.getPerformance();
+    perf.maxThrust = aircraft.getThrust();
+    perf.dragCoefficient = aircraft.getDragCoefficient();
+    return perf;
+}
+
+// 过期状态原样传递，不在拷贝时计算姿态
+void AircraftFleet::loadAttitude(std::size_t index, const Aircraft& aircraft) {
+    if (aircraft.isAttitudeStale()) {
+        invalidateAttitude(index);
+    } else {
+        setAttitude(index, aircraft.getAttitude());
+    }
+}
+
+void AircraftFleet::storeToAircraft(std::size_t index, Aircraft& aircraft) const {
+    aircraft.position = getPosition(index);
+    aircraft.velocity = getVelocity(index);
+    if (isAttitudeStale(index)) {
+        aircraft.invalidateAttitude();
+    } else {
+        aircraft.setAttitude(getAttitude(index));
+    }
+    aircraft.performance = performance[index];
+}
+
+// FleetSlotAircraft实现
+FleetSlotAircraft::FleetSlotAircraft(AircraftFleet& fleet, std::size_t index)
+    : Aircraft("fleet", "slot"), fleet(fleet), slotIndex(index) {
+    pull();
+}
+
+void FleetSlotAircraft::bind(std::size_t index) {
+    slotIndex = index;
+    pull();
+}
+
+void FleetSlotAircraft::pull() {
+    fleet.storeToAircraft(slotIndex, *this);
+}
+
+void FleetSlotAircraft::push() {
+    fleet.loadFromAircraft(slotIndex, *this);
+}
+
+Vector3 FleetSlotAircraft::computeAcceleration() const {
+    double vx = velocity.north;
+    double vy = velocity.up;
+    double vz = velocity.east;
+    double speed = std::sqrt(vx * vx + vy * vy + vz * vz);
+
+    Vector3 acc{ 0.0, 0.0, 0.0 };
+    if (speed > 1e-3) {
+        double thrustAcc = performance.maxThrust / performance.mass;
+        double dragAcc = performance.dragCoefficient * speed * speed / performance.mass;
+        double netAcc = thrustAcc - dragAcc;
+
+        acc.north = netAcc * (vx / speed);
+        acc.up = netAcc * (vy / speed);
+        acc.east = netAcc * (vz / speed);
+    }
+    return acc;
+}
@@ -0,0 +1,191 @@
+#ifndef AIRCRAFT_FLEET_H
+#define AIRCRAFT_FLEET_H
+
+#include "AircraftModelLibrary.h"
+#include <array>
+#include <cstddef>
+#include <vector>
+
+// 运动学积分方法
+enum class IntegrationMethod {
+    SemiImplicitEuler,   // 先由加速度更新速度，再用新速度积分位置（与 Aircraft::updateKinematics 相同，默认）
+    RK4,                 // 经典四阶 Runge-Kutta，每步4次加速度求值
+    RK45,                // Dormand-Prince 5(4)，按误差容差自适应划分子步
+};
+
+// 积分方法名称
+const char* getIntegrationMethodName(IntegrationMethod method);
+
+// 运动学积分策略（容差只用于 RK45，为每个子步的局部误差上限）
+struct IntegratorSettings {
+    IntegrationMethod method = IntegrationMethod::SemiImplicitEuler;
+    double positionTolerance = 1e-3;   // 位置 (米)
+    double velocityTolerance = 1e-4;   // 速度 (米/秒)
+};
+
+// 运动学积分所用的位置坐标
+enum class KinematicsFrame {
+    Geodetic,   // 直接积分经纬高（球面模型，与 Aircraft::updateKinematics 相同，默认）
+    ECEF,       // 积分ECEF直角坐标（WGS84），经纬高在读取时才批量换算并缓存
+};
+
+// 机群容器：按字段连续存储（结构数组，SoA）
+// 每个字段一条连续数组，批量运动学更新时逐字段顺序访问，避免逐对象的缓存抖动
+class AircraftFleet {
+public:
+    AircraftFleet() = default;
+    explicit AircraftFleet(std::size_t capacity) { reserve(capacity); }
+
+    // 容量管理
+    std::size_t size() const { return latitude.size(); }
+    bool empty() const { return latitude.empty(); }
+    void reserve(std::size_t capacity);
+    void clear();
+
+    // 添加飞机，返回槽位索引
+    std::size_t addAircraft(const GeoPosition& position, const Vector3& velocity,
+                            const AircraftPerformance& performance = AircraftPerformance());
+    std::size_t addAircraft(const Aircraft& aircraft);
+
+    // 批量运动学更新：对整个机群一次遍历完成 updateKinematics + updateGeoPosition
+    // 加速度模型与 FighterJet::computeAcceleration 一致（推力减阻力，沿速度方向）；
+    // 由 Aircraft 添加或载入的槽位使用其 getThrust/getDragCoefficient（与逐对象更新相同的推力和阻力）
+    // 按CPU选择SIMD内核（见 SimdKernels.h），半隐式欧拉在标量级别下与逐对象更新结果逐位一致
+    void stepKinematics(double dt);
+
+    // 积分策略（默认半隐式欧拉）；容差不为正、或ECEF模式下选择半隐式欧拉以外的方法时抛出 std::invalid_argument
+    void setIntegrator(const IntegratorSettings& settings);
+    const IntegratorSettings& getIntegrator() const { return integrator; }
+
+    // 位置积分坐标（默认 Geodetic）
+    // ECEF 模式下每步只更新ECEF坐标（无三角函数，飞越极点与日期变更线不退化），
+    // 经纬高标记为过期，首次读取（getPosition、经纬高数组访问）时整个机群批量换算一次并缓存到下一步；
+    // 切换时双向换算当前位置。只支持半隐式欧拉积分，否则抛出 std::invalid_argument。
+    // 注意：缓存换算发生在 const 读取中，步进后多个线程同时首次读取前需先在单线程中读取一次。
+    void setKinematicsFrame(KinematicsFrame frame);
+    KinematicsFrame getKinematicsFrame() const { return kinematicsFrame; }
+
+    // 按需姿态（与 Aircraft::invalidateAttitude 相同）：标记槽位姿态随速度方向推导，
+    // 首次读取（getAttitude、姿态数组访问）时才由当时的速度计算并缓存；setAttitude 显式设置后不再推导。
+    // getAttitude 逐个精确计算；姿态数组访问时全部过期槽位用 calculateFromVelocityBatch 批量计算
+    // （向量级别与精确值相差 < 3e-7 弧度）
+    void invalidateAttitude(std::size_t index) {
+        attitudeStale[index] = 1;
+        anyAttitudeStale = true;
+        ++attitudeStats.requested;
+    }
+    bool isAttitudeStale(std::size_t index) const { return attitudeStale[index] != 0; }
+    const AttitudeStats& getAttitudeStats() const { return attitudeStats; }
+
+    // 单槽位读写（与已有结构体互通）
+    GeoPosition getPosition(std::size_t index) const;
+    void setPosition(std::size_t index, const GeoPosition& position);
+    Vector3 getVelocity(std::size_t index) const;
+    void setVelocity(std::size_t index, const Vector3& velocity);
+    AttitudeAngles getAttitude(std::size_t index) const;
+    void setAttitude(std::size_t index, const AttitudeAngles& attitude);
+    AircraftPerformance getPerformance(std::size_t index) const;
+    void setPerformance(std::size_t index, const AircraftPerformance& performance);
+
+    // 槽位与Aircraft对象之间的状态拷贝
+    void loadFromAircraft(std::size_t index, const Aircraft& aircraft);
+    void storeToAircraft(std::size_t index, Aircraft& aircraft) const;
+
+    // 连续字段数组访问（供批量算法使用）
+    // ECEF 模式下经纬高数组为换算缓存，写入不会反映到ECEF位置（修改位置请用 setPosition）
+    double* latitudeData() { syncGeodetic(); return latitude.data(); }
+    double* longitudeData() { syncGeodetic(); return longitude.data(); }
+    double* altitudeData() { syncGeodetic(); return altitude.data(); }
+    double* velocityNorthData() { return velocityNorth.data(); }
+    double* velocityUpData() { return velocityUp.data(); }
+    double* velocityEastData() { return velocityEast.data(); }
+    double* pitchData() { syncAttitude(); return pitch.data(); }
+    double* rollData() { syncAttitude(); return roll.data(); }
+    double* yawData() { syncAttitude(); return yaw.data(); }
+    const double* latitudeData() const { syncGeodetic(); return latitude.data(); }
+    const double* longitudeData() const { syncGeodetic(); return longitude.data(); }
+    const double* altitudeData() const { syncGeodetic(); return altitude.data(); }
+    const double* velocityNorthData() const { return velocityNorth.data(); }
+    const double* velocityUpData() const { return velocityUp.data(); }
+    const double* velocityEastData() const { return velocityEast.data(); }
+    const double* pitchData() const { syncAttitude(); return pitch.data(); }
+    const double* rollData() const { syncAttitude(); return roll.data(); }
+    const double* yawData() const { syncAttitude(); return yaw.data(); }
+    // ECEF 位置 (米)，仅 ECEF 模式下有效（否则为空）
+    const double* ecefXData() const { return ecefX.data(); }
+    const double* ecefYData() const { return ecefY.data(); }
+    const double* ecefZData() const { return ecefZ.data(); }
+
+private:
+    void syncGeodetic() const { if (geodeticStale) convertToGeodetic(); }
+    void syncAttitude() const { if (anyAttitudeStale) computeStaleAttitudes(); }
+    void computeStaleAttitudes() const;
+    void loadAttitude(std::size_t index, const Aircraft& aircraft);
+    static AircraftPerformance effectivePerformance(const Aircraft& aircraft);
+    void convertToGeodetic() const;
+    void convertToECEF(std::size_t first, std::size_t count);
+    std::array<std::vector<double>*, 7> ecefState() {
+        return { &ecefX, &ecefY, &ecefZ, &axisSinLat, &axisCosLat, &axisSinLon, &axisCosLon };
+    }
+
+    // 位置（度，度，米）；ECEF 模式下为按需换算的缓存
+    mutable std::vector<double> latitude;
+    mutable std::vector<double> longitude;
+    mutable std::vector<double> altitude;
+    // ECEF 位置 (米)
+    std::vector<double> ecefX;
+    std::vector<double> ecefY;
+    std::vector<double> ecefZ;
+    // ECEF 模式下当前位置的当地坐标轴（大地纬度、经度的正余弦），由运动学内核逐步更新
+    std::vector<double> axisSinLat;
+    std::vector<double> axisCosLat;
+    std::vector<double> axisSinLon;
+    std::vector<double> axisCosLon;
+    mutable bool geodeticStale = false;
+    KinematicsFrame kinematicsFrame = KinematicsFrame::Geodetic;
+    // 北-上-东速度 (m/s)
+    std::vector<double> velocityNorth;
+    std::vector<double> velocityUp;
+    std::vector<double> velocityEast;
+    // 姿态（弧度）；过期槽位在读取时由速度计算
+    mutable std::vector<double> pitch;
+    mutable std::vector<double> roll;
+    mutable std::vector<double> yaw;
+    mutable std::vector<unsigned char> attitudeStale;
+    mutable bool anyAttitudeStale = false;
+    mutable AttitudeStats attitudeStats;
+    mutable std::vector<double> attitudeScratch;   // 部分槽位过期时批量计算的收集缓冲区
+    // 动力学参数
+    std::vector<double> thrust;           // 推力 (牛顿)
+    std::vector<double> dragCoefficient;  // 阻力系数
+    std::vector<double> mass;             // 质量 (千克)
+    // 其余性能参数按槽位整体保存（批量更新不访问）
+    std::vector<AircraftPerformance> performance;
+    // RK45 各槽位的建议子步长（秒，0 表示从 dt 开始）
+    std::vector<double> stepSize;
+
+    IntegratorSettings integrator;
+};
+
+// 机群槽位适配器：把一个槽位暴露为Aircraft对象
+// pull() 把槽位状态读入本对象，之后可照常调用机动模型、功能模块等已有接口，
+// push() 再把修改写回槽位。updateKinematics 仍可单独调用，与机群批量更新结果一致。
+class FleetSlotAircraft : public Aircraft {
+public:
+    FleetSlotAircraft(AircraftFleet& fleet, std::size_t index);
+
+    // 切换绑定的槽位（会先读入新槽位状态）
+    void bind(std::size_t index);
+    std::size_t getSlotIndex() const { return slotIndex; }
+
+    void pull();   // 槽位 -> 对象
+    void push();   // 对象 -> 槽位
+
+    Vector3 computeAcceleration() const override;
+
+private:
+    AircraftFleet& fleet;
+    std::size_t slotIndex;
+};
+
+#endif // AIRCRAFT_FLEET_H
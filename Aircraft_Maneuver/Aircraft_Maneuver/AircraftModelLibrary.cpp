@@ -1,5 +1,7 @@
 #include "AircraftModelLibrary.h"
 #include "EulerAngleCalculation.h"
+#include "LocalTangentFrame.h"
+#include "ManeuverRegistry.h"
 #include <cmath>
 #include <stdexcept>
 #include <sstream>
@@ -14,12 +16,12 @@ Aircraft::Aircraft(const std::string& type, const std::string& model)
     : type(type), model(model),
       position{ 0.0, 0.0, 0.0 },
       velocity{ 0.0, 0.0, 0.0 },
-      attitude(),
       performance(),
       currentManeuver(nullptr),
       currentManeuverModel(nullptr),
       maneuverState(),
-      maneuverParams() {}
+      maneuverParams(),
+      referencePosition{ 0.0, 0.0, 0.0 } {}
 
 Aircraft::~Aircraft() {}
 
@@ -42,14 +44,25 @@ void Aircraft::registerManeuver(const std::string& name, ManeuverFunc func) {
 
 void Aircraft::setManeuver(const std::string& name) {
 	auto it = maneuvers.find(name);
-	if (it == maneuvers.end()) {
+	if (it != maneuvers.end()) {
+		currentManeuver = it->second;
+		return;
+	}
+
+	// δעưûʹñעģͲĬϲ
+	ManeuverId id = ManeuverRegistry::find(name);
+	if (!ManeuverRegistry::isValid(id)) {
 		std::ostringstream oss;
 		oss << "Unknown maneuver: " << name << "\nAvailable maneuvers: ";
 		for (const auto& pair : maneuvers)
 			oss << pair.first << " ";
+		for (std::size_t i = 0; i < ManeuverRegistry::count(); ++i)
+			oss << ManeuverRegistry::getName(static_cast<ManeuverId>(i)) << " ";
 		throw std::invalid_argument(oss.str());
 	}
-	currentManeuver = it->second;
+	currentManeuver = nullptr;
+	setManeuverModel(ManeuverRegistry::create(id));
+	initializeManeuver(ManeuverRegistry::getDefaults(id).toParameters());
 }
 
 void Aircraft::performManeuver(double dt) {
@@ -91,122 +104,112 @@ void Aircraft::resetManeuver() {
 }
 
 void Aircraft::updateAttitude(double dt) {
-	// ٶ̬
-	attitude = EulerAngleCalculator::calculateFromVelocity(velocity);
+	// ̬ٶƵȡʱټ
+	invalidateAttitude();
+}
+
+const AttitudeAngles& Aircraft::getAttitude() const {
+	if (attitudeStale) {
+		attitude = EulerAngleCalculator::calculateFromVelocity(velocity);
+		attitudeStale = false;
+		++attitudeStats.computed;
+		if (quaternionAttitude) {
+			orientation = EulerAngleCalculator::toQuaternion(attitude);
+		}
+	} else if (eulerStale) {
+		attitude = EulerAngleCalculator::fromQuaternion(orientation);
+	}
+	eulerStale = false;
+	return attitude;
+}
+
+void Aircraft::setAttitude(const AttitudeAngles& value) {
+	attitude = value;
+	attitudeStale = false;
+	eulerStale = false;
+	if (quaternionAttitude) {
+		orientation = EulerAngleCalculator::toQuaternion(value);
+	}
+}
+
+void Aircraft::setQuaternionAttitude(bool enabled) {
+	if (enabled == quaternionAttitude) return;
+	if (enabled) {
+		// ڵٶƵ̬ȡʱٻ
+		if (!attitudeStale) orientation = EulerAngleCalculator::toQuaternion(attitude);
+	} else {
+		getAttitude();
+	}
+	quaternionAttitude = enabled;
+}
+
+Quaternion Aircraft::getAttitudeQuaternion() const {
+	if (!quaternionAttitude) {
+		return EulerAngleCalculator::toQuaternion(getAttitude());
+	}
+	if (attitudeStale) getAttitude();
+	return orientation;
+}
+
+void Aircraft::setAttitudeQuaternion(const Quaternion& value) {
+	if (!quaternionAttitude) {
+		setAttitude(EulerAngleCalculator::fromQuaternion(value.normalized()));
+		return;
+	}
+	orientation = value.normalized();
+	attitudeStale = false;
+	eulerStale = true;
+}
+
+void Aircraft::rotateBody(double rollRate, double pitchRate, double yawRate, double dt) {
+	setAttitudeQuaternion(EulerAngleCalculator::integrateBodyRates(getAttitudeQuaternion(),
+	                                                               rollRate, pitchRate, yawRate, dt));
+}
+
+DirectionCosineMatrix Aircraft::getBodyToNUE() const {
+	return EulerAngleCalculator::toDCM(getAttitudeQuaternion());
 }
 
 // תطʵ
 void Aircraft::setReferencePosition(const GeoPosition& refPos) {
 	referencePosition = refPos;
+	referenceFrame = std::make_shared<const LocalTangentFrame>(refPos);
+}
+
+void Aircraft::setReferenceFrame(std::shared_ptr<const LocalTangentFrame> frame) {
+	referenceFrame = frame;
+	if (frame) {
+		referencePosition = frame->getOrigin();
+	}
 }
 
 Vector3 Aircraft::getECEFPosition() const {
-	// 򻯵ECEF㣨Eigen
-	const double EARTH_RADIUS = 6371000.0;
-	const double PI = 3.14159265358979323846;
-	
-	double lat = position.latitude * PI / 180.0;  // תΪ
-	double lon = position.longitude * PI / 180.0;
-	double h = position.altitude;
-	
-	// 򻯵WGS84
-	const double a = 6378137.0;  // 
-	const double e2 = 0.006694379990141316;  // һƫƽ
-	
-	double N = a / sqrt(1 - e2 * sin(lat) * sin(lat));  // îȦʰ뾶
-	
-	Vector3 ecef;
-	ecef.north = (N + h) * cos(lat) * cos(lon);  // X
-	ecef.up = (N + h) * cos(lat) * sin(lon);     // Y
-	ecef.east = (N * (1 - e2) + h) * sin(lat);   // Z
-	
-	return ecef;
+	// WGS84ECEF꣨Eigen
+	return LocalTangentFrame::geodeticToECEF(position);
 }
 
 Vector3 Aircraft::getLocalNUEPosition() const {
-	// ڲοNUEλ
-	Vector3 refECEF = getECEFPosition();  // ǰɻECEFλ
-	
-	// οECEFλ
-	const double EARTH_RADIUS = 6371000.0;
-	const double PI = 3.14159265358979323846;
-	
-	double refLat = referencePosition.latitude * PI / 180.0;
-	double refLon = referencePosition.longitude * PI / 180.0;
-	double refH = referencePosition.altitude;
-	
-	const double a = 6378137.0;
-	const double e2 = 0.006694379990141316;
-	
-	double refN = a / sqrt(1 - e2 * sin(refLat) * sin(refLat));
-	
-	Vector3 refECEFPos;
-	refECEFPos.north = (refN + refH) * cos(refLat) * cos(refLon);
-	refECEFPos.up = (refN + refH) * cos(refLat) * sin(refLon);
-	refECEFPos.east = (refN * (1 - e2) + refH) * sin(refLat);
-	
-	// λ
-	Vector3 relativeECEF;
-	relativeECEF.north = refECEF.north - refECEFPos.north;
-	relativeECEF.up = refECEF.up - refECEFPos.up;
-	relativeECEF.east = refECEF.east - refECEFPos.east;
-	
-	// תΪNUEϵ
-	Vector3 localNUE;
-	
-	// ת󣨴ECEFNUE
-	double sinLat = sin(refLat);
-	double cosLat = cos(refLat);
-	double sinLon = sin(refLon);
-	double cosLon = cos(refLon);
-	
-	// תӦ
-	localNUE.north = -sinLat * cosLon * relativeECEF.north - sinLat * sinLon * relativeECEF.up + cosLat * relativeECEF.east;
-	localNUE.up = cosLat * cosLon * relativeECEF.north + cosLat * sinLon * relativeECEF.up + sinLat * relativeECEF.east;
-	localNUE.east = -sinLon * relativeECEF.north + cosLon * relativeECEF.up;
-	
-	return localNUE;
+	// ڲοNUEλãοECEFתѻڵϵУ
+	if (!referenceFrame) {
+		return LocalTangentFrame(referencePosition).toNUE(position);
+	}
+	return referenceFrame->toNUE(position);
 }
 
 double Aircraft::getDistanceFromReference() const {
-	// 㵽οľ
-	double dLat = position.latitude - referencePosition.latitude;
-	double dLon = position.longitude - referencePosition.longitude;
-	double dAlt = position.altitude - referencePosition.altitude;
-	
-	// תΪ
-	const double PI = 3.14159265358979323846;
-	dLat *= PI / 180.0;
-	dLon *= PI / 180.0;
-	
-	// ʹHaversineʽˮƽ
-	double lat1 = referencePosition.latitude * PI / 180.0;
-	double lat2 = position.latitude * PI / 180.0;
-	
-	double a = sin(dLat/2) * sin(dLat/2) + cos(lat1) * cos(lat2) * sin(dLon/2) * sin(dLon/2);
-	double c = 2 * atan2(sqrt(a), sqrt(1-a));
-	
-	const double EARTH_RADIUS = 6371000.0;
-	double horizontalDistance = EARTH_RADIUS * c;
-	
-	// ܾ루߶ȣ
-	return sqrt(horizontalDistance * horizontalDistance + dAlt * dAlt);
+	// 㵽οľ루Haversineˮƽ߶Ȳϳɣ
+	if (!referenceFrame) {
+		return LocalTangentFrame(referencePosition).distanceTo(position);
+	}
+	return referenceFrame->distanceTo(position);
 }
 
 double Aircraft::getBearingFromReference() const {
-	// Ӳο㵽ǰλõķλ
-	double lat1 = referencePosition.latitude * 3.14159265358979323846 / 180.0;
-	double lon1 = referencePosition.longitude * 3.14159265358979323846 / 180.0;
-	double lat2 = position.latitude * 3.14159265358979323846 / 180.0;
-	double lon2 = position.longitude * 3.14159265358979323846 / 180.0;
-	
-	double dLon = lon2 - lon1;
-	
-	double y = sin(dLon) * cos(lat2);
-	double x = cos(lat1) * sin(lat2) - sin(lat1) * cos(lat2) * cos(dLon);
-	
-	double bearing = atan2(y, x);
-	return bearing * 180.0 / 3.14159265358979323846;  // תΪ
+	// Ӳο㵽ǰλõķλǣȣ
+	if (!referenceFrame) {
+		return LocalTangentFrame(referencePosition).bearingTo(position);
+	}
+	return referenceFrame->bearingTo(position);
 }
 
 // λûֺٶµľγ
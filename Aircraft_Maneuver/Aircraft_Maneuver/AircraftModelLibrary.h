@@ -7,6 +7,7 @@
 #include <memory>
 #include <cmath>
 #include <vector>
+#include <cstddef>
 #include "AircraftModule.h"
 
 // 定义圆周率
@@ -47,6 +48,68 @@ struct AttitudeAngles {
 	void setYawDegrees(double degrees) { yaw = degrees * M_PI / 180.0; }
 };
 
+// 结构体：按需姿态计算统计
+// requested 为标记姿态需随速度重算的次数（原先每次都会立即计算），computed 为实际计算次数
+struct AttitudeStats {
+	std::size_t requested;
+	std::size_t computed;
+
+	AttitudeStats() : requested(0), computed(0) {}
+
+	// 省去的姿态计算次数
+	std::size_t avoided() const { return requested > computed ? requested - computed : 0; }
+};
+
+// 结构体：单位四元数姿态，表示机体系（前-右-下）到当地北-东-地系的旋转；
+// 与 AttitudeAngles 按偏航-俯仰-滚转（Z-Y-X）顺序对应，换算见 EulerAngleCalculator
+struct Quaternion {
+	double w;
+	double x;
+	double y;
+	double z;
+
+	Quaternion() : w(1.0), x(0.0), y(0.0), z(0.0) {}
+	Quaternion(double w, double x, double y, double z) : w(w), x(x), y(y), z(z) {}
+
+	// 旋转复合：(*this) 之后再在机体系中旋转 q
+	Quaternion operator*(const Quaternion& q) const {
+		return Quaternion(w * q.w - x * q.x - y * q.y - z * q.z,
+		                  w * q.x + x * q.w + y * q.z - z * q.y,
+		                  w * q.y - x * q.z + y * q.w + z * q.x,
+		                  w * q.z + x * q.y - y * q.x + z * q.w);
+	}
+	Quaternion conjugate() const { return Quaternion(w, -x, -y, -z); }
+	double norm() const { return std::sqrt(w * w + x * x + y * y + z * z); }
+	Quaternion normalized() const {
+		double n = norm();
+		return n > 0.0 ? Quaternion(w / n, x / n, y / n, z / n) : Quaternion();
+	}
+};
+
+// 结构体：机体坐标系向量（前、右、下），如传感器视轴、天线指向
+struct BodyVector {
+	double forward;
+	double right;
+	double down;
+};
+
+// 结构体：方向余弦矩阵（机体系 -> 当地北上东），m[行][列]：行依次为北、上、东分量，列依次为机体前、右、下轴。
+// 由姿态换算一次后，机体系与北上东之间的向量变换只需乘加，不再需要三角函数
+struct DirectionCosineMatrix {
+	double m[3][3];
+
+	Vector3 toNUE(const BodyVector& b) const {
+		return { m[0][0] * b.forward + m[0][1] * b.right + m[0][2] * b.down,
+		         m[1][0] * b.forward + m[1][1] * b.right + m[1][2] * b.down,
+		         m[2][0] * b.forward + m[2][1] * b.right + m[2][2] * b.down };
+	}
+	BodyVector toBody(const Vector3& v) const {
+		return { m[0][0] * v.north + m[1][0] * v.up + m[2][0] * v.east,
+		         m[0][1] * v.north + m[1][1] * v.up + m[2][1] * v.east,
+		         m[0][2] * v.north + m[1][2] * v.up + m[2][2] * v.east };
+	}
+};
+
 // 结构体：包含飞机性能参数
 struct AircraftPerformance {
 	double maxTurnRate;      // 最大转弯率 (弧度/秒)	
@@ -64,6 +127,8 @@ struct AircraftPerformance {
 	                       wingArea(50.0), mass(10000.0) {}
 };
 
+class LocalTangentFrame;
+
 // 只保留GeoPosition, Vector3, AttitudeAngles, AircraftPerformance, Aircraft等基础结构体和类
 // 移除ManeuverModel、ManeuverParameters、ManeuverState等机动相关内容
 class Aircraft {
@@ -80,16 +145,40 @@ public:
 
 	GeoPosition position;    // 位置
 	Vector3 velocity;        // 速度
-	AttitudeAngles attitude; // 姿态
 	AircraftPerformance performance; // 性能
 
+	// 姿态：随速度方向推导的机动模型每步只调用 invalidateAttitude() 标记过期，
+	// 首次 getAttitude() 时才由当时的速度计算一次并缓存（输出频率低于步进频率时省去多数计算）；
+	// setAttitude() 显式设置的姿态（如 Immelmann、桶滚机动）保持不变，直到再次 invalidateAttitude()。
+	// 注意：缓存计算发生在 const 读取中，同一飞机不能被多个线程同时首次读取。
+	const AttitudeAngles& getAttitude() const;
+	void setAttitude(const AttitudeAngles& value);
+
+	// 可选四元数姿态：启用后显式姿态以单位四元数保存，显式姿态机动（Immelmann、桶滚）改用 rotateBody()
+	// 按机体角速度积分，不再对欧拉角加减后截断，大角度下不失真；欧拉角（getAttitude）与方向余弦矩阵
+	// （getBodyToNUE）只在读取时由四元数换算。默认关闭，行为与原欧拉角实现相同。
+	void setQuaternionAttitude(bool enabled);
+	bool usesQuaternionAttitude() const { return quaternionAttitude; }
+	Quaternion getAttitudeQuaternion() const;
+	void setAttitudeQuaternion(const Quaternion& value);
+	// 绕机体前、右、下轴的角速度（弧度/秒）积分 dt 秒；未启用四元数姿态时经四元数换算后写回欧拉角
+	void rotateBody(double rollRate, double pitchRate, double yawRate, double dt);
+	DirectionCosineMatrix getBodyToNUE() const;
+	void invalidateAttitude() { attitudeStale = true; ++attitudeStats.requested; }
+	bool isAttitudeStale() const { return attitudeStale; }
+	const AttitudeStats& getAttitudeStats() const { return attitudeStats; }
+
 	// 根据当前状态计算加速度，然后根据加速度更新位置
 	virtual void updateKinematics(double dt);
 
 	// 计算当前加速度 (m/s^2)
 	virtual Vector3 computeAcceleration() const = 0;
+
+	// computeAcceleration 实际使用的推力与阻力系数（默认取性能参数，按型号另设数值的派生类覆盖）
+	virtual double getThrust() const { return performance.maxThrust; }
+	virtual double getDragCoefficient() const { return performance.dragCoefficient; }
 	
-	// 更新姿态
+	// 更新姿态（标记为随速度推导，读取时计算）
 	virtual void updateAttitude(double dt);
 
 	// 传统机动方法（保持向后兼容）
@@ -99,6 +188,7 @@ public:
 
 	// 新的机动模型方法
 	void setManeuverModel(std::shared_ptr<ManeuverModel> model);  // 设置机动模型
+	const ManeuverModel* getManeuverModel() const { return currentManeuverModel.get(); }  // 当前机动模型（未设置时为nullptr）
 	void initializeManeuver(const ManeuverParameters& params);    // 初始化机动
 	void updateManeuver(double dt);                               // 更新机动
 	void resetManeuver();                                         // 重置机动状态
@@ -111,8 +201,11 @@ public:
 	const AircraftPerformance& getPerformance() const { return performance; }
 
 	// 坐标转换相关方法
-	void setReferencePosition(const GeoPosition& refPos);  // 设置参考位置
+	void setReferencePosition(const GeoPosition& refPos);  // 设置参考位置（构造新的当地坐标系）
 	GeoPosition getReferencePosition() const { return referencePosition; }
+	// 共享已有的当地坐标系（多架飞机、多个站点可共用同一参考点，避免重复计算）
+	void setReferenceFrame(std::shared_ptr<const LocalTangentFrame> frame);
+	std::shared_ptr<const LocalTangentFrame> getReferenceFrame() const { return referenceFrame; }
 	
 	// 获取地球坐标系位置（简化版本，不依赖Eigen）
 	Vector3 getECEFPosition() const;
@@ -136,6 +229,7 @@ public:
 		}
 		return nullptr;
 	}
+	const std::vector<std::shared_ptr<AircraftModule>>& getModules() const { return modules; }
 	void updateModules(double dt) {
 		for (auto& m : modules) {
 			m->update(*this, dt);
@@ -155,10 +249,27 @@ protected:
 	
 	// 坐标转换相关成员
 	GeoPosition referencePosition;  // 参考位置（用于计算相对位置）
+	std::shared_ptr<const LocalTangentFrame> referenceFrame;  // 参考点当地坐标系（缓存ECEF原点与旋转矩阵）
 	std::vector<std::shared_ptr<AircraftModule>> modules;
+
+	// 姿态缓存
+	mutable AttitudeAngles attitude;
+	mutable bool attitudeStale = false;
+	mutable AttitudeStats attitudeStats;
+	// 四元数姿态（启用时为显式姿态的主状态，attitude 为其欧拉角缓存，eulerStale 表示缓存过期）
+	bool quaternionAttitude = false;
+	mutable Quaternion orientation;
+	mutable bool eulerStale = false;
 };
 
 // 根据速度和时间步长更新位置
 GeoPosition updateGeoPosition(const GeoPosition& pos, const Vector3& velocity, double dt);
 
+// 批量位置积分：对连续存储的位置/速度数组逐元素执行 updateGeoPosition（原地更新）
+// 运行时按CPU选择 AVX-512 / AVX2 / 标量实现（见 SimdKernels.h），标量实现与 updateGeoPosition 逐位一致，
+// SIMD实现与其差异：纬度、经度 < 1e-12 度，高度 < 1e-9 米（|纬度| < 89.9 度）
+void updateGeoPositionBatch(double* latitude, double* longitude, double* altitude,
+                            const double* velocityNorth, const double* velocityUp,
+                            const double* velocityEast, std::size_t count, double dt);
+
 #endif // AIRCRAFT_MODEL_LIBRARY_H
@@ -0,0 +1,146 @@
+#include "AnalyticPropagator.h"
+#include "EulerAngleCalculation.h"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+
+namespace {
+
+// 地球半径 (单位：米)，与 updateGeoPosition 保持一致
+const double EARTH_RADIUS = 6371000.0;
+
+// 第一类整数阶 Bessel 函数 J_0(x) .. J_n(x)（x >= 0）
+// Miller 向后递推（对 J_k 递推是数值稳定的方向），再由 J_0 + 2ΣJ_2k = 1 归一化
+void besselJ(double x, int n, double* J) {
+    std::fill(J, J + n + 1, 0.0);
+    if (x < 1e-8) {
+        // 小宗量：J_0 = 1 - x²/4，J_1 = x/2，更高阶低于双精度分辨率
+        J[0] = 1.0 - 0.25 * x * x;
+        if (n >= 1) J[1] = 0.5 * x;
+        return;
+    }
+    int top = std::max(n, static_cast<int>(x));
+    int start = 2 * ((top + 16 + static_cast<int>(std::sqrt(40.0 * top))) / 2);
+    double next = 0.0;      // J_{k+1}
+    double current = 1.0;   // J_k（未归一化）
+    double evenSum = 0.0;
+    for (int k = start; k > 0; --k) {
+        double previous = 2.0 * k / x * current - next;
+        next = current;
+        current = previous;
+        if (std::abs(current) > 1e150) {
+            // 向后递推的值增长很快，及时整体缩放防止溢出（比例不变）
+            current *= 1e-150;
+            next *= 1e-150;
+            evenSum *= 1e-150;
+            for (int i = k; i <= n; ++i) J[i] *= 1e-150;
+        }
+        int order = k - 1;
+        if (order <= n) J[order] = current;
+        if (order > 0 && order % 2 == 0) evenSum += current;
+    }
+    double norm = current + 2.0 * evenSum;
+    for (int i = 0; i <= n; ++i) J[i] /= norm;
+}
+
+// ∫_0^T exp(i k τ) dτ = T · exp(i k T / 2) · sinc(k T / 2)（k -> 0 时无抵消误差）
+std::complex<double> oscillatoryIntegral(double k, double T) {
+    double half = 0.5 * k * T;
+    double sinc = std::abs(half) < 1e-6 ? 1.0 - half * half / 6.0 : std::sin(half) / half;
+    return T * sinc * std::complex<double>(std::cos(half), std::sin(half));
+}
+
+} // namespace
+
+bool AnalyticPropagator::advanceSegment(const MotionSegment& segment, double duration,
+                                        GeoPosition& position, Vector3& velocity) {
+    // 水平速度记为复数 north + i·east，转过角度 θ 即乘以 exp(iθ)（与各机动模型的旋转公式一致）
+    const std::complex<double> v0(velocity.north, velocity.east);
+    const double T = duration;
+    std::complex<double> displacement;
+    double headingChange = segment.turnRate * T;
+    const bool sinusoidal = segment.turnFrequency != 0.0 && segment.turnAmplitude != 0.0;
+    if (!sinusoidal) {
+        displacement = v0 * oscillatoryIntegral(segment.turnRate, T);
+    } else {
+        // 航向 ψ(τ) - ψ0 = ωτ + b·(cos φ - cos(Ωτ + φ))，b = A/Ω
+        // exp(-i b cos x) = Σn (-i)^n J_n(b) exp(i n x)，正负n两项合并后逐项积分
+        const double omega = segment.turnRate;
+        const double Omega = segment.turnFrequency;
+        const double phi = segment.turnPhase;
+        const double b = segment.turnAmplitude / Omega;
+        const double x = std::abs(b);
+        const int order = static_cast<int>(std::ceil(x + 10.0 * std::cbrt(x) + 10.0));
+        if (order > MAX_BESSEL_ORDER) return false;
+        double J[MAX_BESSEL_ORDER + 1];
+        besselJ(x, order, J);
+
+        std::complex<double> sum = J[0] * oscillatoryIntegral(omega, T);
+        std::complex<double> minusIPower(1.0, 0.0);   // (-i)^n
+        for (int n = 1; n <= order; ++n) {
+            minusIPower *= std::complex<double>(0.0, -1.0);
+            double Jn = (b < 0.0 && (n % 2 == 1)) ? -J[n] : J[n];   // J_n(-x) = (-1)^n J_n(x)
+            std::complex<double> rotation(std::cos(n * phi), std::sin(n * phi));
+            sum += minusIPower * Jn * (rotation * oscillatoryIntegral(omega + n * Omega, T) +
+                                       std::conj(rotation) * oscillatoryIntegral(omega - n * Omega, T));
+        }
+        displacement = v0 * std::polar(1.0, b * std::cos(phi)) * sum;
+        headingChange += b * (std::cos(phi) - std::cos(Omega * T + phi));
+    }
+    const std::complex<double> v1 = v0 * std::polar(1.0, headingChange);
+
+    double dUp = segment.verticalSpeed * T;
+    double up = segment.verticalSpeed;
+    if (segment.climbFrequency != 0.0) {
+        double endPhase = segment.climbFrequency * T + segment.climbPhase;
+        dUp += segment.climbAmplitude / segment.climbFrequency * (std::cos(segment.climbPhase) - std::cos(endPhase));
+        up += segment.climbAmplitude * std::sin(endPhase);
+    }
+
+    // 经度增量按段起止平均纬度处的纬圈半径换算（与逐步积分相差 O(Δ纬度²)）
+    double latitude = position.latitude + (displacement.real() / EARTH_RADIUS) * (180.0 / M_PI);
+    double radiusAtLat = EARTH_RADIUS * std::cos(0.5 * (position.latitude + latitude) * M_PI / 180.0);
+    if (std::abs(radiusAtLat) > 1e-6)
+        position.longitude += (displacement.imag() / radiusAtLat) * (180.0 / M_PI);
+    position.latitude = latitude;
+    position.altitude += dUp;
+
+    velocity.north = v1.real();
+    velocity.east = v1.imag();
+    velocity.up = up;
+    return true;
+}
+
+bool AnalyticPropagator::propagate(const GeoPosition& position, const Vector3& velocity, const MotionPlan& plan,
+                                   double t, PropagatedState& state) {
+    if (t < 0.0) {
+        throw std::invalid_argument("AnalyticPropagator: propagation time must be non-negative");
+    }
+    GeoPosition p = position;
+    Vector3 v = velocity;
+    double remaining = t;
+    for (std::size_t i = 0; i < plan.count && remaining > 0.0; ++i) {
+        double duration = std::min(remaining, plan.segments[i].duration);
+        if (duration > 0.0 && !advanceSegment(plan.segments[i], duration, p, v)) {
+            return false;
+        }
+        remaining -= duration;
+    }
+    state.position = p;
+    state.velocity = v;
+    state.attitude = EulerAngleCalculator::calculateFromVelocity(v);
+    return true;
+}
+
+bool AnalyticPropagator::propagateTo(const Aircraft& aircraft, double t, PropagatedState& state) {
+    if (t < 0.0) {
+        throw std::invalid_argument("AnalyticPropagator: propagation time must be non-negative");
+    }
+    const ManeuverModel* model = aircraft.getManeuverModel();
+    MotionPlan plan;
+    if (!model || !model->planMotion(aircraft, plan)) {
+        return false;
+    }
+    return propagate(aircraft.position, aircraft.velocity, plan, t, state);
+}
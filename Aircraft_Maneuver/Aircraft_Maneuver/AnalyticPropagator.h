@@ -0,0 +1,37 @@
+#ifndef ANALYTIC_PROPAGATOR_H
+#define ANALYTIC_PROPAGATOR_H
+
+#include "AircraftModelLibrary.h"
+#include "ManeuverModel.h"
+
+// 外推得到的飞机状态
+struct PropagatedState {
+    GeoPosition position;
+    Vector3 velocity;
+    AttitudeAngles attitude;   // 由速度计算（与可外推机动每步的做法相同）
+};
+
+// 解析外推：对可闭式求解的机动（ManeuverModel::planMotion 返回true）直接计算任意未来时刻的状态，
+// 耗时与外推时长无关，不需要逐步仿真中间时刻。
+// 常值转向段按圆弧积分；正弦转向段用 Jacobi-Anger 展开为 Bessel 函数级数后逐项积分；
+// 每段的水平位移按段起止的平均纬度换算为经纬度。
+// 结果是逐步仿真在 dt -> 0 时的极限（与步长 dt 的仿真相差 O(dt)），不考虑推力与阻力不平衡引起的速度大小变化。
+class AnalyticPropagator {
+public:
+    // 飞机在t秒后的状态；未设置机动模型或当前机动不支持解析外推时返回false（state 不修改）
+    // t 为负时抛出 std::invalid_argument
+    static bool propagateTo(const Aircraft& aircraft, double t, PropagatedState& state);
+
+    // 从给定位置与速度按运动描述外推t秒（超出全部段时长时停在最后一段末尾）
+    // 正弦转向的相位摆幅过大（Bessel 级数超过 MAX_BESSEL_ORDER 阶）时返回false
+    static bool propagate(const GeoPosition& position, const Vector3& velocity, const MotionPlan& plan,
+                          double t, PropagatedState& state);
+
+    // 在一个运动段内前进 duration 秒（不检查段时长），原地更新位置与速度
+    static bool advanceSegment(const MotionSegment& segment, double duration, GeoPosition& position, Vector3& velocity);
+
+    // 正弦转向展开的最大阶数（对应航向摆幅 turnAmplitude / turnFrequency 约 200 弧度）
+    static const int MAX_BESSEL_ORDER = 256;
+};
+
+#endif // ANALYTIC_PROPAGATOR_H
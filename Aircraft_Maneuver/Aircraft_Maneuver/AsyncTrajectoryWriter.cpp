@@ -0,0 +1,130 @@
+#include "AsyncTrajectoryWriter.h"
+#include "LocalTangentFrame.h"
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+namespace {
+
+// 写线程空闲时的最长休眠时间
+const std::chrono::microseconds MAX_IDLE_SLEEP(500);
+
+} // namespace
+
+AsyncTrajectoryWriter::AsyncTrajectoryWriter(const std::string& path, unsigned optionalColumns,
+                                             std::shared_ptr<const LocalTangentFrame> frame,
+                                             const AsyncWriterOptions& options)
+    : recorder(path, optionalColumns, options.flushInterval), frame(std::move(frame)), options(options),
+      ring(options.capacity), decimationDepth(0), decimationCounter(0), stopping(false),
+      submitted(0), written(0), dropped(0), decimated(0), blocked(0), maxQueueDepth(0), closed(false) {
+    if (recorder.isRecordingNUE() && !this->frame) {
+        throw std::invalid_argument("AsyncTrajectoryWriter: RECORD_NUE requires a reference frame");
+    }
+    if (options.decimationFactor == 0 || !(options.decimationThreshold >= 0.0 && options.decimationThreshold <= 1.0)) {
+        throw std::invalid_argument("AsyncTrajectoryWriter: invalid decimation settings");
+    }
+    decimationDepth = static_cast<std::size_t>(options.decimationThreshold * ring.capacity());
+    writer = std::thread(&AsyncTrajectoryWriter::writerLoop, this);
+}
+
+AsyncTrajectoryWriter::~AsyncTrajectoryWriter() {
+    try {
+        close();
+    }
+    catch (...) {
+        // 析构中不抛出异常
+    }
+}
+
+bool AsyncTrajectoryWriter::submit(double time, const Aircraft& aircraft) {
+    TrajectorySample sample = { time, aircraft.position, aircraft.velocity, aircraft.getAttitude() };
+    return submit(sample);
+}
+
+bool AsyncTrajectoryWriter::submit(const TrajectorySample& sample) {
+    if (closed) {
+        throw std::invalid_argument("AsyncTrajectoryWriter: submit after close");
+    }
+    submitted.fetch_add(1, std::memory_order_relaxed);
+
+    std::size_t depth = ring.size();
+    if (depth > maxQueueDepth.load(std::memory_order_relaxed)) {
+        maxQueueDepth.store(depth, std::memory_order_relaxed);
+    }
+
+    if (options.policy == BackpressurePolicy::Decimate && depth >= decimationDepth) {
+        if (decimationCounter++ % options.decimationFactor != 0) {
+            decimated.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    } else {
+        decimationCounter = 0;
+    }
+
+    if (ring.tryPush(sample)) {
+        return true;
+    }
+    if (options.policy != BackpressurePolicy::Block) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    blocked.fetch_add(1, std::memory_order_relaxed);
+    while (!ring.tryPush(sample)) {
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+void AsyncTrajectoryWriter::writerLoop() {
+    try {
+        std::chrono::microseconds idleSleep(1);
+        TrajectorySample sample;
+        for (;;) {
+            if (ring.tryPop(sample)) {
+                Vector3 ecef = recorder.isRecordingECEF() ? LocalTangentFrame::geodeticToECEF(sample.position) : Vector3{};
+                Vector3 nue = recorder.isRecordingNUE() ? frame->toNUE(sample.position) : Vector3{};
+                recorder.record(sample, ecef, nue);
+                written.fetch_add(1, std::memory_order_relaxed);
+                idleSleep = std::chrono::microseconds(1);
+                continue;
+            }
+            // stopping 在生产者最后一次入队之后置位，此时队列为空即已排空
+            if (stopping.load(std::memory_order_acquire) && ring.empty()) {
+                break;
+            }
+            std::this_thread::sleep_for(idleSleep);
+            idleSleep = std::min(idleSleep * 2, MAX_IDLE_SLEEP);
+        }
+        recorder.close();
+    }
+    catch (...) {
+        writerError = std::current_exception();
+        // 出错后继续消费，避免 Block 策略下生产者永久等待
+        TrajectorySample sample;
+        while (!stopping.load(std::memory_order_acquire) || !ring.empty()) {
+            if (!ring.tryPop(sample)) std::this_thread::yield();
+        }
+    }
+}
+
+void AsyncTrajectoryWriter::close() {
+    if (closed) return;
+    closed = true;
+    stopping.store(true, std::memory_order_release);
+    writer.join();
+    if (writerError) {
+        std::rethrow_exception(writerError);
+    }
+}
+
+AsyncTrajectoryWriter::Stats AsyncTrajectoryWriter::getStats() const {
+    Stats stats;
+    stats.submitted = submitted.load(std::memory_order_relaxed);
+    stats.written = written.load(std::memory_order_relaxed);
+    stats.dropped = dropped.load(std::memory_order_relaxed);
+    stats.decimated = decimated.load(std::memory_order_relaxed);
+    stats.blocked = blocked.load(std::memory_order_relaxed);
+    stats.queueDepth = ring.size();
+    stats.maxQueueDepth = maxQueueDepth.load(std::memory_order_relaxed);
+    return stats;
+}
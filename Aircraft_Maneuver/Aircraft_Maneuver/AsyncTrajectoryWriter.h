@@ -0,0 +1,87 @@
+#ifndef ASYNC_TRAJECTORY_WRITER_H
+#define ASYNC_TRAJECTORY_WRITER_H
+
+#include "AircraftModelLibrary.h"
+#include "SpscRing.h"
+#include "TrajectoryRecorder.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <string>
+#include <thread>
+
+class LocalTangentFrame;
+
+// 队列满时仿真线程的处理策略
+enum class BackpressurePolicy {
+    Block,     // 等待写线程腾出空间（不丢数据，但仿真步会受存储速度影响）
+    Drop,      // 丢弃当前快照
+    Decimate   // 队列深度超过阈值后只保留每 decimationFactor 个快照中的一个，仍满则丢弃
+};
+
+struct AsyncWriterOptions {
+    std::size_t capacity = 4096;                 // 环形队列容量（快照数）
+    BackpressurePolicy policy = BackpressurePolicy::Block;
+    std::size_t decimationFactor = 4;            // Decimate：抽稀倍数
+    double decimationThreshold = 0.5;            // Decimate：开始抽稀的队列占用比例
+    std::size_t flushInterval = 65536;           // 传给 TrajectoryRecorder 的数据块行数
+};
+
+// 异步轨迹输出：仿真线程只把状态快照放入无锁SPSC环形队列，
+// 专用写线程负责派生量计算（ECEF/NUE）、列式编码和文件写入，仿真步耗时不再取决于存储设备。
+// submit 只能由一个线程调用（单生产者）。
+class AsyncTrajectoryWriter {
+public:
+    struct Stats {
+        std::uint64_t submitted;   // submit 调用次数
+        std::uint64_t written;     // 已写入文件的快照数
+        std::uint64_t dropped;     // 因队列满丢弃的快照数
+        std::uint64_t decimated;   // 因抽稀跳过的快照数
+        std::uint64_t blocked;     // Block 策略下需要等待的次数
+        std::size_t queueDepth;    // 当前队列深度
+        std::size_t maxQueueDepth; // 队列深度峰值
+    };
+
+    // optionalColumns 同 TrajectoryRecorder；启用 RECORD_NUE 时必须提供 frame，否则抛出 std::invalid_argument
+    AsyncTrajectoryWriter(const std::string& path, unsigned optionalColumns = 0,
+                          std::shared_ptr<const LocalTangentFrame> frame = nullptr,
+                          const AsyncWriterOptions& options = AsyncWriterOptions());
+    ~AsyncTrajectoryWriter();
+
+    AsyncTrajectoryWriter(const AsyncTrajectoryWriter&) = delete;
+    AsyncTrajectoryWriter& operator=(const AsyncTrajectoryWriter&) = delete;
+
+    // 提交一步快照，返回是否入队（被丢弃或抽稀时返回 false）
+    bool submit(double time, const Aircraft& aircraft);
+    bool submit(const TrajectorySample& sample);
+
+    // 等待队列排空、写入文件尾并结束写线程；写线程中的I/O异常在此重新抛出
+    void close();
+
+    Stats getStats() const;
+
+private:
+    void writerLoop();
+
+    TrajectoryRecorder recorder;
+    std::shared_ptr<const LocalTangentFrame> frame;
+    AsyncWriterOptions options;
+    SpscRing<TrajectorySample> ring;
+    std::size_t decimationDepth;       // 开始抽稀的队列深度
+    std::uint64_t decimationCounter;   // 仅生产者线程访问
+
+    std::atomic<bool> stopping;
+    std::atomic<std::uint64_t> submitted;
+    std::atomic<std::uint64_t> written;
+    std::atomic<std::uint64_t> dropped;
+    std::atomic<std::uint64_t> decimated;
+    std::atomic<std::uint64_t> blocked;
+    std::atomic<std::size_t> maxQueueDepth;
+    std::exception_ptr writerError;
+    bool closed;
+    std::thread writer;
+};
+
+#endif // ASYNC_TRAJECTORY_WRITER_H
@@ -0,0 +1,330 @@
+#include "CompiledManeuverTemplate.h"
+#include "SimdKernels.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+
+// 游标向前顺序扫描的最大段数，超过则改用二分查找（与 ManeuverTemplate 相同）
+const std::size_t CURSOR_SCAN_LIMIT = 4;
+
+// 批量求值每批的点数（段号与局部时间的临时缓冲区放在栈上）
+const std::size_t BATCH_CHUNK = 256;
+
+// 通道顺序与 ManeuverRateArrays 一致
+double ManeuverPoint::* const CHANNELS[CompiledManeuverTemplate::CHANNEL_COUNT] = {
+    &ManeuverPoint::turnRate, &ManeuverPoint::climbRate, &ManeuverPoint::rollRate,
+    &ManeuverPoint::pitchRate, &ManeuverPoint::yawRate,
+};
+
+// 三点端点斜率（Fritsch-Carlson 保形修正）：h0/delta0 为端点所在区间，h1/delta1 为相邻区间
+double endpointSlope(double h0, double h1, double delta0, double delta1) {
+    double d = ((2.0 * h0 + h1) * delta0 - h0 * delta1) / (h0 + h1);
+    if ((d > 0.0) != (delta0 > 0.0) || delta0 == 0.0) return 0.0;
+    if ((delta0 > 0.0) != (delta1 > 0.0) && std::abs(d) > std::abs(3.0 * delta0)) return 3.0 * delta0;
+    return d;
+}
+
+// 单个通道在一段连续（时间严格递增）机动点上的各点斜率
+void runSlopes(const std::vector<double>& h, const std::vector<double>& delta, SplineInterpolation interpolation,
+               std::vector<double>& slopeLeft, std::vector<double>& slopeRight) {
+    const std::size_t n = h.size();
+    slopeLeft.assign(n, 0.0);
+    slopeRight.assign(n, 0.0);
+    if (interpolation == SplineInterpolation::Linear || n == 1) {
+        for (std::size_t j = 0; j < n; ++j) {
+            slopeLeft[j] = delta[j];
+            slopeRight[j] = delta[j];
+        }
+        return;
+    }
+    // 节点斜率：内部节点取相邻割线斜率的加权调和平均，割线异号或为0时取0（不产生极值）
+    std::vector<double> d(n + 1);
+    d[0] = endpointSlope(h[0], h[1], delta[0], delta[1]);
+    d[n] = endpointSlope(h[n - 1], h[n - 2], delta[n - 1], delta[n - 2]);
+    for (std::size_t j = 1; j < n; ++j) {
+        if (delta[j - 1] * delta[j] <= 0.0) {
+            d[j] = 0.0;
+        } else {
+            double w1 = 2.0 * h[j] + h[j - 1];
+            double w2 = h[j] + 2.0 * h[j - 1];
+            d[j] = (w1 + w2) / (w1 / delta[j - 1] + w2 / delta[j]);
+        }
+    }
+    for (std::size_t j = 0; j < n; ++j) {
+        slopeLeft[j] = d[j];
+        slopeRight[j] = d[j + 1];
+    }
+}
+
+template<class T>
+void appendBytes(std::vector<unsigned char>& blob, const T* data, std::size_t count) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+    blob.insert(blob.end(), bytes, bytes + count * sizeof(T));
+}
+
+std::size_t paddedNameSize(std::size_t length) {
+    return (length + 7) / 8 * 8;
+}
+
+} // namespace
+
+CompiledManeuverTemplate CompiledManeuverTemplate::compile(const ManeuverTemplate& maneuverTemplate,
+                                                           SplineInterpolation interpolation) {
+    CompiledManeuverTemplate result;
+    result.name = maneuverTemplate.getName();
+    result.interpolation = interpolation;
+
+    const std::vector<ManeuverPoint>& points = maneuverTemplate.getPoints();
+    std::vector<double> h, delta, slopeLeft, slopeRight;
+
+    // 时长为0的常值段，保持单个机动点的取值
+    auto appendConstant = [&](const ManeuverPoint& point) {
+        SegmentBlock block{};
+        for (std::size_t c = 0; c < CHANNEL_COUNT; ++c) {
+            block.value[c] = point.*CHANNELS[c];
+        }
+        block.value[SLOT_START] = point.time;
+        block.value[SLOT_END] = point.time;
+        result.segmentStart.push_back(point.time);
+        result.blocks.push_back(block);
+    };
+
+    // 按重复时间点切分为若干连续区间组，组内分别构造样条，组间为阶跃
+    auto appendRun = [&](std::size_t begin, std::size_t end) {
+        const std::size_t n = end - begin - 1;   // 区间数
+        const std::size_t first = result.segmentStart.size();
+        result.segmentStart.resize(first + n);
+        result.blocks.resize(first + n, SegmentBlock{});
+        h.resize(n);
+        for (std::size_t j = 0; j < n; ++j) {
+            h[j] = points[begin + j + 1].time - points[begin + j].time;
+            result.segmentStart[first + j] = points[begin + j].time;
+            result.blocks[first + j].value[SLOT_START] = points[begin + j].time;
+            result.blocks[first + j].value[SLOT_END] = points[begin + j + 1].time;
+        }
+        delta.resize(n);
+        for (std::size_t c = 0; c < CHANNEL_COUNT; ++c) {
+            double ManeuverPoint::* channel = CHANNELS[c];
+            for (std::size_t j = 0; j < n; ++j) {
+                delta[j] = (points[begin + j + 1].*channel - points[begin + j].*channel) / h[j];
+            }
+            runSlopes(h, delta, interpolation, slopeLeft, slopeRight);
+            for (std::size_t j = 0; j < n; ++j) {
+                // Hermite 形式转为局部时间 u 的幂基：y0 + d0 u + c2 u^2 + c3 u^3
+                double* block = result.blocks[first + j].value + c;
+                double d0 = slopeLeft[j];
+                double d1 = slopeRight[j];
+                block[0] = points[begin + j].*channel;
+                block[SPLINE_CHANNEL_STRIDE] = d0;
+                block[2 * SPLINE_CHANNEL_STRIDE] = (3.0 * delta[j] - 2.0 * d0 - d1) / h[j];
+                block[3 * SPLINE_CHANNEL_STRIDE] = (d0 + d1 - 2.0 * delta[j]) / (h[j] * h[j]);
+            }
+        }
+    };
+
+    // 只含单点的组没有区间：首组保持首点（首点之前及首点时刻取首点），末组保持末点（末点之后取末点），
+    // 中间的单点组被前后阶跃覆盖、不可观测，直接跳过。单点模板即一个常值段。
+    std::size_t begin = 0;
+    for (std::size_t i = 1; i <= points.size(); ++i) {
+        if (i == points.size() || points[i].time == points[i - 1].time) {
+            if (i - begin > 1) {
+                appendRun(begin, i);
+            } else if (begin == 0 || i == points.size()) {
+                appendConstant(points[begin]);
+            }
+            begin = i;
+        }
+    }
+    return result;
+}
+
+std::size_t CompiledManeuverTemplate::findSegment(double currentTime) const {
+    // 最后一个起始时间 <= currentTime 的段；首段起点及之前取首段（首点重复时首段为保持首点的常值段）
+    if (currentTime <= segmentStart.front()) return 0;
+    auto it = std::upper_bound(segmentStart.begin(), segmentStart.end(), currentTime);
+    return static_cast<std::size_t>(it - segmentStart.begin()) - 1;
+}
+
+std::size_t CompiledManeuverTemplate::seekSegment(double currentTime, std::size_t segment) const {
+    const std::size_t last = blocks.size() - 1;
+    if (currentTime >= segmentStart[segment]) {
+        // 时间前进：先顺序推进少量段，仍未到达再二分
+        std::size_t scanned = 0;
+        while (segment < last && currentTime >= segmentStart[segment + 1] && scanned < CURSOR_SCAN_LIMIT) {
+            ++segment;
+            ++scanned;
+        }
+        if (segment < last && currentTime >= segmentStart[segment + 1]) {
+            segment = findSegment(currentTime);
+        }
+    } else {
+        // 时间回退（随机访问）
+        segment = findSegment(currentTime);
+    }
+    return segment;
+}
+
+inline std::size_t CompiledManeuverTemplate::advanceCursor(double currentTime, Cursor& cursor) const {
+    const std::size_t last = blocks.size() - 1;
+    std::size_t segment = std::min(cursor.segment, last);
+    if (currentTime <= segmentStart.front()) {
+        cursor.segment = 0;
+        return 0;
+    }
+    // 仍在上次所在段内（末段之后保持末段）：只读取该段系数块，求值时同一缓存行还会用到
+    const double* row = blocks[segment].value;
+    if (currentTime >= row[SLOT_START] && (currentTime < row[SLOT_END] || segment == last)) {
+        return segment;
+    }
+    segment = seekSegment(currentTime, segment);
+    cursor.segment = segment;
+    return segment;
+}
+
+inline double CompiledManeuverTemplate::localTime(double currentTime, std::size_t segment) const {
+    const double* row = blocks[segment].value;
+    double u = currentTime - row[SLOT_START];
+    return std::min(std::max(u, 0.0), row[SLOT_END] - row[SLOT_START]);
+}
+
+ManeuverPoint CompiledManeuverTemplate::evaluate(double currentTime) const {
+    std::size_t segment = findSegment(currentTime);
+    double u = localTime(currentTime, segment);
+    const double* block = blocks[segment].value;
+    double value[CHANNEL_COUNT];
+    for (std::size_t c = 0; c < CHANNEL_COUNT; ++c) {
+        double r = block[3 * SPLINE_CHANNEL_STRIDE + c];
+        r = r * u + block[2 * SPLINE_CHANNEL_STRIDE + c];
+        r = r * u + block[SPLINE_CHANNEL_STRIDE + c];
+        value[c] = r * u + block[c];
+    }
+    return ManeuverPoint(currentTime, value[0], value[1], value[2], value[3], value[4]);
+}
+
+void CompiledManeuverTemplate::evaluateBatch(const double* time, std::size_t count, const ManeuverRateArrays& output,
+                                             Cursor* cursors) const {
+    const SimdKernelTable& kernels = getSimdKernels();
+    std::int64_t offset[BATCH_CHUNK];
+    double u[BATCH_CHUNK];
+    for (std::size_t begin = 0; begin < count; begin += BATCH_CHUNK) {
+        std::size_t n = std::min(BATCH_CHUNK, count - begin);
+        // 标量预处理：定位段号与局部时间（内核只做无分支的收集与 Horner）
+        for (std::size_t k = 0; k < n; ++k) {
+            double t = time[begin + k];
+            std::size_t segment = cursors ? advanceCursor(t, cursors[begin + k]) : findSegment(t);
+            offset[k] = static_cast<std::int64_t>(segment * SPLINE_SEGMENT_STRIDE);
+            u[k] = localTime(t, segment);
+        }
+        double* const channels[CHANNEL_COUNT] = {
+            output.turnRate + begin, output.climbRate + begin, output.rollRate + begin,
+            output.pitchRate + begin, output.yawRate + begin,
+        };
+        kernels.evaluatePiecewiseCubic(blocks.front().value, offset, u, channels, CHANNEL_COUNT, n);
+    }
+}
+
+std::vector<unsigned char> CompiledManeuverTemplate::toBlob() const {
+    unsigned char header[CompiledTemplateFormat::HEADER_SIZE] = {};
+    std::uint32_t version = CompiledTemplateFormat::VERSION;
+    std::uint32_t kind = static_cast<std::uint32_t>(interpolation);
+    std::uint64_t segments = segmentStart.size();
+    std::uint32_t stride = static_cast<std::uint32_t>(SPLINE_CHANNEL_STRIDE);
+    std::uint32_t nameLength = static_cast<std::uint32_t>(name.size());
+    std::memcpy(header, CompiledTemplateFormat::MAGIC, 8);
+    std::memcpy(header + 8, &version, 4);
+    std::memcpy(header + 12, &kind, 4);
+    std::memcpy(header + 16, &segments, 8);
+    std::memcpy(header + 24, &stride, 4);
+    std::memcpy(header + 28, &nameLength, 4);
+
+    std::vector<unsigned char> blob;
+    blob.reserve(CompiledTemplateFormat::HEADER_SIZE + paddedNameSize(name.size()) +
+                 segmentStart.size() * (sizeof(double) + sizeof(SegmentBlock)));
+    appendBytes(blob, header, sizeof(header));
+    appendBytes(blob, name.data(), name.size());
+    blob.resize(blob.size() + paddedNameSize(name.size()) - name.size(), 0);
+    appendBytes(blob, segmentStart.data(), segmentStart.size());
+    appendBytes(blob, blocks.data(), blocks.size());
+    return blob;
+}
+
+CompiledManeuverTemplate CompiledManeuverTemplate::fromBlob(const void* data, std::size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    if (size < CompiledTemplateFormat::HEADER_SIZE ||
+        std::memcmp(bytes, CompiledTemplateFormat::MAGIC, 8) != 0) {
+        throw std::runtime_error("CompiledManeuverTemplate: not a compiled template blob");
+    }
+    std::uint32_t version, kind, stride, nameLength;
+    std::uint64_t segments;
+    std::memcpy(&version, bytes + 8, 4);
+    std::memcpy(&kind, bytes + 12, 4);
+    std::memcpy(&segments, bytes + 16, 8);
+    std::memcpy(&stride, bytes + 24, 4);
+    std::memcpy(&nameLength, bytes + 28, 4);
+    if (version != CompiledTemplateFormat::VERSION) {
+        throw std::runtime_error("CompiledManeuverTemplate: unsupported version " + std::to_string(version));
+    }
+    if (kind > static_cast<std::uint32_t>(SplineInterpolation::MonotoneCubic) || stride != SPLINE_CHANNEL_STRIDE ||
+        segments == 0) {
+        throw std::runtime_error("CompiledManeuverTemplate: corrupt header");
+    }
+    // 先按剩余字节数检查段数，避免乘法溢出
+    std::size_t remaining = size - CompiledTemplateFormat::HEADER_SIZE;
+    std::size_t nameBytes = paddedNameSize(nameLength);
+    const std::size_t segmentBytes = sizeof(double) + sizeof(SegmentBlock);
+    if (nameBytes > remaining || segments != (remaining - nameBytes) / segmentBytes ||
+        (remaining - nameBytes) % segmentBytes != 0) {
+        throw std::runtime_error("CompiledManeuverTemplate: truncated or oversized blob");
+    }
+
+    CompiledManeuverTemplate result;
+    const unsigned char* p = bytes + CompiledTemplateFormat::HEADER_SIZE;
+    result.name.assign(reinterpret_cast<const char*>(p), nameLength);
+    p += nameBytes;
+    std::size_t n = static_cast<std::size_t>(segments);
+    result.interpolation = static_cast<SplineInterpolation>(kind);
+    result.segmentStart.resize(n);
+    result.blocks.resize(n);
+    std::memcpy(result.segmentStart.data(), p, n * sizeof(double));
+    p += n * sizeof(double);
+    std::memcpy(static_cast<void*>(result.blocks.data()), p, n * sizeof(SegmentBlock));
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const double* row = result.blocks[i].value;
+        if (row[SLOT_START] != result.segmentStart[i] || !(row[SLOT_END] >= row[SLOT_START]) ||
+            (i > 0 && !(row[SLOT_START] >= result.blocks[i - 1].value[SLOT_END]))) {
+            throw std::runtime_error("CompiledManeuverTemplate: segment times must be non-decreasing");
+        }
+    }
+    return result;
+}
+
+void CompiledManeuverTemplate::save(const std::string& path) const {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("CompiledManeuverTemplate: cannot open " + path);
+    }
+    std::vector<unsigned char> blob = toBlob();
+    file.write(reinterpret_cast<const char*>(blob.data()), static_cast<std::streamsize>(blob.size()));
+    if (!file) {
+        throw std::runtime_error("CompiledManeuverTemplate: write failed");
+    }
+}
+
+CompiledManeuverTemplate CompiledManeuverTemplate::load(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw std::runtime_error("CompiledManeuverTemplate: cannot open " + path);
+    }
+    std::streamsize size = file.tellg();
+    file.seekg(0);
+    std::vector<unsigned char> blob(size > 0 ? static_cast<std::size_t>(size) : 0);
+    if (size < 0 || !file.read(reinterpret_cast<char*>(blob.data()), size)) {
+        throw std::runtime_error("CompiledManeuverTemplate: read failed " + path);
+    }
+    return fromBlob(blob.data(), blob.size());
+}
@@ -0,0 +1,100 @@
+#ifndef COMPILED_MANEUVER_TEMPLATE_H
+#define COMPILED_MANEUVER_TEMPLATE_H
+
+#include "ManeuverTemplate.h"
+#include "SimdKernels.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 样条插值方式
+enum class SplineInterpolation : std::uint32_t {
+    Linear = 0,          // 分段线性（与 ManeuverTemplate::evaluate 相同的曲线）
+    MonotoneCubic = 1,   // 保单调三次 Hermite（Fritsch-Carlson），一阶导连续且不过冲
+};
+
+// 批量求值输出（结构数组，每个通道 count 个值）
+struct ManeuverRateArrays {
+    double* turnRate;
+    double* climbRate;
+    double* rollRate;
+    double* pitchRate;
+    double* yawRate;
+};
+
+// 二进制样条文件格式
+// 头部64字节，之后依次为名称（补齐到8字节）、segmentStart[n]、各段系数块[n][SPLINE_SEGMENT_STRIDE]，
+// 全部为本机字节序；数组按内存中的最终布局存放，加载只需校验头部后整块拷贝。
+namespace CompiledTemplateFormat {
+    const char MAGIC[8] = { 'A', 'C', 'S', 'P', 'L', 'N', '\0', '\0' };
+    const std::uint32_t VERSION = 1;
+    const std::size_t HEADER_SIZE = 64;
+}
+
+// 编译后的机动模板：机动点序列离线转换为分段三次多项式系数表
+// 每段系数按 [次数][通道] 排成 SPLINE_SEGMENT_STRIDE 个 double 的64字节对齐块（见 SimdKernels.h），
+// 0次项行的空闲槽位存放该段起止时间，顺序求值时定位段号与求值只访问同一块。
+// 批量求值时先按各飞机的时间定位段号，再由 SIMD 内核按通道方向向量化的 Horner 一次计算5个通道。
+// 取值规则与 ManeuverTemplate 相同：首点之前取首点、末点之后保持末点，同一时刻的重复点形成阶跃。
+class CompiledManeuverTemplate {
+public:
+    // 通道数：转向、爬升、滚转、俯仰、偏航
+    static constexpr std::size_t CHANNEL_COUNT = 5;
+
+    // 顺序求值游标，每架飞机各持有一个（语义与 ManeuverTemplate::Cursor 相同，段号指编译后的段）
+    struct Cursor {
+        std::size_t segment = 0;
+    };
+
+    // 由机动模板编译
+    static CompiledManeuverTemplate compile(const ManeuverTemplate& maneuverTemplate,
+                                            SplineInterpolation interpolation = SplineInterpolation::MonotoneCubic);
+
+    // 二进制序列化；数据格式错误时抛出 std::runtime_error
+    std::vector<unsigned char> toBlob() const;
+    static CompiledManeuverTemplate fromBlob(const void* data, std::size_t size);
+
+    // 读写文件；无法打开或读写失败时抛出 std::runtime_error
+    void save(const std::string& path) const;
+    static CompiledManeuverTemplate load(const std::string& path);
+
+    const std::string& getName() const { return name; }
+    SplineInterpolation getInterpolation() const { return interpolation; }
+    std::size_t getSegmentCount() const { return segmentStart.size(); }
+    double getStartTime() const { return segmentStart.front(); }
+    double getEndTime() const { return blocks.back().value[SLOT_END]; }
+    double getDuration() const { return getEndTime() - getStartTime(); }
+
+    // 单点求值（运算顺序与标量内核相同）
+    ManeuverPoint evaluate(double currentTime) const;
+
+    // 批量求值：第i架飞机在 time[i] 时刻的5个通道写入 output 各数组的第i个元素
+    // cursors 为空时每点二分查找段号；否则使用并更新各飞机的游标（时间单调前进时均摊O(1)）
+    void evaluateBatch(const double* time, std::size_t count, const ManeuverRateArrays& output,
+                       Cursor* cursors = nullptr) const;
+
+private:
+    // 一段的系数块：value[k * SPLINE_CHANNEL_STRIDE + c] 为通道c的k次项系数
+    struct alignas(64) SegmentBlock {
+        double value[SPLINE_SEGMENT_STRIDE];
+    };
+    // 0次项行中存放段起止时间的槽位（通道之后的空闲槽位，内核不读取）
+    static constexpr std::size_t SLOT_START = CHANNEL_COUNT;
+    static constexpr std::size_t SLOT_END = CHANNEL_COUNT + 1;
+    static_assert(SLOT_END < SPLINE_CHANNEL_STRIDE, "no free slot for segment times");
+
+    CompiledManeuverTemplate() = default;
+
+    std::size_t findSegment(double currentTime) const;
+    std::size_t seekSegment(double currentTime, std::size_t segment) const;   // 游标不在当前段时的顺序扫描/二分
+    std::size_t advanceCursor(double currentTime, Cursor& cursor) const;
+    double localTime(double currentTime, std::size_t segment) const;
+
+    std::string name;
+    SplineInterpolation interpolation = SplineInterpolation::MonotoneCubic;
+    std::vector<double> segmentStart;          // 各段起始时间（单调不减，二分查找用）
+    std::vector<SegmentBlock> blocks;          // 各段系数块，局部时间 u = t - 段起始时间 的幂基
+};
+
+#endif // COMPILED_MANEUVER_TEMPLATE_H
@@ -1,9 +1,12 @@
 #include "CoordinateTransform.h"
+#include "ParallelFor.h"
+#include "SimdKernels.h"
 #include <cmath>
 
 // 静态常量定义
 const double CoordinateTransform::EARTH_RADIUS = 6371000.0;
 const double CoordinateTransform::PI = 3.14159265358979323846;
+const std::size_t CoordinateTransform::BATCH_PARALLEL_THRESHOLD = 16384;
 
 // 辅助函数实现
 double CoordinateTransform::degToRad(double degrees) {
@@ -36,35 +39,39 @@ Eigen::Vector3d CoordinateTransform::geodeticToECEF(const GeoPosition& geodetic)
 }
 
 GeoPosition CoordinateTransform::ecefToGeodetic(const Eigen::Vector3d& ecef) {
-    const double a = 6378137.0;  // 长半轴
-    const double e2 = 0.006694379990141316;  // 第一偏心率平方
-    const double b = 6356752.314245;  // 短半轴
-    
-    double x = ecef.x();
-    double y = ecef.y();
-    double z = ecef.z();
-    
-    double p = sqrt(x * x + y * y);
-    double lat = atan2(z, p * (1 - e2));
-    
-    // 迭代求解纬度
-    for (int i = 0; i < 5; ++i) {
-        double N = a / sqrt(1 - e2 * sin(lat) * sin(lat));
-        double h = p / cos(lat) - N;
-        double lat_new = atan2(z, p * (1 - e2 * N / (N + h)));
-        if (abs(lat - lat_new) < 1e-12) break;
-        lat = lat_new;
-    }
-    
-    double lon = atan2(y, x);
-    double N = a / sqrt(1 - e2 * sin(lat) * sin(lat));
-    double h = p / cos(lat) - N;
-    
-    GeoPosition geodetic;
-    geodetic.latitude = radToDeg(lat);
-    geodetic.longitude = radToDeg(lon);
-    geodetic.altitude = h;
-    
+    return GeodeticSolvers::iterative(ecef.x(), ecef.y(), ecef.z());
+}
+
+GeoPosition CoordinateTransform::ecefToGeodetic(const Eigen::Vector3d& ecef, GeodeticSolver solver) {
+    return GeodeticSolvers::solve(ecef.x(), ecef.y(), ecef.z(), solver);
+}
+
+Eigen::Matrix<double, 3, Eigen::Dynamic> CoordinateTransform::geodeticToECEF(const GeoPosition* geodetic, std::size_t count) {
+    Eigen::Matrix<double, 3, Eigen::Dynamic> ecef(3, count);
+    const SimdKernelTable& kernels = getSimdKernels();
+    double* out = ecef.data();
+    parallelFor(count, BATCH_PARALLEL_THRESHOLD, [&](std::size_t begin, std::size_t end) {
+        kernels.geodeticToECEF(geodetic + begin, out + 3 * begin, end - begin);
+    });
+    return ecef;
+}
+
+Eigen::Matrix<double, 3, Eigen::Dynamic> CoordinateTransform::geodeticToECEF(const std::vector<GeoPosition>& geodetic) {
+    return geodeticToECEF(geodetic.data(), geodetic.size());
+}
+
+void CoordinateTransform::ecefToGeodetic(const Eigen::Matrix<double, 3, Eigen::Dynamic>& ecef, GeoPosition* geodetic) {
+    const SimdKernelTable& kernels = getSimdKernels();
+    const double* in = ecef.data();
+    parallelFor(static_cast<std::size_t>(ecef.cols()), BATCH_PARALLEL_THRESHOLD,
+                [&](std::size_t begin, std::size_t end) {
+        kernels.ecefToGeodetic(in + 3 * begin, geodetic + begin, end - begin);
+    });
+}
+
+std::vector<GeoPosition> CoordinateTransform::ecefToGeodetic(const Eigen::Matrix<double, 3, Eigen::Dynamic>& ecef) {
+    std::vector<GeoPosition> geodetic(static_cast<std::size_t>(ecef.cols()));
+    ecefToGeodetic(ecef, geodetic.data());
     return geodetic;
 }
 
@@ -121,7 +128,8 @@ Vector3 CoordinateTransform::ecefToNUEPosition(const Eigen::Vector3d& ecefPos, c
     return nuePos;
 }
 
-GeoPosition CoordinateTransform::updateGeoPositionEigen(const GeoPosition& pos, const Vector3& velocity, double dt) {
+GeoPosition CoordinateTransform::updateGeoPositionEigen(const GeoPosition& pos, const Vector3& velocity, double dt,
+                                                        GeodeticSolver solver) {
     // 1. 将当前位置转换为ECEF坐标
     Eigen::Vector3d ecefPos = geodeticToECEF(pos);
     
@@ -132,7 +140,7 @@ GeoPosition CoordinateTransform::updateGeoPositionEigen(const GeoPosition& pos,
     Eigen::Vector3d newEcefPos = ecefPos + ecefVel * dt;
     
     // 4. 将新的ECEF位置转换回地理坐标
-    return ecefToGeodetic(newEcefPos);
+    return ecefToGeodetic(newEcefPos, solver);
 }
 
 #endif // USE_EIGEN
@@ -1,4 +1,5 @@
 #include "EulerAngleCalculation.h"
+#include "SimdKernels.h"
 #include <algorithm>
 
 // 从速度向量计算基本姿态角
@@ -139,6 +140,78 @@ AttitudeAngles EulerAngleCalculator::limitAttitudeAngles(const AttitudeAngles& a
     return limited;
 }
 
+// 批量由速度推导姿态角
+void EulerAngleCalculator::calculateFromVelocityBatch(const double* velocityNorth, const double* velocityUp,
+                                                      const double* velocityEast, double* pitch, double* roll,
+                                                      double* yaw, std::size_t count) {
+    getSimdKernels().attitudeFromVelocity(velocityNorth, velocityUp, velocityEast, pitch, roll, yaw, count);
+}
+
+// 批量姿态角限制
+void EulerAngleCalculator::limitAttitudeAnglesBatch(double* pitch, double* roll, double* yaw, std::size_t count) {
+    getSimdKernels().limitAttitude(pitch, roll, yaw, count, MAX_PITCH_ANGLE, MAX_ROLL_ANGLE);
+}
+
+// 欧拉角 -> 四元数：q = q偏航 · q俯仰 · q滚转
+Quaternion EulerAngleCalculator::toQuaternion(const AttitudeAngles& attitude) {
+    double cr = cos(attitude.roll * 0.5), sr = sin(attitude.roll * 0.5);
+    double cp = cos(attitude.pitch * 0.5), sp = sin(attitude.pitch * 0.5);
+    double cy = cos(attitude.yaw * 0.5), sy = sin(attitude.yaw * 0.5);
+    return Quaternion(cr * cp * cy + sr * sp * sy,
+                      sr * cp * cy - cr * sp * sy,
+                      cr * sp * cy + sr * cp * sy,
+                      cr * cp * sy - sr * sp * cy);
+}
+
+// 四元数 -> 欧拉角；俯仰用 atan2(s, sqrt(1 - s²)) 代替 asin，s 因舍入略超 ±1 时也不产生NaN
+AttitudeAngles EulerAngleCalculator::fromQuaternion(const Quaternion& q) {
+    AttitudeAngles attitude;
+    double s = std::max(-1.0, std::min(1.0, 2.0 * (q.w * q.y - q.z * q.x)));
+    attitude.roll = atan2(2.0 * (q.w * q.x + q.y * q.z), 1.0 - 2.0 * (q.x * q.x + q.y * q.y));
+    attitude.pitch = atan2(s, sqrt(1.0 - s * s));
+    attitude.yaw = atan2(2.0 * (q.w * q.z + q.x * q.y), 1.0 - 2.0 * (q.y * q.y + q.z * q.z));
+    return attitude;
+}
+
+// 北-东-地系中的标准旋转矩阵，按北、上（= -地）、东重排行
+DirectionCosineMatrix EulerAngleCalculator::toDCM(const Quaternion& q) {
+    double xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    double xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    double wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+    DirectionCosineMatrix dcm = { {
+        { 1.0 - 2.0 * (yy + zz), 2.0 * (xy - wz), 2.0 * (xz + wy) },
+        { -2.0 * (xz - wy), -2.0 * (yz + wx), -(1.0 - 2.0 * (xx + yy)) },
+        { 2.0 * (xy + wz), 1.0 - 2.0 * (xx + zz), 2.0 * (yz - wx) },
+    } };
+    return dcm;
+}
+
+// 机体角速度积分：右乘旋转 exp(ω·dt/2)
+Quaternion EulerAngleCalculator::integrateBodyRates(const Quaternion& q, double rollRate, double pitchRate,
+                                                    double yawRate, double dt) {
+    double rate = sqrt(rollRate * rollRate + pitchRate * pitchRate + yawRate * yawRate);
+    double half = 0.5 * rate * dt;
+    if (std::abs(half) < 1e-12) {
+        return q.normalized();
+    }
+    double k = sin(half) / rate;
+    Quaternion delta(cos(half), rollRate * k, pitchRate * k, yawRate * k);
+    return (q * delta).normalized();
+}
+
+// 四元数批量换算为欧拉角
+void EulerAngleCalculator::quaternionToEulerBatch(const double* w, const double* x, const double* y,
+                                                  const double* z, double* pitch, double* roll, double* yaw,
+                                                  std::size_t count) {
+    getSimdKernels().quaternionToEuler(w, x, y, z, pitch, roll, yaw, count);
+}
+
+// 四元数批量换算为方向余弦矩阵
+void EulerAngleCalculator::quaternionToDCMBatch(const double* w, const double* x, const double* y,
+                                                const double* z, DirectionCosineMatrix* dcm, std::size_t count) {
+    getSimdKernels().quaternionToDCM(w, x, y, z, dcm, count);
+}
+
 // 姿态角微分（计算角速度）
 AttitudeAngles EulerAngleCalculator::calculateAngularVelocity(const AttitudeAngles& current, 
                                                           const AttitudeAngles& previous, 
@@ -3,6 +3,7 @@
 
 #include "AircraftModelLibrary.h"
 #include <cmath>
+#include <cstddef>
 
 // 欧拉角计算器：专门负责计算飞机的欧拉角（俯仰、滚转、偏航）
 class EulerAngleCalculator {
@@ -39,6 +40,29 @@ public:
     // 姿态角限制（防止过度旋转）
     static AttitudeAngles limitAttitudeAngles(const AttitudeAngles& attitude);
     
+    // 批量版本（字段数组，按当前SIMD级别分派）：向量级别的反正切使用 simd::atan2Fast，
+    // 与上面的逐个版本相差 < 3e-7 弧度；标量级别与逐个版本逐位一致。逐个版本保留为精确参考
+    static void calculateFromVelocityBatch(const double* velocityNorth, const double* velocityUp,
+                                           const double* velocityEast, double* pitch, double* roll,
+                                           double* yaw, std::size_t count);
+    static void limitAttitudeAnglesBatch(double* pitch, double* roll, double* yaw, std::size_t count);
+
+    // 欧拉角 <-> 四元数（偏航-俯仰-滚转顺序；俯仰为 ±90° 时滚转与偏航只能确定二者之和/差）
+    static Quaternion toQuaternion(const AttitudeAngles& attitude);
+    static AttitudeAngles fromQuaternion(const Quaternion& q);
+    // 四元数 -> 方向余弦矩阵（机体系 -> 北上东），只含乘加
+    static DirectionCosineMatrix toDCM(const Quaternion& q);
+
+    // 机体角速度积分：绕机体前、右、下轴以恒定角速度旋转 dt 秒（按旋转轴角精确复合），结果重新归一化
+    static Quaternion integrateBodyRates(const Quaternion& q, double rollRate, double pitchRate,
+                                         double yawRate, double dt);
+
+    // 四元数字段数组批量换算（按当前SIMD级别分派），供输出时一次处理整批姿态
+    static void quaternionToEulerBatch(const double* w, const double* x, const double* y, const double* z,
+                                       double* pitch, double* roll, double* yaw, std::size_t count);
+    static void quaternionToDCMBatch(const double* w, const double* x, const double* y, const double* z,
+                                     DirectionCosineMatrix* dcm, std::size_t count);
+    
     // 姿态角微分（计算角速度）
     static AttitudeAngles calculateAngularVelocity(const AttitudeAngles& current, 
                                                  const AttitudeAngles& previous, 
@@ -19,6 +19,8 @@ public:
         // ... 其它型号
     }
     Vector3 computeAcceleration() const override;
+    double getThrust() const override { return maxThrust; }
+    double getDragCoefficient() const override { return dragCoeff; }
 
 private:
 	double maxThrust;   // 最大推力 (牛顿)
@@ -0,0 +1,319 @@
+#include "FleetManeuverStage.h"
+#include "EulerAngleCalculation.h"
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+using namespace FleetManeuverStates;
+
+namespace {
+
+// 与 ConstantFlightModel 相同的控制增益
+const double SPEED_CONTROL_GAIN = 2.0;
+const double ALTITUDE_CONTROL_GAIN = 1.0;
+const double HEADING_CONTROL_GAIN = 1.0;
+
+// update 期间使用的机群字段指针；姿态经机群接口读写，以保留按需计算的过期标记
+struct FleetArrays {
+    AircraftFleet* fleet;
+    double* altitude;
+    double* velocityNorth;
+    double* velocityUp;
+    double* velocityEast;
+
+    Vector3 velocity(std::size_t i) const { return Vector3{ velocityNorth[i], velocityUp[i], velocityEast[i] }; }
+
+    AttitudeAngles attitude(std::size_t i) const { return fleet->getAttitude(i); }
+
+    void setAttitude(std::size_t i, const AttitudeAngles& a) const { fleet->setAttitude(i, a); }
+
+    // 水平速度按转角旋转（水平速度近似为零时不转）
+    // 以平方比较代替原模型中的 sqrt(...) > 1e-3
+    void rotateHorizontal(std::size_t i, double turnAngle) const {
+        double north = velocityNorth[i];
+        double east = velocityEast[i];
+        if (north * north + east * east > 1e-6) {
+            double cosTurn = std::cos(turnAngle);
+            double sinTurn = std::sin(turnAngle);
+            velocityNorth[i] = north * cosTurn - east * sinTurn;
+            velocityEast[i] = north * sinTurn + east * cosTurn;
+        }
+    }
+
+    // 姿态随速度方向推导，读取时才计算
+    void attitudeFromVelocity(std::size_t i) const { fleet->invalidateAttitude(i); }
+};
+
+// 各类型单步更新，公式与 ManeuverModel.cpp 中对应子类的 update 相同
+
+inline void updateState(SManeuver& m, const FleetArrays& f, double dt) {
+    const std::size_t i = m.slot;
+    m.totalTime += dt;
+    double phase = 2.0 * M_PI * m.totalTime / m.period;
+    double turnAngle = m.turnAmplitude * std::sin(phase) * dt;
+    if (m.climbing) {
+        double altitudePhase = 2.0 * M_PI * m.totalTime / m.altitudePeriod;
+        f.velocityUp[i] = m.climbRate * std::sin(altitudePhase);
+    }
+    f.rotateHorizontal(i, turnAngle);
+    f.attitudeFromVelocity(i);
+}
+
+inline void updateState(Loop& m, const FleetArrays& f, double dt) {
+    const std::size_t i = m.slot;
+    m.totalTime += dt;
+    f.velocityUp[i] += m.climbRate * dt;
+    f.setAttitude(i, EulerAngleCalculator::calculateLoopManeuverAttitude(f.velocity(i), m.climbRate, dt));
+}
+
+inline void updateState(Roll& m, const FleetArrays& f, double dt) {
+    const std::size_t i = m.slot;
+    m.totalTime += dt;
+    std::swap(f.velocityNorth[i], f.velocityEast[i]);
+    f.setAttitude(i, EulerAngleCalculator::calculateRollManeuverAttitude(f.velocity(i), m.rollRate, dt));
+}
+
+inline void updateState(SplitS& m, const FleetArrays& f, double dt) {
+    const std::size_t i = m.slot;
+    m.totalTime += dt;
+    if (!m.halfLoopDone) {
+        f.velocityUp[i] = m.climbRate;
+        if (f.altitude[i] > 1500.0 || m.totalTime > 3.0) {
+            m.halfLoopDone = true;
+        }
+    } else {
+        f.velocityUp[i] = -m.climbRate * 0.5;
+        f.rotateHorizontal(i, m.turnRate * dt);
+    }
+    f.attitudeFromVelocity(i);
+}
+
+inline void updateState(Immelmann& m, const FleetArrays& f, double dt) {
+    const std::size_t i = m.slot;
+    m.totalTime += dt;
+    AttitudeAngles attitude = f.attitude(i);
+    if (!m.halfLoopDone) {
+        attitude.pitch += m.pitchRate * dt;
+        f.velocityUp[i] = m.climbRate;
+        if (attitude.getPitchDegrees() >= 180.0) {
+            attitude.pitch = M_PI;
+            m.halfLoopDone = true;
+        }
+    } else {
+        attitude.roll += m.rollRate * dt;
+        f.velocityUp[i] = 0.0;
+        if (attitude.getRollDegrees() >= 180.0) {
+            attitude.roll = M_PI;
+        }
+    }
+    f.setAttitude(i, EulerAngleCalculator::limitAttitudeAngles(attitude));
+}
+
+inline void updateState(BarrelRoll& m, const FleetArrays& f, double dt) {
+    const std::size_t i = m.slot;
+    m.totalTime += dt;
+    AttitudeAngles attitude = f.attitude(i);
+    attitude.roll += m.rollRate * dt;
+    attitude.pitch += m.pitchRate * std::sin(m.totalTime) * dt;
+    f.setAttitude(i, EulerAngleCalculator::limitAttitudeAngles(attitude));
+}
+
+inline void updateState(EvasiveDive& m, const FleetArrays& f, double dt) {
+    const std::size_t i = m.slot;
+    m.totalTime += dt;
+    if (m.divePhase) {
+        f.velocityUp[i] = -m.climbRate * 2.0;
+        if (f.altitude[i] < 500.0 || m.totalTime > 3.0) {
+            m.divePhase = false;
+            m.turnPhase = true;
+        }
+    } else if (m.turnPhase) {
+        f.rotateHorizontal(i, m.turnRate * dt);
+        if (m.totalTime > 6.0) {
+            f.velocityUp[i] = 0.0;
+            m.turnPhase = false;
+        }
+    }
+    f.attitudeFromVelocity(i);
+}
+
+inline void updateState(LManeuver& m, const FleetArrays& f, double dt) {
+    const std::size_t i = m.slot;
+    m.totalTime += dt;
+    if (!m.turnPhase && m.totalTime > 2.0) {
+        m.turnPhase = true;
+    }
+    if (m.turnPhase) {
+        f.rotateHorizontal(i, m.turnRate * 2.0 * dt);
+    }
+    f.attitudeFromVelocity(i);
+}
+
+inline void updateState(ConstantFlight& m, const FleetArrays& f, double dt) {
+    const std::size_t i = m.slot;
+    m.totalTime += dt;
+    double currentSpeed = std::sqrt(f.velocityNorth[i] * f.velocityNorth[i] + f.velocityEast[i] * f.velocityEast[i]);
+    double speedError = m.targetSpeed - currentSpeed;
+    if (std::abs(speedError) > 1.0) {
+        double speedAdjustment = SPEED_CONTROL_GAIN * speedError * dt;
+        double currentHeading = std::atan2(f.velocityEast[i], f.velocityNorth[i]);
+        f.velocityNorth[i] += speedAdjustment * std::cos(currentHeading);
+        f.velocityEast[i] += speedAdjustment * std::sin(currentHeading);
+    }
+    double altitudeError = m.targetAltitude - f.altitude[i];
+    if (std::abs(altitudeError) > 10.0) {
+        f.velocityUp[i] = ALTITUDE_CONTROL_GAIN * altitudeError * dt;
+    } else {
+        f.velocityUp[i] = 0.0;
+    }
+    double currentHeading = std::atan2(f.velocityEast[i], f.velocityNorth[i]);
+    double headingError = m.targetHeading - currentHeading;
+    if (headingError > M_PI) headingError -= 2.0 * M_PI;
+    if (headingError < -M_PI) headingError += 2.0 * M_PI;
+    if (std::abs(headingError) > 0.1) {
+        double turnRate = HEADING_CONTROL_GAIN * headingError;
+        f.rotateHorizontal(i, turnRate * dt);
+    }
+    f.attitudeFromVelocity(i);
+}
+
+// 同一类型的紧凑循环：updateState 按静态类型重载解析，可在循环内联
+template<class State>
+void runPool(std::vector<State>& states, const FleetArrays& f, double dt) {
+    for (State& state : states) {
+        updateState(state, f, dt);
+    }
+}
+
+} // namespace
+
+template<class State>
+void FleetManeuverStage::append(std::size_t slot, ManeuverId id, const State& state) {
+    std::vector<State>& states = pool<State>();
+    locations[slot] = Location{ id, states.size() };
+    states.push_back(state);
+    ++assignedCount;
+}
+
+template<class State>
+void FleetManeuverStage::erase(std::size_t index) {
+    // 与末尾元素交换后删除，保持数组连续
+    std::vector<State>& states = pool<State>();
+    if (index + 1 != states.size()) {
+        states[index] = states.back();
+        locations[states[index].slot].index = index;
+    }
+    states.pop_back();
+    --assignedCount;
+}
+
+void FleetManeuverStage::assign(const AircraftFleet& fleet, std::size_t slot, ManeuverId id) {
+    assign(fleet, slot, id, ManeuverRegistry::getDefaults(id).toParameters());
+}
+
+void FleetManeuverStage::assign(const AircraftFleet& fleet, std::size_t slot, ManeuverId id,
+                                const ManeuverParameters& params) {
+    if (!ManeuverRegistry::isValid(id)) {
+        throw std::invalid_argument("FleetManeuverStage: invalid maneuver id");
+    }
+    if (slot >= fleet.size()) {
+        throw std::invalid_argument("FleetManeuverStage: slot " + std::to_string(slot) + " out of range");
+    }
+    if (locations.size() < fleet.size()) {
+        locations.resize(fleet.size(), Location{ ManeuverId::Count, 0 });
+    }
+    remove(slot);
+
+    const AircraftPerformance perf = fleet.getPerformance(slot);
+    switch (id) {
+    case ManeuverId::GeneralS:
+    case ManeuverId::AdvancedS:
+    case ManeuverId::Snake:
+        append(slot, id, SManeuver{ slot, 0.0, params.getActualTurnRate(perf) * params.amplitude,
+                                    params.getActualClimbRate(perf), params.period, params.altitudePeriod,
+                                    params.climbRate != 0.0 && params.altitudePeriod > 0.0 });
+        break;
+    case ManeuverId::Loop:
+        append(slot, id, Loop{ slot, 0.0, params.getActualClimbRate(perf) });
+        break;
+    case ManeuverId::Roll:
+        append(slot, id, Roll{ slot, 0.0, params.getActualRollRate(perf) });
+        break;
+    case ManeuverId::SplitS:
+        append(slot, id, SplitS{ slot, 0.0, params.getActualTurnRate(perf), params.getActualClimbRate(perf), false });
+        break;
+    case ManeuverId::Immelmann:
+        append(slot, id, Immelmann{ slot, 0.0, params.getActualClimbRate(perf), params.getActualRollRate(perf),
+                                    params.getActualPitchRate(perf), false });
+        break;
+    case ManeuverId::BarrelRoll:
+        append(slot, id, BarrelRoll{ slot, 0.0, params.getActualRollRate(perf), params.getActualPitchRate(perf) });
+        break;
+    case ManeuverId::EvasiveDive:
+        append(slot, id, EvasiveDive{ slot, 0.0, params.getActualClimbRate(perf), params.getActualTurnRate(perf),
+                                      true, false });
+        break;
+    case ManeuverId::LManeuver:
+        append(slot, id, LManeuver{ slot, 0.0, params.getActualTurnRate(perf), false });
+        break;
+    case ManeuverId::ConstantFlight:
+        append(slot, id, ConstantFlight{ slot, 0.0, 200.0, 1000.0, 0.0 });
+        break;
+    case ManeuverId::Count:
+        break;
+    }
+}
+
+void FleetManeuverStage::setConstantFlightTargets(std::size_t slot, double speed, double altitude, double heading) {
+    if (getManeuver(slot) != ManeuverId::ConstantFlight) {
+        throw std::invalid_argument("FleetManeuverStage: slot " + std::to_string(slot) + " is not a constant flight maneuver");
+    }
+    ConstantFlight& state = pool<ConstantFlight>()[locations[slot].index];
+    state.targetSpeed = speed;
+    state.targetAltitude = altitude;
+    state.targetHeading = heading;
+}
+
+void FleetManeuverStage::remove(std::size_t slot) {
+    if (slot >= locations.size()) return;
+    const Location location = locations[slot];
+    switch (location.id) {
+    case ManeuverId::GeneralS:
+    case ManeuverId::AdvancedS:
+    case ManeuverId::Snake:       erase<SManeuver>(location.index); break;
+    case ManeuverId::Loop:        erase<Loop>(location.index); break;
+    case ManeuverId::Roll:        erase<Roll>(location.index); break;
+    case ManeuverId::SplitS:      erase<SplitS>(location.index); break;
+    case ManeuverId::Immelmann:   erase<Immelmann>(location.index); break;
+    case ManeuverId::BarrelRoll:  erase<BarrelRoll>(location.index); break;
+    case ManeuverId::EvasiveDive: erase<EvasiveDive>(location.index); break;
+    case ManeuverId::LManeuver:   erase<LManeuver>(location.index); break;
+    case ManeuverId::ConstantFlight: erase<ConstantFlight>(location.index); break;
+    case ManeuverId::Count:       return;
+    }
+    locations[slot] = Location{ ManeuverId::Count, 0 };
+}
+
+void FleetManeuverStage::clear() {
+    std::apply([](auto&... states) { (states.clear(), ...); }, pools);
+    locations.clear();
+    assignedCount = 0;
+}
+
+ManeuverId FleetManeuverStage::getManeuver(std::size_t slot) const {
+    return slot < locations.size() ? locations[slot].id : ManeuverId::Count;
+}
+
+void FleetManeuverStage::update(AircraftFleet& fleet, double dt) {
+    if (locations.size() > fleet.size()) {
+        throw std::invalid_argument("FleetManeuverStage: fleet has fewer slots than assigned maneuvers");
+    }
+    // 只有分裂S、规避俯冲与定常飞行读取高度；ECEF 模式下按需取高度可避免每步换算经纬高
+    bool needsAltitude = !pool<FleetManeuverStates::SplitS>().empty() ||
+                         !pool<FleetManeuverStates::EvasiveDive>().empty() ||
+                         !pool<FleetManeuverStates::ConstantFlight>().empty();
+    const FleetArrays f = { &fleet, needsAltitude ? fleet.altitudeData() : nullptr,
+                            fleet.velocityNorthData(), fleet.velocityUpData(), fleet.velocityEastData() };
+    std::apply([&](auto&... states) { (runPool(states, f, dt), ...); }, pools);
+}
@@ -0,0 +1,141 @@
+#ifndef FLEET_MANEUVER_STAGE_H
+#define FLEET_MANEUVER_STAGE_H
+
+#include "AircraftFleet.h"
+#include "ManeuverModel.h"
+#include "ManeuverRegistry.h"
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+// 各机动类型的逐机状态，按类型分别连续存储
+// 实际速率（参数比例 × 性能上限）在分配机动时一次算好，逐步更新不再读取 AircraftPerformance
+namespace FleetManeuverStates {
+
+// S型机动（"s" / "s_advanced" / "snake" 共用，对应 GeneralSManeuverModel）
+struct SManeuver {
+    std::size_t slot;
+    double totalTime;
+    double turnAmplitude;    // 实际转向速率 × 振幅
+    double climbRate;        // 实际爬升速率
+    double period;
+    double altitudePeriod;
+    bool climbing;           // 是否有高度周期变化
+};
+
+struct Loop {
+    std::size_t slot;
+    double totalTime;
+    double climbRate;
+};
+
+struct Roll {
+    std::size_t slot;
+    double totalTime;
+    double rollRate;
+};
+
+struct SplitS {
+    std::size_t slot;
+    double totalTime;
+    double turnRate;
+    double climbRate;
+    bool halfLoopDone;
+};
+
+struct Immelmann {
+    std::size_t slot;
+    double totalTime;
+    double climbRate;
+    double rollRate;
+    double pitchRate;
+    bool halfLoopDone;
+};
+
+struct BarrelRoll {
+    std::size_t slot;
+    double totalTime;
+    double rollRate;
+    double pitchRate;
+};
+
+struct EvasiveDive {
+    std::size_t slot;
+    double totalTime;
+    double climbRate;
+    double turnRate;
+    bool divePhase;
+    bool turnPhase;
+};
+
+struct LManeuver {
+    std::size_t slot;
+    double totalTime;
+    double turnRate;
+    bool turnPhase;
+};
+
+struct ConstantFlight {
+    std::size_t slot;
+    double totalTime;
+    double targetSpeed;
+    double targetAltitude;
+    double targetHeading;
+};
+
+} // namespace FleetManeuverStates
+
+// 机群级机动阶段：与 AircraftFleet 配合，替代逐机 shared_ptr<ManeuverModel> 的虚函数调用。
+// 每种机动类型的状态放在各自的连续数组中，update 按类型逐组执行可内联的紧凑循环，
+// 计算公式与对应 ManeuverModel 子类相同（结果逐位一致）。
+class FleetManeuverStage {
+public:
+    FleetManeuverStage() = default;
+
+    // 为槽位分配机动（替换该槽位已有机动），实际速率按槽位当前性能参数计算；
+    // 之后修改该槽位性能参数需重新分配。id 无效或槽位越界时抛出 std::invalid_argument
+    void assign(const AircraftFleet& fleet, std::size_t slot, ManeuverId id, const ManeuverParameters& params);
+    void assign(const AircraftFleet& fleet, std::size_t slot, ManeuverId id);   // 使用注册表默认参数
+
+    // 定速定高机动的目标值（默认与 ConstantFlightModel 一致）；槽位不是定速定高机动时抛出 std::invalid_argument
+    void setConstantFlightTargets(std::size_t slot, double speed, double altitude, double heading);
+
+    void remove(std::size_t slot);
+    void clear();
+
+    // 槽位当前机动，未分配时返回 ManeuverId::Count
+    ManeuverId getManeuver(std::size_t slot) const;
+    std::size_t size() const { return assignedCount; }
+
+    // 推进所有已分配机动一个时间步（只修改速度与姿态，运动学仍由 AircraftFleet::stepKinematics 完成）
+    void update(AircraftFleet& fleet, double dt);
+
+private:
+    struct Location {
+        ManeuverId id;
+        std::size_t index;   // 在对应类型数组中的下标
+    };
+
+    template<class State>
+    std::vector<State>& pool() { return std::get<std::vector<State>>(pools); }
+
+    template<class State>
+    void append(std::size_t slot, ManeuverId id, const State& state);
+
+    template<class State>
+    void erase(std::size_t index);
+
+    std::vector<Location> locations;   // 按槽位索引
+    std::size_t assignedCount = 0;
+    std::tuple<std::vector<FleetManeuverStates::SManeuver>,
+               std::vector<FleetManeuverStates::Loop>,
+               std::vector<FleetManeuverStates::Roll>,
+               std::vector<FleetManeuverStates::SplitS>,
+               std::vector<FleetManeuverStates::Immelmann>,
+               std::vector<FleetManeuverStates::BarrelRoll>,
+               std::vector<FleetManeuverStates::EvasiveDive>,
+               std::vector<FleetManeuverStates::LManeuver>,
+               std::vector<FleetManeuverStates::ConstantFlight>> pools;
+};
+
+#endif // FLEET_MANEUVER_STAGE_H
@@ -0,0 +1,237 @@
+#include "FleetSpatialIndex.h"
+#include "ImprovedCoordinateTransform.h"
+#include "LocalTangentFrame.h"
+#include "SimdKernels.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+// WGS84 最小曲率半径（赤道处子午圈）a(1 - e²)
+const double MIN_CURVATURE_RADIUS = 6335439.327;
+// 粗筛半径的相对与绝对余量：覆盖高度差与曲率的二阶项及 Vincenty 公式自身的误差
+const double CHORD_MARGIN = 1.001;
+const double CHORD_SLACK = 1e-3;
+const std::size_t NO_SLOT = std::numeric_limits<std::size_t>::max();
+
+bool closer(const SpatialNeighbor& a, const SpatialNeighbor& b) {
+    return a.distance < b.distance || (a.distance == b.distance && a.slot < b.slot);
+}
+
+void checkRadius(double radius) {
+    if (!(radius >= 0.0)) {
+        throw std::invalid_argument("FleetSpatialIndex: radius must be non-negative");
+    }
+}
+
+} // namespace
+
+FleetSpatialIndex::FleetSpatialIndex(double cellSize)
+    : cellSize(cellSize), inverseCellSize(1.0 / cellSize) {
+    if (!(cellSize > 0.0) || !std::isfinite(cellSize)) {
+        throw std::invalid_argument("FleetSpatialIndex: cellSize must be positive");
+    }
+}
+
+double FleetSpatialIndex::distance(const GeoPosition& a, const GeoPosition& b) {
+    return std::hypot(ImprovedCoordinateTransform::calculateDistanceImproved(a, b), a.altitude - b.altitude);
+}
+
+double FleetSpatialIndex::chordScaleFor(double altitude) const {
+    return (1.0 + std::max({ maxAltitude, altitude, 0.0 }) / MIN_CURVATURE_RADIUS) * CHORD_MARGIN;
+}
+
+std::uint32_t FleetSpatialIndex::bucketOf(std::int64_t ix, std::int64_t iy, std::int64_t iz) const {
+    // Teschner 空间哈希：三个大素数相乘后异或，再折叠高位
+    std::uint64_t h = (static_cast<std::uint64_t>(ix) * 73856093u) ^ (static_cast<std::uint64_t>(iy) * 19349663u) ^
+                      (static_cast<std::uint64_t>(iz) * 83492791u);
+    h ^= h >> 17;
+    return static_cast<std::uint32_t>(h & bucketMask);
+}
+
+void FleetSpatialIndex::rebuild(const AircraftFleet& fleet) {
+    const std::size_t n = fleet.size();
+    const double* latitude = fleet.latitudeData();
+    const double* longitude = fleet.longitudeData();
+    const double* altitude = fleet.altitudeData();
+    positions.resize(n);
+    ecef.resize(3 * n);
+    maxAltitude = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        positions[i] = { longitude[i], latitude[i], altitude[i] };
+        maxAltitude = std::max(maxAltitude, altitude[i]);
+    }
+    if (fleet.getKinematicsFrame() == KinematicsFrame::ECEF) {
+        const double* x = fleet.ecefXData();
+        const double* y = fleet.ecefYData();
+        const double* z = fleet.ecefZData();
+        for (std::size_t i = 0; i < n; ++i) {
+            ecef[3 * i] = x[i];
+            ecef[3 * i + 1] = y[i];
+            ecef[3 * i + 2] = z[i];
+        }
+    } else {
+        getSimdKernels().geodeticToECEF(positions.data(), ecef.data(), n);
+    }
+
+    // 桶数取不小于 2N 的2的幂，平均每桶不到一个条目
+    std::uint32_t buckets = 64;
+    while (buckets < 2 * n) buckets <<= 1;
+    bucketMask = buckets - 1;
+
+    // 计数排序：先统计每桶条目数，前缀和得到起点，再按桶写入
+    bucketStart.assign(static_cast<std::size_t>(buckets) + 1, 0);
+    bucketScratch.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double* p = &ecef[3 * i];
+        std::uint32_t key = bucketOf(static_cast<std::int64_t>(std::floor(p[0] * inverseCellSize)),
+                                     static_cast<std::int64_t>(std::floor(p[1] * inverseCellSize)),
+                                     static_cast<std::int64_t>(std::floor(p[2] * inverseCellSize)));
+        bucketScratch[i] = key;
+        ++bucketStart[key + 1];
+    }
+    for (std::uint32_t b = 0; b < buckets; ++b) {
+        bucketStart[b + 1] += bucketStart[b];
+    }
+    entrySlot.resize(n);
+    entryX.resize(n);
+    entryY.resize(n);
+    entryZ.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        std::uint32_t e = bucketStart[bucketScratch[i]]++;
+        entrySlot[e] = static_cast<std::uint32_t>(i);
+        entryX[e] = ecef[3 * i];
+        entryY[e] = ecef[3 * i + 1];
+        entryZ[e] = ecef[3 * i + 2];
+    }
+    // 写入时起点已被推到下一桶的起点，整体右移一位复原
+    for (std::uint32_t b = buckets; b > 0; --b) {
+        bucketStart[b] = bucketStart[b - 1];
+    }
+    bucketStart[0] = 0;
+}
+
+template<class Visit>
+void FleetSpatialIndex::forEachCandidate(const double* point, double chordRadius, Visit visit) const {
+    if (entrySlot.empty()) return;
+    const double r2 = chordRadius * chordRadius;
+    auto test = [&](std::uint32_t e) {
+        double dx = entryX[e] - point[0];
+        double dy = entryY[e] - point[1];
+        double dz = entryZ[e] - point[2];
+        if (dx * dx + dy * dy + dz * dz <= r2) visit(e);
+    };
+
+    double low[3], high[3];
+    double cells = 1.0;
+    for (int axis = 0; axis < 3; ++axis) {
+        low[axis] = std::floor((point[axis] - chordRadius) * inverseCellSize);
+        high[axis] = std::floor((point[axis] + chordRadius) * inverseCellSize);
+        cells *= high[axis] - low[axis] + 1.0;
+    }
+    // 覆盖的网格数超过桶数时逐桶收集反而更慢，直接扫描全部条目
+    if (!(cells <= static_cast<double>(bucketMask) + 1.0)) {
+        for (std::uint32_t e = 0; e < entrySlot.size(); ++e) test(e);
+        return;
+    }
+
+    bucketScratch.clear();
+    for (auto ix = static_cast<std::int64_t>(low[0]); ix <= static_cast<std::int64_t>(high[0]); ++ix) {
+        for (auto iy = static_cast<std::int64_t>(low[1]); iy <= static_cast<std::int64_t>(high[1]); ++iy) {
+            for (auto iz = static_cast<std::int64_t>(low[2]); iz <= static_cast<std::int64_t>(high[2]); ++iz) {
+                bucketScratch.push_back(bucketOf(ix, iy, iz));
+            }
+        }
+    }
+    // 不同网格可能哈希到同一桶，去重避免重复访问
+    std::sort(bucketScratch.begin(), bucketScratch.end());
+    bucketScratch.erase(std::unique(bucketScratch.begin(), bucketScratch.end()), bucketScratch.end());
+    for (std::uint32_t b : bucketScratch) {
+        for (std::uint32_t e = bucketStart[b]; e < bucketStart[b + 1]; ++e) test(e);
+    }
+}
+
+void FleetSpatialIndex::queryRadius(const GeoPosition& center, double radius, std::vector<SpatialNeighbor>& result) const {
+    Vector3 p = LocalTangentFrame::geodeticToECEF(center);
+    const double point[3] = { p.north, p.up, p.east };
+    queryRadius(center, point, NO_SLOT, radius, result);
+}
+
+void FleetSpatialIndex::queryRadius(std::size_t slot, double radius, std::vector<SpatialNeighbor>& result) const {
+    if (slot >= positions.size()) {
+        throw std::invalid_argument("FleetSpatialIndex: slot " + std::to_string(slot) + " out of range");
+    }
+    queryRadius(positions[slot], &ecef[3 * slot], slot, radius, result);
+}
+
+void FleetSpatialIndex::queryRadius(const GeoPosition& center, const double* point, std::size_t exclude,
+                                    double radius, std::vector<SpatialNeighbor>& result) const {
+    checkRadius(radius);
+    result.clear();
+    forEachCandidate(point, radius * chordScaleFor(center.altitude) + CHORD_SLACK, [&](std::uint32_t e) {
+        std::size_t slot = entrySlot[e];
+        if (slot == exclude) return;
+        double d = distance(positions[slot], center);
+        if (d <= radius) result.push_back({ slot, d });
+    });
+    std::sort(result.begin(), result.end(), closer);
+}
+
+void FleetSpatialIndex::queryNearest(const GeoPosition& center, std::size_t k, std::vector<SpatialNeighbor>& result) const {
+    Vector3 p = LocalTangentFrame::geodeticToECEF(center);
+    const double point[3] = { p.north, p.up, p.east };
+    queryNearest(center, point, NO_SLOT, k, result);
+}
+
+void FleetSpatialIndex::queryNearest(std::size_t slot, std::size_t k, std::vector<SpatialNeighbor>& result) const {
+    if (slot >= positions.size()) {
+        throw std::invalid_argument("FleetSpatialIndex: slot " + std::to_string(slot) + " out of range");
+    }
+    queryNearest(positions[slot], &ecef[3 * slot], slot, k, result);
+}
+
+void FleetSpatialIndex::queryNearest(const GeoPosition& center, const double* point, std::size_t exclude,
+                                     std::size_t k, std::vector<SpatialNeighbor>& result) const {
+    result.clear();
+    const std::size_t available = positions.size() - (exclude < positions.size() ? 1 : 0);
+    if (k == 0 || available == 0) return;
+    k = std::min(k, available);
+
+    // 直线距离超过 reach 的飞机精确距离一定超过 reach / scale；
+    // 第k近的精确距离不超过该值时，范围外不可能有更近的飞机
+    const double scale = chordScaleFor(center.altitude);
+    for (double reach = cellSize;; reach *= 2.0) {
+        result.clear();
+        forEachCandidate(point, reach, [&](std::uint32_t e) {
+            std::size_t slot = entrySlot[e];
+            if (slot != exclude) result.push_back({ slot, distance(positions[slot], center) });
+        });
+        if (result.size() < k) continue;
+        std::nth_element(result.begin(), result.begin() + (k - 1), result.end(), closer);
+        if (result[k - 1].distance * scale <= reach || result.size() == available) break;
+    }
+    std::sort(result.begin(), result.begin() + k, closer);
+    result.resize(k);
+}
+
+void FleetSpatialIndex::findPairs(double radius, std::vector<ProximityPair>& pairs) const {
+    checkRadius(radius);
+    pairs.clear();
+    const double chordRadius = radius * chordScaleFor(0.0) + CHORD_SLACK;
+    // 按条目顺序遍历：相邻条目多在同一桶内，访问的桶与坐标在缓存中
+    for (std::size_t entry = 0; entry < entrySlot.size(); ++entry) {
+        const std::size_t i = entrySlot[entry];
+        forEachCandidate(&ecef[3 * i], chordRadius, [&](std::uint32_t e) {
+            std::size_t j = entrySlot[e];
+            if (j <= i) return;
+            double d = distance(positions[i], positions[j]);
+            if (d <= radius) pairs.push_back({ i, j, d });
+        });
+    }
+    std::sort(pairs.begin(), pairs.end(), [](const ProximityPair& a, const ProximityPair& b) {
+        return a.first < b.first || (a.first == b.first && a.second < b.second);
+    });
+}
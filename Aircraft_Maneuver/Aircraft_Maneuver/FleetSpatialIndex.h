@@ -0,0 +1,83 @@
+#ifndef FLEET_SPATIAL_INDEX_H
+#define FLEET_SPATIAL_INDEX_H
+
+#include "AircraftFleet.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// 邻近查询结果：槽位与精确距离（米）
+struct SpatialNeighbor {
+    std::size_t slot;
+    double distance;
+};
+
+// 邻近飞机对（first < second）
+struct ProximityPair {
+    std::size_t first;
+    std::size_t second;
+    double distance;
+};
+
+// 机群空间索引：机群ECEF位置上的均匀三维哈希网格，每步 rebuild 一次（两遍计数排序，O(N)）。
+// 查询按网格收集候选并用ECEF直线距离粗筛，只对剩下的候选计算精确距离：
+// 椭球面测地距离（Vincenty，ImprovedCoordinateTransform::calculateDistanceImproved）与高度差的合成。
+// 直线距离不超过精确距离的 (1 + hmax/ρ) 倍（hmax 为机群最大高度，ρ 为最小子午圈曲率半径），
+// 粗筛半径按此放大，因此结果与逐对精确计算完全相同。
+// 网格边长宜取常用查询半径附近；rebuild 之后机群位置的变化要到下次 rebuild 才反映到查询中。
+// 查询共用内部缓冲，同一索引不能被多个线程同时查询。
+class FleetSpatialIndex {
+public:
+    // cellSize：网格边长（米），必须为正，否则抛出 std::invalid_argument；查询半径为负或槽位越界同样抛出
+    explicit FleetSpatialIndex(double cellSize = 10000.0);
+
+    void rebuild(const AircraftFleet& fleet);
+
+    std::size_t size() const { return positions.size(); }
+    double getCellSize() const { return cellSize; }
+    const GeoPosition& getPosition(std::size_t slot) const { return positions[slot]; }
+
+    // 半径查询：精确距离 <= radius 的槽位，按距离升序写入 result（先清空）；按槽位查询时不含该槽位自身
+    void queryRadius(const GeoPosition& center, double radius, std::vector<SpatialNeighbor>& result) const;
+    void queryRadius(std::size_t slot, double radius, std::vector<SpatialNeighbor>& result) const;
+
+    // k近邻查询：精确距离最小的k个槽位（不足k个时返回全部），按距离升序；
+    // 搜索半径从网格边长起逐次加倍，直到第k近的精确距离落在已搜索范围内
+    void queryNearest(const GeoPosition& center, std::size_t k, std::vector<SpatialNeighbor>& result) const;
+    void queryNearest(std::size_t slot, std::size_t k, std::vector<SpatialNeighbor>& result) const;
+
+    // 全机群邻近对（冲突检测）：精确距离 <= radius 的全部槽位对，按 (first, second) 升序
+    void findPairs(double radius, std::vector<ProximityPair>& pairs) const;
+
+    // 精确距离（米）：sqrt(测地距离² + 高度差²)
+    static double distance(const GeoPosition& a, const GeoPosition& b);
+
+private:
+    // 对ECEF点 (x, y, z) 直线距离 <= chordRadius 的每个条目调用 visit(条目下标)
+    template<class Visit>
+    void forEachCandidate(const double* point, double chordRadius, Visit visit) const;
+    std::uint32_t bucketOf(std::int64_t ix, std::int64_t iy, std::int64_t iz) const;
+    double chordScaleFor(double altitude) const;
+    void queryRadius(const GeoPosition& center, const double* point, std::size_t exclude, double radius,
+                     std::vector<SpatialNeighbor>& result) const;
+    void queryNearest(const GeoPosition& center, const double* point, std::size_t exclude, std::size_t k,
+                      std::vector<SpatialNeighbor>& result) const;
+
+    double cellSize;
+    double inverseCellSize;
+    double maxAltitude = 0.0;
+    std::uint32_t bucketMask = 0;
+
+    // 按槽位：大地坐标与ECEF（x,y,z 交错）
+    std::vector<GeoPosition> positions;
+    std::vector<double> ecef;
+    // 按桶排序的条目：bucketStart[b]..bucketStart[b+1] 为桶 b 的条目，条目坐标连续存放便于粗筛
+    std::vector<std::uint32_t> bucketStart;
+    std::vector<std::uint32_t> entrySlot;
+    std::vector<double> entryX;
+    std::vector<double> entryY;
+    std::vector<double> entryZ;
+    mutable std::vector<std::uint32_t> bucketScratch;
+};
+
+#endif // FLEET_SPATIAL_INDEX_H
@@ -0,0 +1,175 @@
+#include "GeodeticSolvers.h"
+#include <cmath>
+
+const double GeodeticSolvers::WGS84_A = 6378137.0;
+const double GeodeticSolvers::WGS84_E2 = 0.006694379990141316;
+
+namespace {
+
+const double PI = 3.14159265358979323846;
+const double RAD_TO_DEG = 180.0 / PI;
+
+// 由纬度的正弦、余弦（未归一化亦可）计算大地高：h = p·cosφ + z·sinφ - a·sqrt(1 - e2·sin²φ)
+// 不含 p/cosφ，在极点附近仍然稳定
+double heightFromLatitude(double p, double z, double sinLat, double cosLat) {
+    double norm = std::sqrt(sinLat * sinLat + cosLat * cosLat);
+    sinLat /= norm;
+    cosLat /= norm;
+    return p * cosLat + z * sinLat
+         - GeodeticSolvers::WGS84_A * std::sqrt(1.0 - GeodeticSolvers::WGS84_E2 * sinLat * sinLat);
+}
+
+} // namespace
+
+GeoPosition GeodeticSolvers::solve(double x, double y, double z, GeodeticSolver solver) {
+    switch (solver) {
+    case GeodeticSolver::Bowring: return bowring(x, y, z);
+    case GeodeticSolver::Olson: return olson(x, y, z);
+    case GeodeticSolver::Vermeille: return vermeille(x, y, z);
+    default: return iterative(x, y, z);
+    }
+}
+
+GeoPosition GeodeticSolvers::iterative(double x, double y, double z) {
+    const double a = WGS84_A;
+    const double e2 = WGS84_E2;
+
+    double p = std::sqrt(x * x + y * y);
+    double lat = std::atan2(z, p * (1 - e2));
+
+    // 迭代求解纬度
+    for (int i = 0; i < 5; ++i) {
+        double N = a / std::sqrt(1 - e2 * std::sin(lat) * std::sin(lat));
+        double h = p / std::cos(lat) - N;
+        double lat_new = std::atan2(z, p * (1 - e2 * N / (N + h)));
+        if (std::abs(lat - lat_new) < 1e-12) break;
+        lat = lat_new;
+    }
+
+    double lon = std::atan2(y, x);
+    double N = a / std::sqrt(1 - e2 * std::sin(lat) * std::sin(lat));
+    double h = p / std::cos(lat) - N;
+
+    GeoPosition geodetic;
+    geodetic.latitude = lat * 180.0 / PI;
+    geodetic.longitude = lon * 180.0 / PI;
+    geodetic.altitude = h;
+    return geodetic;
+}
+
+GeoPosition GeodeticSolvers::bowring(double x, double y, double z) {
+    const double a = WGS84_A;
+    const double e2 = WGS84_E2;
+    const double b = a * std::sqrt(1.0 - e2);       // 短半轴
+    const double ep2 = e2 / (1.0 - e2);             // 第二偏心率平方
+
+    double p = std::sqrt(x * x + y * y);
+
+    // 归化纬度 β 的初值 tanβ = a·z / (b·p)；正余弦由向量归一化得到，不调用三角函数
+    double sinBeta = a * z;
+    double cosBeta = b * p;
+    double num = 0.0, den = 0.0;
+    for (int step = 0; step < 2; ++step) {   // Bowring 单步 + 一次修正
+        double r = std::sqrt(sinBeta * sinBeta + cosBeta * cosBeta);
+        double s = sinBeta / r;
+        double c = cosBeta / r;
+        num = z + ep2 * b * s * s * s;
+        den = p - e2 * a * c * c * c;
+        // 由 tanφ = num/den 更新 tanβ = (b/a)·tanφ
+        sinBeta = b * num;
+        cosBeta = a * den;
+    }
+
+    GeoPosition geodetic;
+    geodetic.latitude = std::atan2(num, den) * RAD_TO_DEG;
+    geodetic.longitude = std::atan2(y, x) * RAD_TO_DEG;
+    geodetic.altitude = heightFromLatitude(p, z, num, den);
+    return geodetic;
+}
+
+GeoPosition GeodeticSolvers::olson(double x, double y, double z) {
+    // Olson (1996) 系数
+    const double a = WGS84_A;
+    const double e2 = WGS84_E2;
+    const double a1 = a * e2;
+    const double a2 = a1 * a1;
+    const double a3 = a1 * e2 / 2.0;
+    const double a4 = 2.5 * a2;
+    const double a5 = a1 + a3;
+    const double a6 = 1.0 - e2;
+
+    double zp = std::abs(z);
+    double w2 = x * x + y * y;
+    double w = std::sqrt(w2);
+    double r2 = w2 + z * z;
+    double r = std::sqrt(r2);
+    double s2 = z * z / r2;
+    double c2 = w2 / r2;
+    double u = a2 / r;
+    double v = a3 - a4 / r;
+
+    // 纬度近似值：低纬度用 asin，高纬度用 acos，避免各自的病态区间
+    double s, c, ss, lat;
+    if (c2 > 0.3) {
+        s = (zp / r) * (1.0 + c2 * (a1 + u + s2 * v) / r);
+        lat = std::asin(s);
+        ss = s * s;
+        c = std::sqrt(1.0 - ss);
+    } else {
+        c = (w / r) * (1.0 - s2 * (a5 - u - c2 * v) / r);
+        lat = std::acos(c);
+        ss = 1.0 - c * c;
+        s = std::sqrt(ss);
+    }
+
+    // 一次牛顿修正
+    double g = 1.0 - e2 * ss;
+    double rg = a / std::sqrt(g);
+    double rf = a6 * rg;
+    u = w - rg * c;
+    v = zp - rf * s;
+    double f = c * u + s * v;
+    double m = c * v - s * u;
+    double dLat = m / (rf / g + f);
+    lat += dLat;
+
+    GeoPosition geodetic;
+    geodetic.latitude = (z < 0 ? -lat : lat) * RAD_TO_DEG;
+    geodetic.longitude = std::atan2(y, x) * RAD_TO_DEG;
+    geodetic.altitude = f + m * dLat / 2.0;
+    return geodetic;
+}
+
+GeoPosition GeodeticSolvers::vermeille(double x, double y, double z) {
+    const double a = WGS84_A;
+    const double e2 = WGS84_E2;
+    const double e4 = e2 * e2;
+
+    double w2 = x * x + y * y;
+    double p = w2 / (a * a);
+    double q = (1.0 - e2) / (a * a) * z * z;
+    double r = (p + q - e4) / 6.0;
+    double s = e4 * p * q / (4.0 * r * r * r);
+    double t = std::cbrt(1.0 + s + std::sqrt(s * (2.0 + s)));
+    double u = r * (1.0 + t + 1.0 / t);
+    double v = std::sqrt(u * u + e4 * q);
+    double w = e2 * (u + v - q) / (2.0 * v);
+    double k = std::sqrt(u + v + w * w) - w;
+    double D = k * std::sqrt(w2) / (k + e2);
+    double dz = std::sqrt(D * D + z * z);
+
+    GeoPosition geodetic;
+    geodetic.latitude = 2.0 * std::atan2(z, D + dz) * RAD_TO_DEG;
+    geodetic.longitude = std::atan2(y, x) * RAD_TO_DEG;
+    geodetic.altitude = (k + e2 - 1.0) / k * dz;
+    return geodetic;
+}
+
+const char* GeodeticSolvers::getName(GeodeticSolver solver) {
+    switch (solver) {
+    case GeodeticSolver::Bowring: return "Bowring";
+    case GeodeticSolver::Olson: return "Olson";
+    case GeodeticSolver::Vermeille: return "Vermeille";
+    default: return "Iterative";
+    }
+}
@@ -0,0 +1,36 @@
+#ifndef GEODETIC_SOLVERS_H
+#define GEODETIC_SOLVERS_H
+
+#include "AircraftModelLibrary.h"
+
+// ECEF -> 大地坐标（WGS84）求解算法
+// 最大误差为高度 -1km ~ 100km、全球经纬度范围内相对高精度参考解的统计值
+// （纬度误差折算为地面距离，见 tests/test_geodetic_solvers.cpp）
+enum class GeodeticSolver {
+    Iterative,  // 纬度不动点迭代（最多5次，原 ecefToGeodetic 算法）：纬度 1e-5 米，高度 5e-4 米
+                // （|纬度| <= 89.5°；两极处高度公式 p/cosφ 退化，结果不可用）
+    Bowring,    // Bowring 单步公式 + 一次修正，只用开方和除法：纬度、高度误差 < 5e-9 米
+    Olson,      // Olson 级数近似 + 一次牛顿修正（一次 asin/acos）：纬度、高度误差 < 5e-9 米
+    Vermeille   // Vermeille 闭式解（四次方程解析解，一次 cbrt）：纬度、高度误差 < 5e-9 米
+};
+
+// 各求解器的实现（纯标量，不依赖Eigen）
+class GeodeticSolvers {
+public:
+    // WGS84椭球参数
+    static const double WGS84_A;   // 长半轴 (米)
+    static const double WGS84_E2;  // 第一偏心率平方
+
+    // 按指定算法求解
+    static GeoPosition solve(double x, double y, double z, GeodeticSolver solver);
+
+    static GeoPosition iterative(double x, double y, double z);
+    static GeoPosition bowring(double x, double y, double z);
+    static GeoPosition olson(double x, double y, double z);
+    static GeoPosition vermeille(double x, double y, double z);
+
+    // 算法名称（用于输出）
+    static const char* getName(GeodeticSolver solver);
+};
+
+#endif // GEODETIC_SOLVERS_H
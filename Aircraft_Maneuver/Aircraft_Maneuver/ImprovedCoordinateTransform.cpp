@@ -1,5 +1,10 @@
 #include "ImprovedCoordinateTransform.h"
+#include "ParallelFor.h"
+#include "SimdKernels.h"
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <vector>
 
 // 静态常量定义
 const double ImprovedCoordinateTransform::EARTH_RADIUS_EQUATOR = 6378137.0;
@@ -7,6 +12,89 @@ const double ImprovedCoordinateTransform::EARTH_RADIUS_POLAR = 6356752.314245;
 const double ImprovedCoordinateTransform::EARTH_FLATTENING = 1.0 / 298.257223563;
 const double ImprovedCoordinateTransform::EARTH_ECCENTRICITY_SQ = 0.006694379990141316;
 const double ImprovedCoordinateTransform::PI = 3.14159265358979323846;
+const std::size_t ImprovedCoordinateTransform::DISTANCE_MATRIX_PARALLEL_THRESHOLD = 16384;
+// 0.25°节点的Hermite余项实测最大约 7.8e-14，留出舍入余量
+const double ImprovedCoordinateTransform::CURVATURE_TABLE_RELATIVE_ERROR = 1e-13;
+
+namespace {
+
+std::atomic<int> curvatureEvaluation{ static_cast<int>(CurvatureEvaluation::Exact) };
+
+// 纬度表节点间隔（度），0~90° 共 360 段
+const double CURVATURE_TABLE_STEP = 0.25;
+const int CURVATURE_TABLE_SEGMENTS = 360;
+
+// 一段上的三次多项式 c0 + c1·t + c2·t² + c3·t³，t ∈ [0, 1]
+struct CubicSegment {
+    double c0, c1, c2, c3;
+    double operator()(double t) const { return c0 + t * (c1 + t * (c2 + t * c3)); }
+};
+
+struct CurvatureSegment {
+    CubicSegment meridian;
+    CubicSegment primeVertical;
+    CubicSegment mean;
+};
+
+// 由两端的值与导数（已乘段长）得到Hermite插值多项式
+CubicSegment hermite(double f0, double m0, double f1, double m1) {
+    return { f0, m0, 3 * (f1 - f0) - 2 * m0 - m1, 2 * (f0 - f1) + m0 + m1 };
+}
+
+// 首次使用时生成；半径及其对纬度的导数用 w = 1 - e²sin²φ 的解析式计算：
+// N = a·w^(-1/2)，M = a(1-e²)·w^(-3/2)，R = √(MN) = a√(1-e²)·w^(-1)
+const std::vector<CurvatureSegment>& curvatureTable() {
+    static const std::vector<CurvatureSegment> table = [] {
+        const double a = ImprovedCoordinateTransform::EARTH_RADIUS_EQUATOR;
+        const double e2 = ImprovedCoordinateTransform::EARTH_ECCENTRICITY_SQ;
+        const double h = CURVATURE_TABLE_STEP * ImprovedCoordinateTransform::PI / 180.0;
+        struct Node { double m, dm, n, dn, r, dr; };
+        std::vector<Node> nodes(CURVATURE_TABLE_SEGMENTS + 1);
+        for (int i = 0; i <= CURVATURE_TABLE_SEGMENTS; ++i) {
+            double phi = i * h;
+            double s = std::sin(phi), c = i == CURVATURE_TABLE_SEGMENTS ? 0.0 : std::cos(phi);
+            double w = 1 - e2 * s * s;
+            double sw = std::sqrt(w);
+            double common = e2 * s * c * h;
+            nodes[i] = { a * (1 - e2) / (w * sw), 3 * a * (1 - e2) * common / (w * w * sw),
+                         a / sw, a * common / (w * sw),
+                         a * std::sqrt(1 - e2) / w, 2 * a * std::sqrt(1 - e2) * common / (w * w) };
+        }
+        std::vector<CurvatureSegment> segments(CURVATURE_TABLE_SEGMENTS);
+        for (int i = 0; i < CURVATURE_TABLE_SEGMENTS; ++i) {
+            const Node& p = nodes[i];
+            const Node& q = nodes[i + 1];
+            segments[i] = { hermite(p.m, p.dm, q.m, q.dm), hermite(p.n, p.dn, q.n, q.dn),
+                            hermite(p.r, p.dr, q.r, q.dr) };
+        }
+        return segments;
+    }();
+    return table;
+}
+
+// 查表插值；半径关于赤道对称、以180°为周期，纬度先折到 [0, 90]。非有限值返回 false，由调用方按精确公式计算
+bool lookupCurvature(double latitude, CubicSegment CurvatureSegment::*radius, double& value) {
+    double x = std::abs(latitude);
+    if (x > 90.0) {
+        x = std::fmod(x, 180.0);
+        if (x > 90.0) x = 180.0 - x;
+    }
+    if (!(x <= 90.0)) return false;
+    double u = x * (1.0 / CURVATURE_TABLE_STEP);
+    int i = std::min(static_cast<int>(u), CURVATURE_TABLE_SEGMENTS - 1);
+    value = (curvatureTable()[i].*radius)(u - i);
+    return true;
+}
+
+} // namespace
+
+void ImprovedCoordinateTransform::setCurvatureEvaluation(CurvatureEvaluation mode) {
+    curvatureEvaluation.store(static_cast<int>(mode), std::memory_order_relaxed);
+}
+
+CurvatureEvaluation ImprovedCoordinateTransform::getCurvatureEvaluation() {
+    return static_cast<CurvatureEvaluation>(curvatureEvaluation.load(std::memory_order_relaxed));
+}
 
 GeoPosition ImprovedCoordinateTransform::updateGeoPositionImproved(const GeoPosition& pos, const Vector3& velocity, double dt) {
     GeoPosition newPos = pos;
@@ -35,31 +123,22 @@ GeoPosition ImprovedCoordinateTransform::updateGeoPositionImproved(const GeoPosi
     return newPos;
 }
 
-double ImprovedCoordinateTransform::calculateDistanceImproved(const GeoPosition& pos1, const GeoPosition& pos2) {
-    double lat1 = degToRad(pos1.latitude);
-    double lon1 = degToRad(pos1.longitude);
-    double lat2 = degToRad(pos2.latitude);
-    double lon2 = degToRad(pos2.longitude);
-    
-    // 使用Vincenty公式计算椭球体上的距离
-    double L = lon2 - lon1;
-    double tanU1 = (1 - EARTH_FLATTENING) * tan(lat1);
-    double tanU2 = (1 - EARTH_FLATTENING) * tan(lat2);
-    double U1 = atan(tanU1);
-    double U2 = atan(tanU2);
-    
+void ImprovedCoordinateTransform::reducedLatitude(double latitude, double& sinU, double& cosU) {
+    double U = atan((1 - EARTH_FLATTENING) * tan(degToRad(latitude)));
+    sinU = sin(U);
+    cosU = cos(U);
+}
+
+bool ImprovedCoordinateTransform::vincentyInverse(double sinU1, double cosU1, double sinU2, double cosU2, double L,
+                                                  double& distance, double& bearing) {
     double lambda = L;
-    double lambdaP;
+    double lambdaP = L;
     int iterations = 0;
     
     // 声明在循环外部使用的变量
-    double sinU1, cosU1, sinU2, cosU2, cosSqAlpha;
+    double cosSqAlpha = 0;
     
     do {
-        sinU1 = sin(U1);
-        cosU1 = cos(U1);
-        sinU2 = sin(U2);
-        cosU2 = cos(U2);
         double sinLambda = sin(lambda);
         double cosLambda = cos(lambda);
         
@@ -67,38 +146,121 @@ double ImprovedCoordinateTransform::calculateDistanceImproved(const GeoPosition&
                               (cosU1 * sinU2 - sinU1 * cosU2 * cosLambda) * 
                               (cosU1 * sinU2 - sinU1 * cosU2 * cosLambda));
         
-        if (sinSigma == 0) return 0;
+        if (sinSigma == 0) {
+            distance = 0;
+            bearing = 0;
+            return true;
+        }
         
         double cosSigma = sinU1 * sinU2 + cosU1 * cosU2 * cosLambda;
         double sigma = atan2(sinSigma, cosSigma);
         double sinAlpha = cosU1 * cosU2 * sinLambda / sinSigma;
         cosSqAlpha = 1 - sinAlpha * sinAlpha;
-        double cos2SigmaM = cosSigma - 2 * sinU1 * sinU2 / cosSqAlpha;
+        // 两点都在赤道上时 cosSqAlpha 为 0，cos2SigmaM 取 0（赤道线）
+        double cos2SigmaM = cosSqAlpha != 0 ? cosSigma - 2 * sinU1 * sinU2 / cosSqAlpha : 0.0;
         
         double C = EARTH_FLATTENING / 16 * cosSqAlpha * (4 + EARTH_FLATTENING * (4 - 3 * cosSqAlpha));
         lambdaP = lambda;
         lambda = L + (1 - C) * EARTH_FLATTENING * sinAlpha * 
                 (sigma + C * sinSigma * (cos2SigmaM + C * cosSigma * (-1 + 2 * cos2SigmaM * cos2SigmaM)));
         
-    } while (std::abs(lambda - lambdaP) > 1e-12 && ++iterations < 100);
+    } while (std::abs(lambda - lambdaP) > 1e-12 && ++iterations < VINCENTY_MAX_ITERATIONS);
     
     double uSq = cosSqAlpha * (EARTH_RADIUS_EQUATOR * EARTH_RADIUS_EQUATOR - EARTH_RADIUS_POLAR * EARTH_RADIUS_POLAR) / 
                  (EARTH_RADIUS_POLAR * EARTH_RADIUS_POLAR);
     double A = 1 + uSq / 16384 * (4096 + uSq * (-768 + uSq * (320 - 175 * uSq)));
     double B = uSq / 1024 * (256 + uSq * (-128 + uSq * (74 - 47 * uSq)));
     
-    double sinSigma = sqrt((cosU2 * sin(lambda)) * (cosU2 * sin(lambda)) +
-                          (cosU1 * sinU2 - sinU1 * cosU2 * cos(lambda)) * 
-                          (cosU1 * sinU2 - sinU1 * cosU2 * cos(lambda)));
-    double cosSigma = sinU1 * sinU2 + cosU1 * cosU2 * cos(lambda);
+    double sinLambda = sin(lambda);
+    double cosLambda = cos(lambda);
+    double sinSigma = sqrt((cosU2 * sinLambda) * (cosU2 * sinLambda) +
+                          (cosU1 * sinU2 - sinU1 * cosU2 * cosLambda) * 
+                          (cosU1 * sinU2 - sinU1 * cosU2 * cosLambda));
+    double cosSigma = sinU1 * sinU2 + cosU1 * cosU2 * cosLambda;
     double sigma = atan2(sinSigma, cosSigma);
-    double cos2SigmaM = cosSigma - 2 * sinU1 * sinU2 / cosSqAlpha;
+    double cos2SigmaM = cosSqAlpha != 0 ? cosSigma - 2 * sinU1 * sinU2 / cosSqAlpha : 0.0;
     
-    double s = EARTH_RADIUS_POLAR * A * (sigma - B * sinSigma * (cos2SigmaM + B / 4 * cosSigma * 
-                (-1 + 2 * cos2SigmaM * cos2SigmaM) - B / 6 * cos2SigmaM * (-3 + 4 * sinSigma * sinSigma) * 
-                (-3 + 4 * cos2SigmaM * cos2SigmaM)));
+    double deltaSigma = B * sinSigma * (cos2SigmaM + B / 4 * (cosSigma * (-1 + 2 * cos2SigmaM * cos2SigmaM) -
+                        B / 6 * cos2SigmaM * (-3 + 4 * sinSigma * sinSigma) * (-3 + 4 * cos2SigmaM * cos2SigmaM)));
+    distance = EARTH_RADIUS_POLAR * A * (sigma - deltaSigma);
     
-    return s;
+    bearing = radToDeg(atan2(cosU2 * sinLambda, cosU1 * sinU2 - sinU1 * cosU2 * cosLambda));
+    if (bearing < 0) bearing += 360.0;
+    return !(std::abs(lambda - lambdaP) > 1e-12);
+}
+
+double ImprovedCoordinateTransform::calculateDistanceImproved(const GeoPosition& pos1, const GeoPosition& pos2) {
+    // 使用Vincenty公式计算椭球体上的距离
+    double sinU1, cosU1, sinU2, cosU2;
+    reducedLatitude(pos1.latitude, sinU1, cosU1);
+    reducedLatitude(pos2.latitude, sinU2, cosU2);
+    double distance, bearing;
+    vincentyInverse(sinU1, cosU1, sinU2, cosU2, degToRad(pos2.longitude) - degToRad(pos1.longitude), distance, bearing);
+    return distance;
+}
+
+double ImprovedCoordinateTransform::calculateBearingImproved(const GeoPosition& from, const GeoPosition& to) {
+    double sinU1, cosU1, sinU2, cosU2;
+    reducedLatitude(from.latitude, sinU1, cosU1);
+    reducedLatitude(to.latitude, sinU2, cosU2);
+    double distance, bearing;
+    vincentyInverse(sinU1, cosU1, sinU2, cosU2, degToRad(to.longitude) - degToRad(from.longitude), distance, bearing);
+    return bearing;
+}
+
+std::size_t ImprovedCoordinateTransform::calculateDistanceMatrix(const GeoPosition* sources, std::size_t sourceCount,
+                                                                 const GeoPosition* targets, std::size_t targetCount,
+                                                                 double* distance, double* bearing,
+                                                                 bool antipodalFallback) {
+    if (sourceCount == 0 || targetCount == 0) return 0;
+
+    // 各点的归化纬度与经度只计算一次（与 calculateDistanceImproved 的逐对计算相同）
+    std::vector<double> sourceSinU(sourceCount), sourceCosU(sourceCount), sourceLongitude(sourceCount);
+    for (std::size_t i = 0; i < sourceCount; ++i) {
+        reducedLatitude(sources[i].latitude, sourceSinU[i], sourceCosU[i]);
+        sourceLongitude[i] = degToRad(sources[i].longitude);
+    }
+    std::vector<double> targetSinU(targetCount), targetCosU(targetCount), targetLongitude(targetCount);
+    for (std::size_t j = 0; j < targetCount; ++j) {
+        reducedLatitude(targets[j].latitude, targetSinU[j], targetCosU[j]);
+        targetLongitude[j] = degToRad(targets[j].longitude);
+    }
+
+    const SimdKernelTable& kernels = getSimdKernels();
+    std::atomic<std::size_t> unconverged(0);
+    std::size_t minRows = std::max<std::size_t>(1, DISTANCE_MATRIX_PARALLEL_THRESHOLD / targetCount);
+    parallelFor(sourceCount, minRows, [&](std::size_t begin, std::size_t end) {
+        // 不需要方位角时写入本线程的临时行
+        std::vector<double> bearingRow(bearing ? 0 : targetCount);
+        std::size_t failed = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+            double* distanceRow = distance + i * targetCount;
+            double* bearingOut = bearing ? bearing + i * targetCount : bearingRow.data();
+            std::size_t rowFailed = kernels.vincentyInverse(sourceSinU[i], sourceCosU[i], sourceLongitude[i],
+                                                            targetSinU.data(), targetCosU.data(),
+                                                            targetLongitude.data(), distanceRow, bearingOut,
+                                                            targetCount);
+            failed += rowFailed;
+            if (rowFailed == 0 || !antipodalFallback) continue;
+            for (std::size_t j = 0; j < targetCount; ++j) {
+                if (!std::isnan(distanceRow[j])) continue;
+                distanceRow[j] = sphericalDistance(sources[i], targets[j]);
+                bearingOut[j] = calculateInitialBearing(sources[i], targets[j]);
+            }
+        }
+        unconverged += failed;
+    });
+    return unconverged;
+}
+
+double ImprovedCoordinateTransform::sphericalDistance(const GeoPosition& pos1, const GeoPosition& pos2) {
+    // 平均半径 (2a + b) / 3 的球面上按Haversine公式计算
+    const double meanRadius = (2 * EARTH_RADIUS_EQUATOR + EARTH_RADIUS_POLAR) / 3;
+    double dLat = degToRad(pos2.latitude - pos1.latitude);
+    double dLon = degToRad(pos2.longitude - pos1.longitude);
+    double h = sin(dLat / 2) * sin(dLat / 2) +
+               cos(degToRad(pos1.latitude)) * cos(degToRad(pos2.latitude)) * sin(dLon / 2) * sin(dLon / 2);
+    return 2 * meanRadius * atan2(sqrt(h), sqrt(std::max(0.0, 1 - h)));
 }
 
 double ImprovedCoordinateTransform::calculateBearing(const GeoPosition& from, const GeoPosition& to) {
@@ -179,6 +341,10 @@ bool ImprovedCoordinateTransform::isSameHemisphere(const GeoPosition& pos1, cons
 }
 
 double ImprovedCoordinateTransform::calculateMeridianRadius(double latitude) {
+    double value;
+    if (getCurvatureEvaluation() == CurvatureEvaluation::Table && lookupCurvature(latitude, &CurvatureSegment::meridian, value)) {
+        return value;
+    }
     double lat = degToRad(latitude);
     double sinLat = sin(lat);
     double e2 = EARTH_ECCENTRICITY_SQ;
@@ -187,6 +353,10 @@ double ImprovedCoordinateTransform::calculateMeridianRadius(double latitude) {
 }
 
 double ImprovedCoordinateTransform::calculatePrimeVerticalRadius(double latitude) {
+    double value;
+    if (getCurvatureEvaluation() == CurvatureEvaluation::Table && lookupCurvature(latitude, &CurvatureSegment::primeVertical, value)) {
+        return value;
+    }
     double lat = degToRad(latitude);
     double sinLat = sin(lat);
     double e2 = EARTH_ECCENTRICITY_SQ;
@@ -195,6 +365,10 @@ double ImprovedCoordinateTransform::calculatePrimeVerticalRadius(double latitude
 }
 
 double ImprovedCoordinateTransform::calculateEarthRadius(double latitude) {
+    double value;
+    if (getCurvatureEvaluation() == CurvatureEvaluation::Table && lookupCurvature(latitude, &CurvatureSegment::mean, value)) {
+        return value;
+    }
     double lat = degToRad(latitude);
     double sinLat = sin(lat);
     double cosLat = cos(lat);
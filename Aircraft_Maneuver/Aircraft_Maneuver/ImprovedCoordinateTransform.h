@@ -3,6 +3,14 @@
 
 #include "AircraftModelLibrary.h"
 #include <cmath>
+#include <cstddef>
+
+// 曲率半径的计算方式：Exact 每次用三角函数与开方计算；Table 查按纬度预先生成的表做三次Hermite插值
+// （节点间隔0.25°，相对误差 < ImprovedCoordinateTransform::CURVATURE_TABLE_RELATIVE_ERROR），省去 sin、sqrt、pow
+enum class CurvatureEvaluation {
+    Exact,
+    Table
+};
 
 class ImprovedCoordinateTransform {
 public:
@@ -20,6 +28,25 @@ public:
     // 计算两点间的精确距离 (使用椭球体模型)
     static double calculateDistanceImproved(const GeoPosition& pos1, const GeoPosition& pos2);
     
+    // 计算椭球面上起点处的初始方位角 (度，[0, 360)，与 calculateDistanceImproved 同一次Vincenty反算)
+    static double calculateBearingImproved(const GeoPosition& from, const GeoPosition& to);
+    
+    // 多对多距离/方位角矩阵 (如多个站点到全部航迹的距离表)：
+    // distance[i * targetCount + j] 与 calculateDistanceImproved(sources[i], targets[j]) 相同，
+    // bearing（可为nullptr）与 calculateBearingImproved 相同，均按行连续存放。
+    // 各点归化纬度只计算一次；每行按当前SIMD级别多车道同时迭代，各车道独立判断收敛，
+    // 标量级别与逐对计算逐位一致，向量级别相差 < 1e-6 米；点对数不少于
+    // DISTANCE_MATRIX_PARALLEL_THRESHOLD 时按行分块多线程执行。
+    // 近对跖点迭代不收敛：antipodalFallback 为 true 时改用平均半径球面上的大圆距离与方位角
+    // (误差约0.5%)，否则写入NaN。返回不收敛的点对数。
+    static std::size_t calculateDistanceMatrix(const GeoPosition* sources, std::size_t sourceCount,
+                                               const GeoPosition* targets, std::size_t targetCount,
+                                               double* distance, double* bearing = nullptr,
+                                               bool antipodalFallback = true);
+    
+    // 距离矩阵启用多线程的最小点对数（同时也是每个线程的最小分块）
+    static const std::size_t DISTANCE_MATRIX_PARALLEL_THRESHOLD;
+    
     // 计算方位角
     static double calculateBearing(const GeoPosition& from, const GeoPosition& to);
     
@@ -37,6 +64,20 @@ public:
 
      // 计算地球曲率半径 (平均)
     static double calculateEarthRadius(double latitude);
+    
+    // 计算子午圈曲率半径
+    static double calculateMeridianRadius(double latitude);
+    
+    // 计算卯酉圈曲率半径
+    static double calculatePrimeVerticalRadius(double latitude);
+    
+    // 曲率半径计算方式（全局设置，默认 Exact），作用于以上三个函数及调用它们的 updateGeoPositionImproved；
+    // 纬度表在首次使用 Table 时生成（约35KB）
+    static void setCurvatureEvaluation(CurvatureEvaluation mode);
+    static CurvatureEvaluation getCurvatureEvaluation();
+    
+    // 查表插值的相对误差上界（Hermite余项 h⁴/384·max|f⁽⁴⁾|，h为节点间隔）
+    static const double CURVATURE_TABLE_RELATIVE_ERROR;
 
 private:
     // 辅助函数：度转弧度
@@ -45,11 +86,18 @@ private:
     // 辅助函数：弧度转度
     static double radToDeg(double radians) { return radians * 180.0 / PI; }
     
-    // 计算卯酉圈曲率半径
-    static double calculateMeridianRadius(double latitude);
+    // Vincenty反算的最大迭代次数
+    static constexpr int VINCENTY_MAX_ITERATIONS = 100;
     
-    // 计算卯酉圈曲率半径
-    static double calculatePrimeVerticalRadius(double latitude);
+    // 归化纬度 U = atan((1-f)·tanφ) 的正余弦
+    static void reducedLatitude(double latitude, double& sinU, double& cosU);
+    
+    // Vincenty反算：L为经度差 (弧度)，输出距离 (米) 与初始方位角 (度)；不收敛时返回false
+    static bool vincentyInverse(double sinU1, double cosU1, double sinU2, double cosU2, double L,
+                                double& distance, double& bearing);
+    
+    // 平均半径球面上的大圆距离（近对跖点的回退）
+    static double sphericalDistance(const GeoPosition& pos1, const GeoPosition& pos2);
     
    
 };
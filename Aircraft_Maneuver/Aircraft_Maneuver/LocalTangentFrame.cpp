@@ -0,0 +1,145 @@
+#include "LocalTangentFrame.h"
+#include "AircraftFleet.h"
+#include "SimdKernels.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+const double PI = 3.14159265358979323846;
+const double EARTH_RADIUS = 6371000.0;  // 球面距离使用的地球半径
+
+// WGS84椭球参数
+const double WGS84_A = 6378137.0;
+const double WGS84_E2 = 0.006694379990141316;
+
+// 批量投影时每次在栈上转换的点数
+const std::size_t BLOCK_SIZE = 256;
+
+} // namespace
+
+LocalTangentFrame::LocalTangentFrame(const GeoPosition& origin) : origin(origin) {
+    Vector3 ecef = geodeticToECEF(origin);
+    originECEF[0] = ecef.north;
+    originECEF[1] = ecef.up;
+    originECEF[2] = ecef.east;
+
+    double lat = origin.latitude * PI / 180.0;
+    double lon = origin.longitude * PI / 180.0;
+    sinOriginLat = sin(lat);
+    cosOriginLat = cos(lat);
+    double sinLon = sin(lon);
+    double cosLon = cos(lon);
+
+    // ECEF -> NUE 旋转矩阵
+    rotation[0][0] = -sinOriginLat * cosLon;
+    rotation[0][1] = -sinOriginLat * sinLon;
+    rotation[0][2] = cosOriginLat;
+    rotation[1][0] = cosOriginLat * cosLon;
+    rotation[1][1] = cosOriginLat * sinLon;
+    rotation[1][2] = sinOriginLat;
+    rotation[2][0] = -sinLon;
+    rotation[2][1] = cosLon;
+    rotation[2][2] = 0.0;
+}
+
+Vector3 LocalTangentFrame::geodeticToECEF(const GeoPosition& position) {
+    double lat = position.latitude * PI / 180.0;
+    double lon = position.longitude * PI / 180.0;
+    double h = position.altitude;
+
+    double N = WGS84_A / sqrt(1 - WGS84_E2 * sin(lat) * sin(lat));  // 卯酉圈曲率半径
+
+    Vector3 ecef;
+    ecef.north = (N + h) * cos(lat) * cos(lon);          // X分量
+    ecef.up = (N + h) * cos(lat) * sin(lon);             // Y分量
+    ecef.east = (N * (1 - WGS84_E2) + h) * sin(lat);     // Z分量
+    return ecef;
+}
+
+Vector3 LocalTangentFrame::ecefToNUE(double x, double y, double z) const {
+    double dx = x - originECEF[0];
+    double dy = y - originECEF[1];
+    double dz = z - originECEF[2];
+
+    Vector3 nue;
+    nue.north = rotation[0][0] * dx + rotation[0][1] * dy + rotation[0][2] * dz;
+    nue.up = rotation[1][0] * dx + rotation[1][1] * dy + rotation[1][2] * dz;
+    nue.east = rotation[2][0] * dx + rotation[2][1] * dy;
+    return nue;
+}
+
+Vector3 LocalTangentFrame::toNUE(const GeoPosition& position) const {
+    Vector3 ecef = geodeticToECEF(position);
+    return ecefToNUE(ecef.north, ecef.up, ecef.east);
+}
+
+void LocalTangentFrame::ecefToNUE(const double* ecef, std::size_t count, Vector3* nue) const {
+    for (std::size_t i = 0; i < count; ++i) {
+        nue[i] = ecefToNUE(ecef[3 * i], ecef[3 * i + 1], ecef[3 * i + 2]);
+    }
+}
+
+void LocalTangentFrame::toNUE(const GeoPosition* positions, std::size_t count, Vector3* nue) const {
+    const SimdKernelTable& kernels = getSimdKernels();
+    double ecef[3 * BLOCK_SIZE];
+    for (std::size_t i = 0; i < count; i += BLOCK_SIZE) {
+        std::size_t n = std::min(BLOCK_SIZE, count - i);
+        kernels.geodeticToECEF(positions + i, ecef, n);
+        ecefToNUE(ecef, n, nue + i);
+    }
+}
+
+void LocalTangentFrame::toNUE(const AircraftFleet& fleet, Vector3* nue) const {
+    if (fleet.getKinematicsFrame() == KinematicsFrame::ECEF) {
+        // 直接使用积分得到的ECEF坐标，无需换算经纬高
+        const double* x = fleet.ecefXData();
+        const double* y = fleet.ecefYData();
+        const double* z = fleet.ecefZData();
+        for (std::size_t i = 0; i < fleet.size(); ++i) {
+            nue[i] = ecefToNUE(x[i], y[i], z[i]);
+        }
+        return;
+    }
+    const SimdKernelTable& kernels = getSimdKernels();
+    const double* latitude = fleet.latitudeData();
+    const double* longitude = fleet.longitudeData();
+    const double* altitude = fleet.altitudeData();
+    GeoPosition block[BLOCK_SIZE];
+    double ecef[3 * BLOCK_SIZE];
+    for (std::size_t i = 0; i < fleet.size(); i += BLOCK_SIZE) {
+        std::size_t n = std::min(BLOCK_SIZE, fleet.size() - i);
+        for (std::size_t k = 0; k < n; ++k) {
+            block[k] = { longitude[i + k], latitude[i + k], altitude[i + k] };
+        }
+        kernels.geodeticToECEF(block, ecef, n);
+        ecefToNUE(ecef, n, nue + i);
+    }
+}
+
+double LocalTangentFrame::distanceTo(const GeoPosition& position) const {
+    double dLat = position.latitude - origin.latitude;
+    double dLon = position.longitude - origin.longitude;
+    double dAlt = position.altitude - origin.altitude;
+    dLat *= PI / 180.0;
+    dLon *= PI / 180.0;
+
+    // Haversine公式计算水平距离（参考纬度的余弦已缓存）
+    double lat2 = position.latitude * PI / 180.0;
+    double a = sin(dLat/2) * sin(dLat/2) + cosOriginLat * cos(lat2) * sin(dLon/2) * sin(dLon/2);
+    double c = 2 * atan2(sqrt(a), sqrt(1-a));
+    double horizontalDistance = EARTH_RADIUS * c;
+
+    return sqrt(horizontalDistance * horizontalDistance + dAlt * dAlt);
+}
+
+double LocalTangentFrame::bearingTo(const GeoPosition& position) const {
+    double lon1 = origin.longitude * PI / 180.0;
+    double lat2 = position.latitude * PI / 180.0;
+    double lon2 = position.longitude * PI / 180.0;
+    double dLon = lon2 - lon1;
+
+    double y = sin(dLon) * cos(lat2);
+    double x = cosOriginLat * sin(lat2) - sinOriginLat * cos(lat2) * cos(dLon);
+    return atan2(y, x) * 180.0 / PI;
+}
@@ -0,0 +1,53 @@
+#ifndef LOCAL_TANGENT_FRAME_H
+#define LOCAL_TANGENT_FRAME_H
+
+#include "AircraftModelLibrary.h"
+#include <cstddef>
+
+class AircraftFleet;
+
+// 当地切平面坐标系（北-上-东），由参考点一次构造
+// 构造时缓存参考点的ECEF位置、ECEF->NUE旋转矩阵及参考纬度的三角函数值，
+// 之后每次投影只需计算目标点的ECEF并做一次矩阵乘加。
+// 构造后不可修改，可被多架飞机、多个站点通过 shared_ptr 共享（见 Aircraft::setReferenceFrame）。
+class LocalTangentFrame {
+public:
+    explicit LocalTangentFrame(const GeoPosition& origin);
+
+    const GeoPosition& getOrigin() const { return origin; }
+
+    // 参考点ECEF位置（与 Aircraft::getECEFPosition 相同约定：north=X, up=Y, east=Z）
+    Vector3 getOriginECEF() const { return { originECEF[0], originECEF[1], originECEF[2] }; }
+
+    // ECEF -> NUE 旋转矩阵元素（行：北、上、东；列：X、Y、Z）
+    double getRotation(int row, int col) const { return rotation[row][col]; }
+
+    // 单点投影：地理坐标 -> NUE（与 Aircraft::getLocalNUEPosition 结果逐位一致）
+    Vector3 toNUE(const GeoPosition& position) const;
+
+    // 单点投影：ECEF -> NUE
+    Vector3 ecefToNUE(double x, double y, double z) const;
+
+    // 批量投影：ecef 按 x,y,z 交错存放（与 Eigen::Matrix3Xd 列主序、SimdKernels 一致）
+    void ecefToNUE(const double* ecef, std::size_t count, Vector3* nue) const;
+
+    // 批量投影：地理坐标数组 / 整个机群（ECEF由当前SIMD级别的内核批量计算）
+    void toNUE(const GeoPosition* positions, std::size_t count, Vector3* nue) const;
+    void toNUE(const AircraftFleet& fleet, Vector3* nue) const;
+
+    // 球面距离（含高度差）与方位角（度），与 Aircraft::getDistanceFromReference / getBearingFromReference 一致
+    double distanceTo(const GeoPosition& position) const;
+    double bearingTo(const GeoPosition& position) const;
+
+    // 地理坐标 -> ECEF（WGS84，约定同 getOriginECEF）
+    static Vector3 geodeticToECEF(const GeoPosition& position);
+
+private:
+    GeoPosition origin;
+    double originECEF[3];
+    double rotation[3][3];
+    double sinOriginLat;
+    double cosOriginLat;
+};
+
+#endif // LOCAL_TANGENT_FRAME_H
@@ -1,9 +1,11 @@
 #include "ManeuverModel.h"
 #include "EulerAngleCalculation.h"
+#include "ManeuverRegistry.h"
 #include <string>
 #include <cmath>
 #include <stdexcept>
 #include <algorithm>
+#include <limits>
 
 // ManeuverParameters实现
 ManeuverParameters::ManeuverParameters()
@@ -23,6 +25,11 @@ double ManeuverParameters::getActualPitchRate(const AircraftPerformance& perf) c
     return pitchRate * perf.maxPitchRate;
 }
 
+namespace {
+// 无限时长（最后一个运动段）
+const double FOREVER = std::numeric_limits<double>::infinity();
+} // namespace
+
 // ManeuverState实现
 ManeuverState::ManeuverState() : totalTime(0.0), currentPhase(0.0), isInitialized(false) {}
 void ManeuverState::reset() {
@@ -60,9 +67,26 @@ void GeneralSManeuverModel::update(Aircraft& aircraft, double dt) {
         aircraft.velocity.north = newNorth;
         aircraft.velocity.east = newEast;
     }
-    aircraft.attitude = EulerAngleCalculator::calculateFromVelocity(aircraft.velocity);
+    aircraft.invalidateAttitude();
 }
 void GeneralSManeuverModel::reset() { totalTime = 0.0; }
+// 正弦转向与正弦垂直速度（相位从机动内部时间起算）
+bool GeneralSManeuverModel::planMotion(const Aircraft& aircraft, MotionPlan& plan) const {
+    if (!(params.period > 0.0)) return false;
+    const auto& perf = aircraft.getPerformance();
+    MotionSegment& segment = plan.add(FOREVER);
+    segment.turnAmplitude = params.getActualTurnRate(perf) * params.amplitude;
+    segment.turnFrequency = 2.0 * M_PI / params.period;
+    segment.turnPhase = segment.turnFrequency * totalTime;
+    if (params.climbRate != 0.0 && params.altitudePeriod > 0.0) {
+        segment.climbAmplitude = params.getActualClimbRate(perf);
+        segment.climbFrequency = 2.0 * M_PI / params.altitudePeriod;
+        segment.climbPhase = segment.climbFrequency * totalTime;
+    } else {
+        segment.verticalSpeed = aircraft.velocity.up;
+    }
+    return true;
+}
 
 // LoopManeuverModel
 void LoopManeuverModel::initialize(const ManeuverParameters& params) {
@@ -74,8 +98,8 @@ void LoopManeuverModel::update(Aircraft& aircraft, double dt) {
     const auto& perf = aircraft.getPerformance();
     double actualClimbRate = params.getActualClimbRate(perf);
     aircraft.velocity.up += actualClimbRate * dt;
-    aircraft.attitude = EulerAngleCalculator::calculateLoopManeuverAttitude(
-        aircraft.velocity, actualClimbRate, dt);
+    aircraft.setAttitude(EulerAngleCalculator::calculateLoopManeuverAttitude(
+        aircraft.velocity, actualClimbRate, dt));
 }
 void LoopManeuverModel::reset() { totalTime = 0.0; }
 
@@ -89,8 +113,8 @@ void RollManeuverModel::update(Aircraft& aircraft, double dt) {
     const auto& perf = aircraft.getPerformance();
     double actualRollRate = params.getActualRollRate(perf);
     std::swap(aircraft.velocity.north, aircraft.velocity.east);
-    aircraft.attitude = EulerAngleCalculator::calculateRollManeuverAttitude(
-        aircraft.velocity, actualRollRate, dt);
+    aircraft.setAttitude(EulerAngleCalculator::calculateRollManeuverAttitude(
+        aircraft.velocity, actualRollRate, dt));
 }
 void RollManeuverModel::reset() { totalTime = 0.0; }
 
@@ -107,13 +131,11 @@ void SplitSManeuverModel::update(Aircraft& aircraft, double dt) {
     double actualClimbRate = params.getActualClimbRate(perf);
     if (!halfLoopDone) {
         aircraft.velocity.up = actualClimbRate;
-        aircraft.attitude.pitch = 0.3;
         if (aircraft.position.altitude > 1500.0 || totalTime > 3.0) {
             halfLoopDone = true;
         }
     } else {
         aircraft.velocity.up = -actualClimbRate * 0.5;
-        aircraft.attitude.pitch = -0.2;
         double turnAngle = actualTurnRate * dt;
         double speed = std::sqrt(aircraft.velocity.north * aircraft.velocity.north +
                                  aircraft.velocity.east * aircraft.velocity.east);
@@ -126,38 +148,79 @@ void SplitSManeuverModel::update(Aircraft& aircraft, double dt) {
             aircraft.velocity.east = newEast;
         }
     }
-    aircraft.attitude = EulerAngleCalculator::calculateFromVelocity(aircraft.velocity);
+    aircraft.invalidateAttitude();
 }
 void SplitSManeuverModel::reset() { totalTime = 0.0; halfLoopDone = false; }
+// 爬升段（高度超过1500米或机动时间超过3秒结束）后转入下降匀速转弯
+bool SplitSManeuverModel::planMotion(const Aircraft& aircraft, MotionPlan& plan) const {
+    const auto& perf = aircraft.getPerformance();
+    double actualTurnRate = params.getActualTurnRate(perf);
+    double actualClimbRate = params.getActualClimbRate(perf);
+    if (!halfLoopDone) {
+        double duration = std::max(3.0 - totalTime, 0.0);
+        if (aircraft.position.altitude > 1500.0) {
+            duration = 0.0;
+        } else if (actualClimbRate > 0.0) {
+            duration = std::min(duration, (1500.0 - aircraft.position.altitude) / actualClimbRate);
+        }
+        plan.add(duration).verticalSpeed = actualClimbRate;
+    }
+    MotionSegment& turn = plan.add(FOREVER);
+    turn.turnRate = actualTurnRate;
+    turn.verticalSpeed = -actualClimbRate * 0.5;
+    return true;
+}
 
 // ImmelmannManeuverModel
 void ImmelmannManeuverModel::initialize(const ManeuverParameters& params) {
     this->params = params;
     totalTime = 0.0;
     halfLoopDone = false;
+    bodyRotation = 0.0;
 }
 void ImmelmannManeuverModel::update(Aircraft& aircraft, double dt) {
     totalTime += dt;
     const auto& perf = aircraft.getPerformance();
     double actualPitchRate = params.getActualPitchRate(perf);
     double actualRollRate = params.getActualRollRate(perf);
+    if (aircraft.usesQuaternionAttitude()) {
+        // 四元数姿态：先绕机体右轴上仰半圈（倒飞、航向反转），再绕机体前轴滚转半圈改平
+        double rate = halfLoopDone ? actualRollRate : actualPitchRate;
+        if (bodyRotation >= M_PI) rate = 0.0;
+        else if (bodyRotation + rate * dt >= M_PI) rate = (M_PI - bodyRotation) / dt;
+        bodyRotation += rate * dt;
+        // 先旋转再改速度：初始姿态若随速度推导，应取机动开始前的速度
+        if (halfLoopDone) {
+            aircraft.rotateBody(rate, 0.0, 0.0, dt);
+            aircraft.velocity.up = 0.0;
+        } else {
+            aircraft.rotateBody(0.0, rate, 0.0, dt);
+            aircraft.velocity.up = params.getActualClimbRate(perf);
+            if (bodyRotation >= M_PI) {
+                halfLoopDone = true;
+                bodyRotation = 0.0;
+            }
+        }
+        return;
+    }
+    AttitudeAngles attitude = aircraft.getAttitude();
     if (!halfLoopDone) {
-        aircraft.attitude.pitch += actualPitchRate * dt;
+        attitude.pitch += actualPitchRate * dt;
         aircraft.velocity.up = params.getActualClimbRate(perf);
-        if (aircraft.attitude.getPitchDegrees() >= 180.0) {
-            aircraft.attitude.pitch = M_PI;
+        if (attitude.getPitchDegrees() >= 180.0) {
+            attitude.pitch = M_PI;
             halfLoopDone = true;
         }
     } else {
-        aircraft.attitude.roll += actualRollRate * dt;
+        attitude.roll += actualRollRate * dt;
         aircraft.velocity.up = 0.0;
-        if (aircraft.attitude.getRollDegrees() >= 180.0) {
-            aircraft.attitude.roll = M_PI;
+        if (attitude.getRollDegrees() >= 180.0) {
+            attitude.roll = M_PI;
         }
     }
-    aircraft.attitude = EulerAngleCalculator::limitAttitudeAngles(aircraft.attitude);
+    aircraft.setAttitude(EulerAngleCalculator::limitAttitudeAngles(attitude));
 }
-void ImmelmannManeuverModel::reset() { totalTime = 0.0; halfLoopDone = false; }
+void ImmelmannManeuverModel::reset() { totalTime = 0.0; halfLoopDone = false; bodyRotation = 0.0; }
 
 // BarrelRollManeuverModel
 void BarrelRollManeuverModel::initialize(const ManeuverParameters& params) {
@@ -169,9 +232,15 @@ void BarrelRollManeuverModel::update(Aircraft& aircraft, double dt) {
     const auto& perf = aircraft.getPerformance();
     double actualRollRate = params.getActualRollRate(perf);
     double actualPitchRate = params.getActualPitchRate(perf);
-    aircraft.attitude.roll += actualRollRate * dt;
-    aircraft.attitude.pitch += actualPitchRate * std::sin(totalTime) * dt;
-    aircraft.attitude = EulerAngleCalculator::limitAttitudeAngles(aircraft.attitude);
+    if (aircraft.usesQuaternionAttitude()) {
+        // 四元数姿态：滚转、俯仰速率作为机体角速度积分
+        aircraft.rotateBody(actualRollRate, actualPitchRate * std::sin(totalTime), 0.0, dt);
+        return;
+    }
+    AttitudeAngles attitude = aircraft.getAttitude();
+    attitude.roll += actualRollRate * dt;
+    attitude.pitch += actualPitchRate * std::sin(totalTime) * dt;
+    aircraft.setAttitude(EulerAngleCalculator::limitAttitudeAngles(attitude));
 }
 void BarrelRollManeuverModel::reset() { totalTime = 0.0; }
 
@@ -189,7 +258,6 @@ void EvasiveDiveManeuverModel::update(Aircraft& aircraft, double dt) {
     double actualTurnRate = params.getActualTurnRate(perf);
     if (divePhase) {
         aircraft.velocity.up = -actualClimbRate * 2.0;
-        aircraft.attitude.pitch = -0.3;
         if (aircraft.position.altitude < 500.0 || totalTime > 3.0) {
             divePhase = false;
             turnPhase = true;
@@ -208,13 +276,40 @@ void EvasiveDiveManeuverModel::update(Aircraft& aircraft, double dt) {
         }
         if (totalTime > 6.0) {
             aircraft.velocity.up = 0.0;
-            aircraft.attitude.pitch = 0.0;
             turnPhase = false;
         }
     }
-    aircraft.attitude = EulerAngleCalculator::calculateFromVelocity(aircraft.velocity);
+    aircraft.invalidateAttitude();
 }
 void EvasiveDiveManeuverModel::reset() { totalTime = 0.0; divePhase = true; turnPhase = false; }
+// 俯冲段（高度低于500米或机动时间超过3秒结束）、保持下降率的匀速转弯段（至机动时间6秒）、平飞段
+bool EvasiveDiveManeuverModel::planMotion(const Aircraft& aircraft, MotionPlan& plan) const {
+    const auto& perf = aircraft.getPerformance();
+    double actualClimbRate = params.getActualClimbRate(perf);
+    double actualTurnRate = params.getActualTurnRate(perf);
+    double turnStart = totalTime;
+    double turnVerticalSpeed = aircraft.velocity.up;
+    if (divePhase) {
+        double duration = std::max(3.0 - totalTime, 0.0);
+        if (aircraft.position.altitude < 500.0) {
+            duration = 0.0;
+        } else if (actualClimbRate > 0.0) {
+            duration = std::min(duration, (aircraft.position.altitude - 500.0) / (2.0 * actualClimbRate));
+        }
+        plan.add(duration).verticalSpeed = -actualClimbRate * 2.0;
+        turnStart += duration;
+        turnVerticalSpeed = -actualClimbRate * 2.0;
+    }
+    if (divePhase || turnPhase) {
+        MotionSegment& turn = plan.add(std::max(6.0 - turnStart, 0.0));
+        turn.turnRate = actualTurnRate;
+        turn.verticalSpeed = turnVerticalSpeed;
+        plan.add(FOREVER);
+    } else {
+        plan.add(FOREVER).verticalSpeed = aircraft.velocity.up;
+    }
+    return true;
+}
 
 // LManeuverModel
 void LManeuverModel::initialize(const ManeuverParameters& params) {
@@ -242,9 +337,19 @@ void LManeuverModel::update(Aircraft& aircraft, double dt) {
             aircraft.velocity.east = newEast;
         }
     }
-    aircraft.attitude = EulerAngleCalculator::calculateFromVelocity(aircraft.velocity);
+    aircraft.invalidateAttitude();
 }
 void LManeuverModel::reset() { totalTime = 0.0; turnPhase = false; }
+// 直线段（至机动时间2秒）后以两倍转向率匀速转弯，垂直速度保持不变
+bool LManeuverModel::planMotion(const Aircraft& aircraft, MotionPlan& plan) const {
+    if (!turnPhase) {
+        plan.add(std::max(2.0 - totalTime, 0.0)).verticalSpeed = aircraft.velocity.up;
+    }
+    MotionSegment& turn = plan.add(FOREVER);
+    turn.turnRate = params.getActualTurnRate(aircraft.getPerformance()) * 2.0;
+    turn.verticalSpeed = aircraft.velocity.up;
+    return true;
+}
 
 // ConstantFlightModel
 void ConstantFlightModel::initialize(const ManeuverParameters& params) {
@@ -288,147 +393,36 @@ void ConstantFlightModel::update(Aircraft& aircraft, double dt) {
             aircraft.velocity.east = newEast;
         }
     }
-    aircraft.attitude = EulerAngleCalculator::calculateFromVelocity(aircraft.velocity);
+    aircraft.invalidateAttitude();
 }
 void ConstantFlightModel::reset() { totalTime = 0.0; }
+// 仅在稳态（速度、高度、航向误差都在调节死区内）时为匀速平飞；
+// 调节过程的垂直速度与步长有关，没有连续时间极限，不做闭式求解
+bool ConstantFlightModel::planMotion(const Aircraft& aircraft, MotionPlan& plan) const {
+    double currentSpeed = std::sqrt(aircraft.velocity.north * aircraft.velocity.north +
+                                    aircraft.velocity.east * aircraft.velocity.east);
+    double headingError = targetHeading - std::atan2(aircraft.velocity.east, aircraft.velocity.north);
+    if (headingError > M_PI) headingError -= 2.0 * M_PI;
+    if (headingError < -M_PI) headingError += 2.0 * M_PI;
+    if (std::abs(targetSpeed - currentSpeed) > 1.0 || std::abs(targetAltitude - aircraft.position.altitude) > 10.0 ||
+        std::abs(headingError) > 0.1) {
+        return false;
+    }
+    plan.add(FOREVER);
+    return true;
+}
 
 // 机动模型工厂实现
+// 工厂接口保留字符串参数，查找与默认参数统一由编译期注册表 ManeuverRegistry 提供
 std::shared_ptr<ManeuverModel> ManeuverModelFactory::createManeuverModel(const std::string& name) {
-	if (name == "s" || name == "S") {
-		return std::make_shared<GeneralSManeuverModel>();
-	}
-	else if (name == "s_advanced" || name == "advanced_s") {
-		return std::make_shared<GeneralSManeuverModel>();
-	}
-	else if (name == "snake") {
-		return std::make_shared<GeneralSManeuverModel>();
-	}
-	else if (name == "loop") {
-		return std::make_shared<LoopManeuverModel>();
-	}
-	else if (name == "roll") {
-		return std::make_shared<RollManeuverModel>();
-	}
-	else if (name == "split_s") {
-		return std::make_shared<SplitSManeuverModel>();
-	}
-	else if (name == "immelmann") {
-		return std::make_shared<ImmelmannManeuverModel>();
-	}
-	else if (name == "barrel_roll") {
-		return std::make_shared<BarrelRollManeuverModel>();
-	}
-	else if (name == "evasive_dive") {
-		return std::make_shared<EvasiveDiveManeuverModel>();
-	}
-	else if (name == "l_maneuver") {
-		return std::make_shared<LManeuverModel>();
-	}
-	else if (name == "constant" || name == "constant_flight") {
-		return std::make_shared<ConstantFlightModel>();
-	}
-	else {
+	ManeuverId id = ManeuverRegistry::find(name);
+	if (!ManeuverRegistry::isValid(id)) {
 		throw std::invalid_argument("Unknown maneuver type: " + name);
 	}
+	return ManeuverRegistry::create(id);
 }
 
 ManeuverParameters ManeuverModelFactory::getDefaultParameters(const std::string& maneuverType) {
-	ManeuverParameters params;
-	
-	if (maneuverType == "s" || maneuverType == "S") {
-		params.turnRate = 0.6;      // 60%的最大转向速率
-		params.period = 4.0;
-		params.amplitude = 1.0;
-		params.climbRate = 0.0;     // 无爬升
-		params.altitudePeriod = 0.0;
-	}
-	else if (maneuverType == "s_advanced" || maneuverType == "advanced_s") {
-		params.turnRate = 0.5;      // 50%的最大转向速率
-		params.period = 6.0;
-		params.amplitude = 1.0;
-		params.climbRate = 0.3;     // 30%的最大爬升速率
-		params.altitudePeriod = 3.0;
-	}
-	else if (maneuverType == "snake") {
-		params.turnRate = 0.8;      // 80%的最大转向速率
-		params.period = 2.0;
-		params.amplitude = 0.8;
-		params.climbRate = 0.0;     // 无爬升
-		params.altitudePeriod = 0.0;
-	}
-	else if (maneuverType == "loop") {
-		params.turnRate = 0.0;      // 无转向
-		params.climbRate = 0.8;     // 80%的最大爬升速率
-		params.period = 10.0;
-		params.amplitude = 1.0;
-		params.altitudePeriod = 5.0;
-	}
-	else if (maneuverType == "roll") {
-		params.turnRate = 0.0;      // 无转向
-		params.climbRate = 0.0;     // 无爬升
-		params.rollRate = 0.8;      // 80%的最大滚转速率
-		params.period = 2.0;
-		params.amplitude = 1.0;
-		params.altitudePeriod = 0.0;
-	}
-	else if (maneuverType == "split_s") {
-		params.turnRate = 0.7;      // 70%的最大转向速率
-		params.climbRate = 0.6;     // 60%的最大爬升速率
-		params.period = 8.0;
-		params.amplitude = 1.0;
-		params.altitudePeriod = 4.0;
-	}
-	else if (maneuverType == "immelmann") {
-		params.turnRate = 0.0;      // 无转向
-		params.climbRate = 0.7;     // 70%的最大爬升速率
-		params.rollRate = 0.8;      // 80%的最大滚转速率
-		params.pitchRate = 0.6;     // 60%的最大俯仰速率
-		params.period = 6.0;
-		params.amplitude = 1.0;
-		params.altitudePeriod = 3.0;
-	}
-	else if (maneuverType == "barrel_roll") {
-		params.turnRate = 0.0;      // 无转向
-		params.climbRate = 0.0;     // 无爬升
-		params.rollRate = 0.9;      // 90%的最大滚转速率
-		params.pitchRate = 0.4;     // 40%的最大俯仰速率
-		params.period = 4.0;
-		params.amplitude = 1.0;
-		params.altitudePeriod = 0.0;
-	}
-	else if (maneuverType == "evasive_dive") {
-		params.turnRate = 0.8;      // 80%的最大转向速率
-		params.climbRate = -0.9;    // 90%的最大下降速率
-		params.period = 6.0;
-		params.amplitude = 1.0;
-		params.altitudePeriod = 3.0;
-	}
-	else if (maneuverType == "l_maneuver") {
-		params.turnRate = 0.9;      // 90%的最大转向速率
-		params.climbRate = 0.0;     // 无爬升
-		params.period = 4.0;
-		params.amplitude = 1.0;
-		params.altitudePeriod = 0.0;
-	}
-	else if (maneuverType == "constant" || maneuverType == "constant_flight") {
-		params.turnRate = 0.0;      // 无转向
-		params.climbRate = 0.0;     // 无爬升
-		params.rollRate = 0.0;      // 无滚转
-		params.pitchRate = 0.0;     // 无俯仰
-		params.period = 0.0;        // 无周期
-		params.amplitude = 0.0;     // 无振幅
-		params.altitudePeriod = 0.0;
-	}
-	else {
-		// 默认参数
-		params.turnRate = 0.5;
-		params.climbRate = 0.2;
-		params.rollRate = 0.5;
-		params.pitchRate = 0.3;
-		params.period = 4.0;
-		params.amplitude = 1.0;
-		params.altitudePeriod = 3.0;
-	}
-	
-	return params;
-} 
\ No newline at end of file
+	// 未知名称返回兜底默认参数
+	return ManeuverRegistry::getDefaults(ManeuverRegistry::find(maneuverType)).toParameters();
+}
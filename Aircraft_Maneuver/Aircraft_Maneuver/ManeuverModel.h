@@ -4,6 +4,7 @@
 #include <string>
 #include <memory>
 #include <cmath>
+#include <cstddef>
 #include "AircraftModelLibrary.h"
 
 // 机动参数结构体
@@ -31,6 +32,36 @@ struct ManeuverState {
     void reset();
 };
 
+// 可闭式求解的运动段（连续时间，dt -> 0 时逐步仿真的极限）
+// 水平速度以角速度 turnRate + turnAmplitude * sin(turnFrequency * τ + turnPhase) 旋转（正值由北向东），
+// 垂直速度为 verticalSpeed + climbAmplitude * sin(climbFrequency * τ + climbPhase)，τ 为段内时间；
+// 频率为0时对应正弦项不存在。水平速度大小不变（假设推力与阻力平衡）。
+struct MotionSegment {
+    double duration = 0.0;        // 段时长（秒），最后一段可为无穷大
+    double turnRate = 0.0;        // 常值转向角速度 (弧度/秒)
+    double turnAmplitude = 0.0;   // 正弦转向角速度幅值 (弧度/秒)
+    double turnFrequency = 0.0;   // 正弦转向角频率 (弧度/秒)
+    double turnPhase = 0.0;       // 段起点的正弦转向相位 (弧度)
+    double verticalSpeed = 0.0;   // 常值垂直速度 (米/秒)
+    double climbAmplitude = 0.0;  // 正弦垂直速度幅值 (米/秒)
+    double climbFrequency = 0.0;  // 正弦垂直速度角频率 (弧度/秒)
+    double climbPhase = 0.0;      // 段起点的正弦垂直速度相位 (弧度)
+};
+
+// 机动从当前时刻起的分段运动描述（阶段切换时间已解出）
+struct MotionPlan {
+    static constexpr std::size_t MAX_SEGMENTS = 4;
+    std::size_t count = 0;
+    MotionSegment segments[MAX_SEGMENTS];
+
+    MotionSegment& add(double duration) {
+        MotionSegment& segment = segments[count++];
+        segment = MotionSegment();
+        segment.duration = duration;
+        return segment;
+    }
+};
+
 // 机动模型基类
 class ManeuverModel {
 public:
@@ -39,6 +70,10 @@ public:
     virtual void update(Aircraft& aircraft, double dt) = 0;
     virtual std::string getName() const = 0;
     virtual void reset() = 0;
+
+    // 按当前机动状态描述此后的运动（供 AnalyticPropagator 解析外推）；
+    // 运动不能闭式表示时返回false（默认），调用方需逐步仿真
+    virtual bool planMotion(const Aircraft&, MotionPlan&) const { return false; }
 };
 
 // 机动模型工厂
@@ -55,6 +90,7 @@ public:
     void update(Aircraft& aircraft, double dt) override;
     std::string getName() const override { return "General S Maneuver"; }
     void reset() override;
+    bool planMotion(const Aircraft& aircraft, MotionPlan& plan) const override;
 private:
     ManeuverParameters params;
     double totalTime = 0.0;
@@ -85,6 +121,7 @@ public:
     void update(Aircraft& aircraft, double dt) override;
     std::string getName() const override { return "Split-S Maneuver"; }
     void reset() override;
+    bool planMotion(const Aircraft& aircraft, MotionPlan& plan) const override;
 private:
     ManeuverParameters params;
     double totalTime = 0.0;
@@ -100,6 +137,7 @@ private:
     ManeuverParameters params;
     double totalTime = 0.0;
     bool halfLoopDone = false;
+    double bodyRotation = 0.0;   // 四元数姿态下当前阶段已绕机体轴转过的角度（弧度）
 };
 class BarrelRollManeuverModel : public ManeuverModel {
 public:
@@ -117,6 +155,7 @@ public:
     void update(Aircraft& aircraft, double dt) override;
     std::string getName() const override { return "Evasive Dive Maneuver"; }
     void reset() override;
+    bool planMotion(const Aircraft& aircraft, MotionPlan& plan) const override;
 private:
     ManeuverParameters params;
     double totalTime = 0.0;
@@ -129,6 +168,7 @@ public:
     void update(Aircraft& aircraft, double dt) override;
     std::string getName() const override { return "L Maneuver"; }
     void reset() override;
+    bool planMotion(const Aircraft& aircraft, MotionPlan& plan) const override;
 private:
     ManeuverParameters params;
     double totalTime = 0.0;
@@ -140,6 +180,7 @@ public:
     void update(Aircraft& aircraft, double dt) override;
     std::string getName() const override { return "Constant Speed & Altitude Flight"; }
     void reset() override;
+    bool planMotion(const Aircraft& aircraft, MotionPlan& plan) const override;
     void setTargetSpeed(double speed) { targetSpeed = speed; }
     void setTargetAltitude(double altitude) { targetAltitude = altitude; }
     void setTargetHeading(double heading) { targetHeading = heading; }
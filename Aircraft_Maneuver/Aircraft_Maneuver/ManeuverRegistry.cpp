@@ -0,0 +1,59 @@
+#include "ManeuverRegistry.h"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+// 编译期校验：每个规范名称都能查回自己的编号（即 ENTRIES 顺序与 ManeuverId 一致）
+constexpr bool entriesMatchIds() {
+    for (std::size_t i = 0; i < ManeuverRegistryDetail::ENTRIES.size(); ++i) {
+        if (ManeuverRegistry::find(ManeuverRegistryDetail::ENTRIES[i].name) != static_cast<ManeuverId>(i)) return false;
+    }
+    return true;
+}
+
+static_assert(entriesMatchIds(), "ManeuverRegistryDetail::ENTRIES must follow ManeuverId order");
+static_assert(ManeuverRegistry::find("constant_flight") == ManeuverId::ConstantFlight, "alias lookup");
+static_assert(ManeuverRegistry::find("unknown") == ManeuverId::Count, "unknown lookup");
+
+} // namespace
+
+const ManeuverRegistryDetail::Entry& ManeuverRegistry::entry(ManeuverId id) {
+    if (!isValid(id)) {
+        throw std::invalid_argument("ManeuverRegistry: invalid maneuver id " + std::to_string(static_cast<int>(id)));
+    }
+    return ManeuverRegistryDetail::ENTRIES[static_cast<std::size_t>(id)];
+}
+
+ManeuverModel* ManeuverRegistry::construct(ManeuverId id, void* storage, std::size_t size) {
+    const ManeuverRegistryDetail::Entry& e = entry(id);
+    if (!storage || size < e.size || reinterpret_cast<std::uintptr_t>(storage) % e.alignment != 0) {
+        throw std::invalid_argument("ManeuverRegistry: storage too small or misaligned for " + std::string(e.name));
+    }
+    return e.construct(storage);
+}
+
+void ManeuverRegistry::destroy(ManeuverModel* model) noexcept {
+    if (model) model->~ManeuverModel();
+}
+
+std::shared_ptr<ManeuverModel> ManeuverRegistry::create(ManeuverId id) {
+    return entry(id).makeShared();
+}
+
+ManeuverModel* ManeuverSlot::emplace(ManeuverId newId) {
+    if (!ManeuverRegistry::isValid(newId)) {
+        throw std::invalid_argument("ManeuverSlot: invalid maneuver id");
+    }
+    clear();
+    model = ManeuverRegistry::construct(newId, storage, sizeof(storage));
+    id = newId;
+    return model;
+}
+
+void ManeuverSlot::clear() noexcept {
+    ManeuverRegistry::destroy(model);
+    model = nullptr;
+    id = ManeuverId::Count;
+}
@@ -0,0 +1,236 @@
+#ifndef MANEUVER_REGISTRY_H
+#define MANEUVER_REGISTRY_H
+
+#include "ManeuverModel.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string_view>
+
+// 内置机动编号（每个编号对应一组默认参数；别名映射到同一编号）
+enum class ManeuverId : std::uint8_t {
+    GeneralS,        // "s" / "S"
+    AdvancedS,       // "s_advanced" / "advanced_s"
+    Snake,           // "snake"
+    Loop,            // "loop"
+    Roll,            // "roll"
+    SplitS,          // "split_s"
+    Immelmann,       // "immelmann"
+    BarrelRoll,      // "barrel_roll"
+    EvasiveDive,     // "evasive_dive"
+    LManeuver,       // "l_maneuver"
+    ConstantFlight,  // "constant" / "constant_flight"
+    Count            // 同时表示"未知机动"
+};
+
+// 编译期默认参数（字段与 ManeuverParameters 一一对应）
+struct ManeuverDefaults {
+    double turnRate;
+    double climbRate;
+    double rollRate;
+    double pitchRate;
+    double period;
+    double amplitude;
+    double altitudePeriod;
+
+    ManeuverParameters toParameters() const {
+        ManeuverParameters params;
+        params.turnRate = turnRate;
+        params.climbRate = climbRate;
+        params.rollRate = rollRate;
+        params.pitchRate = pitchRate;
+        params.period = period;
+        params.amplitude = amplitude;
+        params.altitudePeriod = altitudePeriod;
+        return params;
+    }
+};
+
+// FNV-1a 64位名称哈希，可在编译期求值
+constexpr std::uint64_t hashManeuverName(std::string_view name) {
+    std::uint64_t hash = 14695981039346656037ull;
+    for (char c : name) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+namespace ManeuverRegistryDetail {
+
+template<class Model>
+ManeuverModel* constructModel(void* storage) {
+    return new (storage) Model();
+}
+
+template<class Model>
+std::shared_ptr<ManeuverModel> makeModel() {
+    return std::make_shared<Model>();
+}
+
+struct Entry {
+    std::string_view name;                          // 规范名称
+    ManeuverDefaults defaults;
+    ManeuverModel* (*construct)(void* storage);     // 原位构造
+    std::shared_ptr<ManeuverModel> (*makeShared)(); // 堆上构造（兼容工厂接口）
+    std::size_t size;
+    std::size_t alignment;
+};
+
+template<class Model>
+constexpr Entry makeEntry(std::string_view name, const ManeuverDefaults& defaults) {
+    return { name, defaults, &constructModel<Model>, &makeModel<Model>, sizeof(Model), alignof(Model) };
+}
+
+// 按 ManeuverId 顺序排列；默认参数与原 getDefaultParameters 分支逐项一致
+inline constexpr std::array<Entry, static_cast<std::size_t>(ManeuverId::Count)> ENTRIES = { {
+    //                                                        turn  climb  roll  pitch period amp  altPeriod
+    makeEntry<GeneralSManeuverModel>("s",                  { 0.6,  0.0,  0.5,  0.3,  4.0, 1.0, 0.0 }),
+    makeEntry<GeneralSManeuverModel>("s_advanced",         { 0.5,  0.3,  0.5,  0.3,  6.0, 1.0, 3.0 }),
+    makeEntry<GeneralSManeuverModel>("snake",              { 0.8,  0.0,  0.5,  0.3,  2.0, 0.8, 0.0 }),
+    makeEntry<LoopManeuverModel>("loop",                   { 0.0,  0.8,  0.5,  0.3, 10.0, 1.0, 5.0 }),
+    makeEntry<RollManeuverModel>("roll",                   { 0.0,  0.0,  0.8,  0.3,  2.0, 1.0, 0.0 }),
+    makeEntry<SplitSManeuverModel>("split_s",              { 0.7,  0.6,  0.5,  0.3,  8.0, 1.0, 4.0 }),
+    makeEntry<ImmelmannManeuverModel>("immelmann",         { 0.0,  0.7,  0.8,  0.6,  6.0, 1.0, 3.0 }),
+    makeEntry<BarrelRollManeuverModel>("barrel_roll",      { 0.0,  0.0,  0.9,  0.4,  4.0, 1.0, 0.0 }),
+    makeEntry<EvasiveDiveManeuverModel>("evasive_dive",    { 0.8, -0.9,  0.5,  0.3,  6.0, 1.0, 3.0 }),
+    makeEntry<LManeuverModel>("l_maneuver",                { 0.9,  0.0,  0.5,  0.3,  4.0, 1.0, 0.0 }),
+    makeEntry<ConstantFlightModel>("constant",             { 0.0,  0.0,  0.0,  0.0,  0.0, 0.0, 0.0 }),
+} };
+
+// 未知名称时 getDefaultParameters 返回的参数
+inline constexpr ManeuverDefaults FALLBACK_DEFAULTS = { 0.5, 0.2, 0.5, 0.3, 4.0, 1.0, 3.0 };
+
+struct Alias {
+    std::string_view name;
+    std::uint64_t hash;
+    ManeuverId id;
+};
+
+constexpr Alias makeAlias(std::string_view name, ManeuverId id) {
+    return { name, hashManeuverName(name), id };
+}
+
+inline constexpr std::array<Alias, 14> ALIASES = { {
+    makeAlias("s", ManeuverId::GeneralS),
+    makeAlias("S", ManeuverId::GeneralS),
+    makeAlias("s_advanced", ManeuverId::AdvancedS),
+    makeAlias("advanced_s", ManeuverId::AdvancedS),
+    makeAlias("snake", ManeuverId::Snake),
+    makeAlias("loop", ManeuverId::Loop),
+    makeAlias("roll", ManeuverId::Roll),
+    makeAlias("split_s", ManeuverId::SplitS),
+    makeAlias("immelmann", ManeuverId::Immelmann),
+    makeAlias("barrel_roll", ManeuverId::BarrelRoll),
+    makeAlias("evasive_dive", ManeuverId::EvasiveDive),
+    makeAlias("l_maneuver", ManeuverId::LManeuver),
+    makeAlias("constant", ManeuverId::ConstantFlight),
+    makeAlias("constant_flight", ManeuverId::ConstantFlight),
+} };
+
+// 开放寻址（线性探测）哈希表，槽位存放 ALIASES 下标，编译期构建
+inline constexpr std::size_t TABLE_SIZE = 32;
+inline constexpr std::uint8_t EMPTY_SLOT = 0xFF;
+
+constexpr std::array<std::uint8_t, TABLE_SIZE> buildTable() {
+    std::array<std::uint8_t, TABLE_SIZE> table = {};
+    for (std::size_t i = 0; i < TABLE_SIZE; ++i) table[i] = EMPTY_SLOT;
+    for (std::size_t a = 0; a < ALIASES.size(); ++a) {
+        std::size_t slot = ALIASES[a].hash & (TABLE_SIZE - 1);
+        while (table[slot] != EMPTY_SLOT) slot = (slot + 1) & (TABLE_SIZE - 1);
+        table[slot] = static_cast<std::uint8_t>(a);
+    }
+    return table;
+}
+
+inline constexpr std::array<std::uint8_t, TABLE_SIZE> TABLE = buildTable();
+
+constexpr std::size_t maxModelSize() {
+    std::size_t size = 0;
+    for (const Entry& e : ENTRIES) size = e.size > size ? e.size : size;
+    return size;
+}
+
+constexpr std::size_t maxModelAlignment() {
+    std::size_t alignment = 1;
+    for (const Entry& e : ENTRIES) alignment = e.alignment > alignment ? e.alignment : alignment;
+    return alignment;
+}
+
+} // namespace ManeuverRegistryDetail
+
+// 编译期机动注册表：名称/别名哈希 → 编号 → {构造函数, 默认参数}
+// 所有表均为 constexpr 常量，查询无锁、无分配，可从任意工作线程并发调用；
+// construct 在调用方提供的存储上原位构造模型，运行中切换机动不触发堆分配。
+class ManeuverRegistry {
+public:
+    // 可容纳任一内置模型的存储大小与对齐
+    static constexpr std::size_t STORAGE_SIZE = ManeuverRegistryDetail::maxModelSize();
+    static constexpr std::size_t STORAGE_ALIGNMENT = ManeuverRegistryDetail::maxModelAlignment();
+
+    // 名称（含别名）查找，未知名称返回 ManeuverId::Count；可在编译期求值
+    static constexpr ManeuverId find(std::string_view name) {
+        using namespace ManeuverRegistryDetail;
+        const std::uint64_t hash = hashManeuverName(name);
+        std::size_t slot = hash & (TABLE_SIZE - 1);
+        while (TABLE[slot] != EMPTY_SLOT) {
+            const Alias& alias = ALIASES[TABLE[slot]];
+            if (alias.hash == hash && alias.name == name) return alias.id;
+            slot = (slot + 1) & (TABLE_SIZE - 1);
+        }
+        return ManeuverId::Count;
+    }
+
+    static constexpr bool isValid(ManeuverId id) { return id < ManeuverId::Count; }
+
+    static constexpr std::size_t count() { return static_cast<std::size_t>(ManeuverId::Count); }
+
+    // 规范名称；id 无效时抛出 std::invalid_argument
+    static std::string_view getName(ManeuverId id) { return entry(id).name; }
+
+    // 默认参数；id 无效时返回与原工厂相同的兜底参数
+    static constexpr ManeuverDefaults getDefaults(ManeuverId id) {
+        return isValid(id) ? ManeuverRegistryDetail::ENTRIES[static_cast<std::size_t>(id)].defaults
+                           : ManeuverRegistryDetail::FALLBACK_DEFAULTS;
+    }
+
+    // 在 storage 上原位构造模型，返回的指针由调用方通过 destroy 析构。
+    // id 无效、存储不足或未对齐时抛出 std::invalid_argument。
+    static ManeuverModel* construct(ManeuverId id, void* storage, std::size_t size);
+    static void destroy(ManeuverModel* model) noexcept;
+
+    // 堆上构造（ManeuverModelFactory 使用）；id 无效时抛出 std::invalid_argument
+    static std::shared_ptr<ManeuverModel> create(ManeuverId id);
+
+private:
+    static const ManeuverRegistryDetail::Entry& entry(ManeuverId id);
+};
+
+// 调用方持有的机动模型存储：emplace 原位构造并替换当前模型，不分配堆内存
+class ManeuverSlot {
+public:
+    ManeuverSlot() : model(nullptr) {}
+    ~ManeuverSlot() { clear(); }
+
+    ManeuverSlot(const ManeuverSlot&) = delete;
+    ManeuverSlot& operator=(const ManeuverSlot&) = delete;
+
+    ManeuverModel* emplace(ManeuverId id);
+    void clear() noexcept;
+
+    ManeuverModel* get() const { return model; }
+    ManeuverId getId() const { return id; }
+
+    // 不持有所有权的 shared_ptr（别名构造，不分配控制块），供 Aircraft::setManeuverModel 使用；
+    // 调用方须保证本对象比使用者活得更久，且在 emplace/clear 后重新设置
+    std::shared_ptr<ManeuverModel> share() const { return std::shared_ptr<ManeuverModel>(std::shared_ptr<void>(), model); }
+
+private:
+    alignas(ManeuverRegistry::STORAGE_ALIGNMENT) unsigned char storage[ManeuverRegistry::STORAGE_SIZE];
+    ManeuverModel* model;
+    ManeuverId id = ManeuverId::Count;
+};
+
+#endif // MANEUVER_REGISTRY_H
@@ -0,0 +1,188 @@
+#include "ManeuverSweep.h"
+#include "FighterJet.h"
+#include "LocalTangentFrame.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+
+namespace {
+
+const double PI = 3.14159265358979323846;
+
+// splitmix64：由 (seed, 运行编号) 派生互不相关的随机流
+// 不使用 std::normal_distribution 等标准库分布（其算法随标准库实现而异），采样只取决于 seed 与运行编号。
+// Box-Muller 及仿真本身仍调用 libm 的 log/sqrt/cos 等，其结果并非正确舍入，不同C库之间不保证逐位一致。
+class SplitMix64 {
+public:
+    explicit SplitMix64(std::uint64_t seed) : state(seed) {}
+
+    std::uint64_t next() {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    // [0, 1) 均匀分布（53位尾数）
+    double uniform() { return (next() >> 11) * (1.0 / 9007199254740992.0); }
+
+    // 标准正态分布（Box-Muller）
+    double normal() {
+        double u1 = 1.0 - uniform();  // (0, 1]
+        double u2 = uniform();
+        return std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * PI * u2);
+    }
+
+private:
+    std::uint64_t state;
+};
+
+double sample(const SweepDistribution& dist, SplitMix64& rng) {
+    switch (dist.kind) {
+    case SweepDistribution::Kind::Uniform:
+        return dist.a + (dist.b - dist.a) * rng.uniform();
+    case SweepDistribution::Kind::Normal:
+        return dist.a + dist.b * rng.normal();
+    default:
+        return dist.a;
+    }
+}
+
+void validate(const SweepDistribution& dist, const char* name) {
+    if ((dist.kind == SweepDistribution::Kind::Uniform && !(dist.b >= dist.a)) ||
+        (dist.kind == SweepDistribution::Kind::Normal && !(dist.b >= 0.0))) {
+        throw std::invalid_argument(std::string("ManeuverSweep: invalid distribution for ") + name);
+    }
+}
+
+double wrapAngle(double angle) {
+    while (angle > PI) angle -= 2.0 * PI;
+    while (angle < -PI) angle += 2.0 * PI;
+    return angle;
+}
+
+} // namespace
+
+ManeuverSweepConfig::ManeuverSweepConfig(const std::string& maneuver)
+    : maneuver(maneuver), aircraftModel("F-15"),
+      origin{ 116.4074, 39.9042, 1000.0 },
+      speed(SweepDistribution::fixed(200.0)),
+      dt(0.01), steps(1000), runs(1000), seed(0) {
+    ManeuverParameters defaults = ManeuverModelFactory::getDefaultParameters(maneuver);
+    turnRate = SweepDistribution::fixed(defaults.turnRate);
+    climbRate = SweepDistribution::fixed(defaults.climbRate);
+    rollRate = SweepDistribution::fixed(defaults.rollRate);
+    pitchRate = SweepDistribution::fixed(defaults.pitchRate);
+    period = SweepDistribution::fixed(defaults.period);
+    amplitude = SweepDistribution::fixed(defaults.amplitude);
+    altitudePeriod = SweepDistribution::fixed(defaults.altitudePeriod);
+}
+
+ManeuverSweep::ManeuverSweep(const ManeuverSweepConfig& config) : config(config) {
+    if (config.runs == 0 || config.steps == 0 || !(config.dt > 0.0)) {
+        throw std::invalid_argument("ManeuverSweep: runs, steps and dt must be positive");
+    }
+    // 提前检查机动名称，避免在工作线程中才抛出
+    ManeuverModelFactory::createManeuverModel(config.maneuver);
+    validate(config.turnRate, "turnRate");
+    validate(config.climbRate, "climbRate");
+    validate(config.rollRate, "rollRate");
+    validate(config.pitchRate, "pitchRate");
+    validate(config.period, "period");
+    validate(config.amplitude, "amplitude");
+    validate(config.altitudePeriod, "altitudePeriod");
+    validate(config.altitudeOffset, "altitudeOffset");
+    validate(config.speed, "speed");
+    validate(config.heading, "heading");
+    validate(config.verticalSpeed, "verticalSpeed");
+}
+
+SweepRunResult ManeuverSweep::runSingle(std::size_t runIndex) const {
+    SplitMix64 rng(config.seed ^ (0xD1B54A32D192ED03ULL * (runIndex + 1)));
+
+    SweepRunResult result;
+    result.runIndex = runIndex;
+    ManeuverParameters& params = result.parameters;
+    params.turnRate = sample(config.turnRate, rng);
+    params.climbRate = sample(config.climbRate, rng);
+    params.rollRate = sample(config.rollRate, rng);
+    params.pitchRate = sample(config.pitchRate, rng);
+    params.period = sample(config.period, rng);
+    params.amplitude = sample(config.amplitude, rng);
+    params.altitudePeriod = sample(config.altitudePeriod, rng);
+
+    GeoPosition start = config.origin;
+    start.altitude += sample(config.altitudeOffset, rng);
+    result.initialSpeed = sample(config.speed, rng);
+    result.initialHeading = sample(config.heading, rng);
+    double verticalSpeed = sample(config.verticalSpeed, rng);
+
+    // 每次运行的一次性分配：飞机对象与机动模型
+    FighterJet aircraft(config.aircraftModel);
+    aircraft.position = start;
+    double headingRad = result.initialHeading * PI / 180.0;
+    aircraft.velocity = { result.initialSpeed * std::cos(headingRad), verticalSpeed,
+                          result.initialSpeed * std::sin(headingRad) };
+    aircraft.setManeuverModel(ManeuverModelFactory::createManeuverModel(config.maneuver));
+    aircraft.initializeManeuver(params);
+
+    // 仿真循环（与 main.cpp 相同的更新顺序），步内不分配内存
+    double minAltitude = start.altitude;
+    double maxAltitude = start.altitude;
+    double peakTurnRate = 0.0;
+    double peakClimbRate = std::abs(verticalSpeed);
+    double previousHeading = std::atan2(aircraft.velocity.east, aircraft.velocity.north);
+    for (std::size_t s = 0; s < config.steps; ++s) {
+        aircraft.updateModules(config.dt);
+        aircraft.updateManeuver(config.dt);
+        aircraft.updateKinematics(config.dt);
+
+        minAltitude = std::min(minAltitude, aircraft.position.altitude);
+        maxAltitude = std::max(maxAltitude, aircraft.position.altitude);
+        peakClimbRate = std::max(peakClimbRate, std::abs(aircraft.velocity.up));
+        double heading = std::atan2(aircraft.velocity.east, aircraft.velocity.north);
+        peakTurnRate = std::max(peakTurnRate, std::abs(wrapAngle(heading - previousHeading)) / config.dt);
+        previousHeading = heading;
+    }
+
+    Vector3 offset = LocalTangentFrame(start).toNUE(aircraft.position);
+    result.finalDisplacement = std::sqrt(offset.north * offset.north + offset.east * offset.east);
+    result.finalAltitudeChange = aircraft.position.altitude - start.altitude;
+    result.minAltitude = minAltitude;
+    result.maxAltitude = maxAltitude;
+    result.peakTurnRate = peakTurnRate;
+    result.peakClimbRate = peakClimbRate;
+    const Vector3& v = aircraft.velocity;
+    result.finalSpeed = std::sqrt(v.north * v.north + v.up * v.up + v.east * v.east);
+    return result;
+}
+
+std::vector<SweepRunResult> ManeuverSweep::run(std::size_t threadCount) const {
+    std::vector<SweepRunResult> results(config.runs);
+    ThreadPool pool(threadCount);
+    // 每次运行耗时相近但机动参数不同，块取小一些以便工作窃取均衡
+    pool.parallelFor(config.runs, 4, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            results[i] = runSingle(i);
+        }
+    });
+    return results;
+}
+
+void ManeuverSweep::writeCsv(std::ostream& out, const std::vector<SweepRunResult>& results) {
+    out << "run,turn_rate,climb_rate,roll_rate,pitch_rate,period,amplitude,altitude_period,"
+           "initial_speed,initial_heading,final_displacement,final_altitude_change,"
+           "min_altitude,max_altitude,peak_turn_rate,peak_climb_rate,final_speed\n";
+    std::streamsize oldPrecision = out.precision(10);
+    for (const SweepRunResult& r : results) {
+        const ManeuverParameters& p = r.parameters;
+        out << r.runIndex << ',' << p.turnRate << ',' << p.climbRate << ',' << p.rollRate << ','
+            << p.pitchRate << ',' << p.period << ',' << p.amplitude << ',' << p.altitudePeriod << ','
+            << r.initialSpeed << ',' << r.initialHeading << ',' << r.finalDisplacement << ','
+            << r.finalAltitudeChange << ',' << r.minAltitude << ',' << r.maxAltitude << ','
+            << r.peakTurnRate << ',' << r.peakClimbRate << ',' << r.finalSpeed << '\n';
+    }
+    out.precision(oldPrecision);
+}
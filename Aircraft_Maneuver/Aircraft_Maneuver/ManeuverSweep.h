@@ -0,0 +1,94 @@
+#ifndef MANEUVER_SWEEP_H
+#define MANEUVER_SWEEP_H
+
+#include "AircraftModelLibrary.h"
+#include "ManeuverModel.h"
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// 单个参数的取值分布：固定值 / 均匀分布 [a, b) / 正态分布 N(a, b^2)
+struct SweepDistribution {
+    enum class Kind { Fixed, Uniform, Normal };
+    Kind kind;
+    double a;
+    double b;
+
+    SweepDistribution() : kind(Kind::Fixed), a(0.0), b(0.0) {}
+    static SweepDistribution fixed(double value) { return { Kind::Fixed, value, 0.0 }; }
+    static SweepDistribution uniform(double low, double high) { return { Kind::Uniform, low, high }; }
+    static SweepDistribution normal(double mean, double stddev) { return { Kind::Normal, mean, stddev }; }
+
+private:
+    SweepDistribution(Kind kind, double a, double b) : kind(kind), a(a), b(b) {}
+};
+
+// 蒙特卡洛扫描配置：机动参数分布 + 初始状态扰动
+struct ManeuverSweepConfig {
+    std::string maneuver;              // 机动名称（见 ManeuverModelFactory）
+    std::string aircraftModel;         // 战斗机型号
+
+    // 机动参数分布（默认固定为 getDefaultParameters(maneuver) 的值）
+    SweepDistribution turnRate;
+    SweepDistribution climbRate;
+    SweepDistribution rollRate;
+    SweepDistribution pitchRate;
+    SweepDistribution period;
+    SweepDistribution amplitude;
+    SweepDistribution altitudePeriod;
+
+    // 初始状态：基准位置 + 高度偏移、速度大小、航向（度，北偏东）、垂直速度的分布
+    GeoPosition origin;
+    SweepDistribution altitudeOffset;
+    SweepDistribution speed;
+    SweepDistribution heading;
+    SweepDistribution verticalSpeed;
+
+    double dt;
+    std::size_t steps;
+    std::size_t runs;
+    std::uint64_t seed;                // 第 i 次运行的随机数只由 (seed, i) 决定
+
+    explicit ManeuverSweepConfig(const std::string& maneuver);
+};
+
+// 单次运行的汇总指标
+struct SweepRunResult {
+    std::size_t runIndex;
+    ManeuverParameters parameters;     // 本次采样的机动参数
+    double initialSpeed;               // 初始速度大小 (m/s)
+    double initialHeading;             // 初始航向 (度)
+    double finalDisplacement;          // 终点相对起点的水平位移 (m)
+    double finalAltitudeChange;        // 终点相对起点的高度变化 (m)
+    double minAltitude;                // 最低高度 (m)
+    double maxAltitude;                // 最高高度 (m)
+    double peakTurnRate;               // 航向变化率绝对值的峰值 (rad/s)
+    double peakClimbRate;              // 垂直速度绝对值的峰值 (m/s)
+    double finalSpeed;                 // 终点速度大小 (m/s)
+};
+
+// 并行蒙特卡洛扫描：对机动参数和初始状态采样，独立运行大量机动仿真并收集汇总指标
+// 每次运行只在开始时分配（飞机、机动模型），仿真步内不分配内存；
+// 随机数按运行编号独立派生（splitmix64），结果与线程数、调度顺序无关。
+class ManeuverSweep {
+public:
+    explicit ManeuverSweep(const ManeuverSweepConfig& config);
+
+    const ManeuverSweepConfig& getConfig() const { return config; }
+
+    // 并行执行全部运行，threadCount 为0时使用硬件线程数；结果按运行编号排列
+    std::vector<SweepRunResult> run(std::size_t threadCount = 0) const;
+
+    // 执行单次运行（与 run() 中相同编号的结果逐位一致）
+    SweepRunResult runSingle(std::size_t runIndex) const;
+
+    // 以CSV表格输出结果（首行为列名）
+    static void writeCsv(std::ostream& out, const std::vector<SweepRunResult>& results);
+
+private:
+    ManeuverSweepConfig config;
+};
+
+#endif // MANEUVER_SWEEP_H
@@ -0,0 +1,317 @@
+#include "ManeuverTemplate.h"
+#include "EulerAngleCalculation.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+// 游标向前顺序扫描的最大区间数，超过则改用二分查找（大步长跳转仍为 O(log n)）
+const std::size_t CURSOR_SCAN_LIMIT = 4;
+
+std::map<std::string, std::shared_ptr<const ManeuverTemplate>> makeBuiltinTemplates() {
+    const ManeuverTemplate builtins[] = {
+        ManeuverTemplates::createLoopManeuver(),
+        ManeuverTemplates::createRollManeuver(),
+        ManeuverTemplates::createSManeuver(),
+        ManeuverTemplates::createSnakeManeuver(),
+        ManeuverTemplates::createCobraManeuver(),
+        ManeuverTemplates::createScissorsManeuver(),
+        ManeuverTemplates::createBarrelRollManeuver(),
+        ManeuverTemplates::createHighGTurnManeuver(),
+        ManeuverTemplates::createVerticalClimbManeuver(),
+        ManeuverTemplates::createDiveAttackManeuver(),
+    };
+    std::map<std::string, std::shared_ptr<const ManeuverTemplate>> result;
+    for (const ManeuverTemplate& t : builtins) {
+        result[t.getName()] = std::make_shared<const ManeuverTemplate>(t);
+    }
+    return result;
+}
+
+} // namespace
+
+// ManeuverTemplate实现
+ManeuverTemplate::ManeuverTemplate(const std::string& name, const std::vector<ManeuverPoint>& points)
+    : name(name), points(points) {
+    if (points.empty()) {
+        throw std::invalid_argument("ManeuverTemplate '" + name + "': no maneuver points");
+    }
+    for (std::size_t i = 1; i < points.size(); ++i) {
+        if (!(points[i].time >= points[i - 1].time)) {
+            throw std::invalid_argument("ManeuverTemplate '" + name + "': point times must be non-decreasing");
+        }
+    }
+}
+
+std::size_t ManeuverTemplate::findSegment(double currentTime) const {
+    // 最后一个 time <= currentTime 的点，限制在 [0, size-2]
+    auto it = std::upper_bound(points.begin(), points.end(), currentTime,
+                               [](double t, const ManeuverPoint& p) { return t < p.time; });
+    std::size_t index = it == points.begin() ? 0 : static_cast<std::size_t>(it - points.begin()) - 1;
+    return std::min(index, points.size() - 2);
+}
+
+ManeuverPoint ManeuverTemplate::interpolate(double currentTime, std::size_t segment) const {
+    if (points.size() == 1 || currentTime <= points.front().time) return points.front();
+    if (currentTime >= points.back().time) return points.back();
+    const ManeuverPoint& a = points[segment];
+    const ManeuverPoint& b = points[segment + 1];
+    double span = b.time - a.time;
+    if (span <= 0.0) return b;
+    double u = (currentTime - a.time) / span;
+    return ManeuverPoint(currentTime,
+                         a.turnRate + u * (b.turnRate - a.turnRate),
+                         a.climbRate + u * (b.climbRate - a.climbRate),
+                         a.rollRate + u * (b.rollRate - a.rollRate),
+                         a.pitchRate + u * (b.pitchRate - a.pitchRate),
+                         a.yawRate + u * (b.yawRate - a.yawRate));
+}
+
+ManeuverPoint ManeuverTemplate::evaluate(double currentTime) const {
+    if (points.size() == 1) return points.front();
+    return interpolate(currentTime, findSegment(currentTime));
+}
+
+ManeuverPoint ManeuverTemplate::evaluate(double currentTime, Cursor& cursor) const {
+    if (points.size() == 1) return points.front();
+    const std::size_t last = points.size() - 2;   // 最后一个区间
+    std::size_t segment = std::min(cursor.segment, last);
+    if (currentTime >= points[segment].time) {
+        // 时间前进：先顺序推进少量区间，仍未到达再二分
+        std::size_t scanned = 0;
+        while (segment < last && currentTime >= points[segment + 1].time && scanned < CURSOR_SCAN_LIMIT) {
+            ++segment;
+            ++scanned;
+        }
+        if (segment < last && currentTime >= points[segment + 1].time) {
+            segment = findSegment(currentTime);
+        }
+    } else {
+        // 时间回退（随机访问）
+        segment = findSegment(currentTime);
+    }
+    cursor.segment = segment;
+    return interpolate(currentTime, segment);
+}
+
+ManeuverParameters ManeuverTemplate::interpolateParameters(double currentTime) const {
+    Cursor cursor;
+    cursor.segment = points.size() > 1 ? findSegment(currentTime) : 0;
+    return interpolateParameters(currentTime, cursor);
+}
+
+ManeuverParameters ManeuverTemplate::interpolateParameters(double currentTime, Cursor& cursor) const {
+    ManeuverPoint point = evaluate(currentTime, cursor);
+    ManeuverParameters params;
+    params.turnRate = point.turnRate;
+    params.climbRate = point.climbRate;
+    params.rollRate = point.rollRate;
+    params.pitchRate = point.pitchRate;
+    params.period = getDuration();
+    params.amplitude = 1.0;
+    params.altitudePeriod = 0.0;
+    return params;
+}
+
+bool ManeuverTemplate::isCompleted(double currentTime) const {
+    return currentTime >= points.back().time;
+}
+
+double ManeuverTemplate::getDuration() const {
+    return points.back().time - points.front().time;
+}
+
+// TemplateManeuverModel实现
+TemplateManeuverModel::TemplateManeuverModel(std::shared_ptr<const ManeuverTemplate> maneuverTemplate)
+    : maneuverTemplate(std::move(maneuverTemplate)) {
+    if (!this->maneuverTemplate) {
+        throw std::invalid_argument("TemplateManeuverModel: null template");
+    }
+}
+
+void TemplateManeuverModel::initialize(const ManeuverParameters& params) {
+    scale = params.amplitude;
+    reset();
+}
+
+void TemplateManeuverModel::update(Aircraft& aircraft, double dt) {
+    totalTime += dt;
+    const ManeuverPoint point = maneuverTemplate->evaluate(totalTime, cursor);
+    const auto& perf = aircraft.getPerformance();
+
+    // 航向按转向速率旋转，垂直速度取爬升速率
+    double turnAngle = scale * point.turnRate * perf.maxTurnRate * dt;
+    double north = aircraft.velocity.north;
+    double east = aircraft.velocity.east;
+    if (north * north + east * east > 1e-6) {
+        double cosTurn = std::cos(turnAngle);
+        double sinTurn = std::sin(turnAngle);
+        aircraft.velocity.north = north * cosTurn - east * sinTurn;
+        aircraft.velocity.east = north * sinTurn + east * cosTurn;
+    }
+    aircraft.velocity.up = scale * point.climbRate * perf.maxClimbRate;
+
+    // 姿态角按滚转/俯仰/偏航速率积分（偏航速率以最大转弯率为上限），偏航同时跟随航向变化
+    AttitudeAngles attitude = aircraft.getAttitude();
+    attitude.roll += scale * point.rollRate * perf.maxRollRate * dt;
+    attitude.pitch += scale * point.pitchRate * perf.maxPitchRate * dt;
+    attitude.yaw += turnAngle + scale * point.yawRate * perf.maxTurnRate * dt;
+    aircraft.setAttitude(EulerAngleCalculator::limitAttitudeAngles(attitude));
+}
+
+void TemplateManeuverModel::reset() {
+    totalTime = 0.0;
+    cursor = ManeuverTemplate::Cursor();
+}
+
+// 预定义机动模板（速率为性能上限的比例）
+ManeuverTemplate ManeuverTemplates::createLoopManeuver() {
+    return ManeuverTemplate("loop", {
+        ManeuverPoint(0.0, 0.0, 0.0),
+        ManeuverPoint(1.0, 0.0, 0.8, 0.0, 0.6),
+        ManeuverPoint(5.0, 0.0, 0.8, 0.0, 0.8),
+        ManeuverPoint(7.0, 0.0, -0.6, 0.0, 0.8),
+        ManeuverPoint(10.0, 0.0, -0.2, 0.0, 0.2),
+        ManeuverPoint(11.0, 0.0, 0.0),
+    });
+}
+
+ManeuverTemplate ManeuverTemplates::createRollManeuver() {
+    return ManeuverTemplate("roll", {
+        ManeuverPoint(0.0, 0.0, 0.0),
+        ManeuverPoint(0.5, 0.0, 0.0, 0.8),
+        ManeuverPoint(2.5, 0.0, 0.0, 0.8),
+        ManeuverPoint(3.0, 0.0, 0.0),
+    });
+}
+
+ManeuverTemplate ManeuverTemplates::createSManeuver() {
+    return ManeuverTemplate("s", {
+        ManeuverPoint(0.0, 0.0, 0.0),
+        ManeuverPoint(1.0, 0.6, 0.0, 0.4),
+        ManeuverPoint(3.0, 0.6, 0.0, 0.0),
+        ManeuverPoint(4.0, -0.6, 0.0, -0.4),
+        ManeuverPoint(6.0, -0.6, 0.0, 0.0),
+        ManeuverPoint(7.0, 0.0, 0.0),
+    });
+}
+
+ManeuverTemplate ManeuverTemplates::createSnakeManeuver() {
+    std::vector<ManeuverPoint> points;
+    points.emplace_back(0.0, 0.0, 0.0);
+    for (int i = 0; i < 6; ++i) {
+        double sign = (i % 2 == 0) ? 1.0 : -1.0;
+        points.emplace_back(1.0 + 2.0 * i, 0.8 * sign, 0.0, 0.5 * sign);
+        points.emplace_back(2.0 + 2.0 * i, 0.8 * sign, 0.0, -0.5 * sign);
+    }
+    points.emplace_back(13.0, 0.0, 0.0);
+    return ManeuverTemplate("snake", points);
+}
+
+ManeuverTemplate ManeuverTemplates::createCobraManeuver() {
+    // 眼镜蛇：急速拉起至大迎角后压头恢复，航向不变
+    return ManeuverTemplate("cobra", {
+        ManeuverPoint(0.0, 0.0, 0.0),
+        ManeuverPoint(0.3, 0.0, 0.2, 0.0, 1.0),
+        ManeuverPoint(1.2, 0.0, 0.1, 0.0, 1.0),
+        ManeuverPoint(1.8, 0.0, 0.0, 0.0, -1.0),
+        ManeuverPoint(2.8, 0.0, 0.0, 0.0, -0.6),
+        ManeuverPoint(3.5, 0.0, 0.0),
+    });
+}
+
+ManeuverTemplate ManeuverTemplates::createScissorsManeuver() {
+    // 剪刀：连续大坡度反向转弯，每次反转前先反向滚转
+    std::vector<ManeuverPoint> points;
+    points.emplace_back(0.0, 0.0, 0.0);
+    for (int i = 0; i < 5; ++i) {
+        double sign = (i % 2 == 0) ? 1.0 : -1.0;
+        double t = 3.0 * i;
+        points.emplace_back(t + 0.5, 0.0, 0.0, 1.0 * sign);
+        points.emplace_back(t + 1.0, 0.9 * sign, -0.1, 0.0, 0.3);
+        points.emplace_back(t + 2.5, 0.9 * sign, -0.1, 0.0, 0.3);
+        points.emplace_back(t + 3.0, 0.0, 0.0, -1.0 * sign);
+    }
+    points.emplace_back(15.5, 0.0, 0.0);
+    return ManeuverTemplate("scissors", points);
+}
+
+ManeuverTemplate ManeuverTemplates::createBarrelRollManeuver() {
+    return ManeuverTemplate("barrel_roll", {
+        ManeuverPoint(0.0, 0.0, 0.0),
+        ManeuverPoint(0.5, 0.1, 0.4, 0.9, 0.4),
+        ManeuverPoint(2.0, 0.1, 0.0, 0.9, 0.0),
+        ManeuverPoint(3.5, 0.1, -0.4, 0.9, -0.4),
+        ManeuverPoint(4.0, 0.0, 0.0),
+    });
+}
+
+ManeuverTemplate ManeuverTemplates::createHighGTurnManeuver() {
+    return ManeuverTemplate("high_g_turn", {
+        ManeuverPoint(0.0, 0.0, 0.0),
+        ManeuverPoint(0.5, 0.2, 0.0, 1.0),
+        ManeuverPoint(1.0, 1.0, 0.05, 0.0, 0.5),
+        ManeuverPoint(7.0, 1.0, 0.05, 0.0, 0.5),
+        ManeuverPoint(7.5, 0.2, 0.0, -1.0),
+        ManeuverPoint(8.0, 0.0, 0.0),
+    });
+}
+
+ManeuverTemplate ManeuverTemplates::createVerticalClimbManeuver() {
+    return ManeuverTemplate("vertical_climb", {
+        ManeuverPoint(0.0, 0.0, 0.0),
+        ManeuverPoint(1.5, 0.0, 0.6, 0.0, 1.0),
+        ManeuverPoint(3.0, 0.0, 1.0, 0.0, 0.0),
+        ManeuverPoint(10.0, 0.0, 1.0, 0.0, 0.0),
+        ManeuverPoint(12.0, 0.0, 0.0, 0.0, -1.0),
+        ManeuverPoint(13.0, 0.0, 0.0),
+    });
+}
+
+ManeuverTemplate ManeuverTemplates::createDiveAttackManeuver() {
+    // 俯冲攻击：翻转压头进入俯冲，稳定瞄准后拉起退出
+    return ManeuverTemplate("dive_attack", {
+        ManeuverPoint(0.0, 0.0, 0.0),
+        ManeuverPoint(0.5, 0.0, 0.0, 1.0),
+        ManeuverPoint(1.5, 0.0, -0.5, -1.0, -0.8),
+        ManeuverPoint(3.0, 0.0, -1.0, 0.0, -0.2),
+        ManeuverPoint(6.0, 0.0, -1.0, 0.0, 0.0),
+        ManeuverPoint(7.0, 0.0, 0.0, 0.0, 1.0),
+        ManeuverPoint(9.0, 0.0, 0.6, 0.0, 0.0),
+        ManeuverPoint(10.0, 0.0, 0.0),
+    });
+}
+
+// ManeuverTemplateManager实现
+std::map<std::string, std::shared_ptr<const ManeuverTemplate>> ManeuverTemplateManager::templates = makeBuiltinTemplates();
+
+void ManeuverTemplateManager::registerTemplate(const ManeuverTemplate& template_) {
+    templates[template_.getName()] = std::make_shared<const ManeuverTemplate>(template_);
+}
+
+std::shared_ptr<const ManeuverTemplate> ManeuverTemplateManager::findTemplate(const std::string& name) {
+    auto it = templates.find(name);
+    if (it == templates.end()) {
+        throw std::invalid_argument("Unknown maneuver template: " + name);
+    }
+    return it->second;
+}
+
+ManeuverTemplate ManeuverTemplateManager::getTemplate(const std::string& name) {
+    return *findTemplate(name);
+}
+
+std::vector<std::string> ManeuverTemplateManager::getAvailableTemplates() {
+    std::vector<std::string> names;
+    names.reserve(templates.size());
+    for (const auto& pair : templates) {
+        names.push_back(pair.first);
+    }
+    return names;
+}
+
+std::shared_ptr<ManeuverModel> ManeuverTemplateManager::createManeuverModel(const std::string& templateName) {
+    return std::make_shared<TemplateManeuverModel>(findTemplate(templateName));
+}
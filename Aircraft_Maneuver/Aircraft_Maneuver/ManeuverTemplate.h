@@ -2,12 +2,17 @@
 #define MANEUVER_TEMPLATE_H
 
 #include "AircraftModelLibrary.h"
+#include "ManeuverModel.h"
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
 #include <vector>
 #include <functional>
 
-// 机动点结构体
+// 机动点结构体（速率为相对飞机性能上限的比例，与 ManeuverParameters 相同）
 struct ManeuverPoint {
-    double time;           // 时间点
+    double time;           // 时间点（秒，自机动开始）
     double turnRate;       // 转向速率
     double climbRate;      // 爬升速率
     double rollRate;       // 滚转速率
@@ -21,9 +26,16 @@ struct ManeuverPoint {
 };
 
 // 通用机动模板类
+// 机动点之间线性插值，首点之前取首点、末点之后保持末点。
+// 带游标的求值记住上次所在区间：时间单调前进时均摊O(1)，只有随机跳转才做二分查找。
 class ManeuverTemplate {
 public:
-    // 构造函数
+    // 顺序求值游标，每架飞机（每个模型实例）各持有一个
+    struct Cursor {
+        std::size_t segment = 0;   // 上次所在区间 [points[segment], points[segment + 1])
+    };
+
+    // 构造函数；机动点为空或时间不单调不减时抛出 std::invalid_argument
     ManeuverTemplate(const std::string& name, const std::vector<ManeuverPoint>& points);
     
     // 获取机动名称
@@ -32,8 +44,13 @@ public:
     // 获取机动点序列
     const std::vector<ManeuverPoint>& getPoints() const { return points; }
     
-    // 计算指定时间的机动参数
+    // 计算指定时间的插值机动点（无游标版本每次二分查找）
+    ManeuverPoint evaluate(double currentTime) const;
+    ManeuverPoint evaluate(double currentTime, Cursor& cursor) const;
+
+    // 计算指定时间的机动参数（转向/爬升/滚转/俯仰比例取插值结果，period 为模板时长）
     ManeuverParameters interpolateParameters(double currentTime) const;
+    ManeuverParameters interpolateParameters(double currentTime, Cursor& cursor) const;
     
     // 检查机动是否完成
     bool isCompleted(double currentTime) const;
@@ -42,10 +59,35 @@ public:
     double getDuration() const;
 
 private:
+    std::size_t findSegment(double currentTime) const;
+    ManeuverPoint interpolate(double currentTime, std::size_t segment) const;
+
     std::string name;
     std::vector<ManeuverPoint> points;
 };
 
+// 由模板驱动的机动模型：按机动点插值结果转向、爬升并积分姿态角
+// 模板以 shared_ptr 共享，多架飞机使用同一长模板时不复制机动点；每个实例只保存自己的时间与游标
+class TemplateManeuverModel : public ManeuverModel {
+public:
+    explicit TemplateManeuverModel(std::shared_ptr<const ManeuverTemplate> maneuverTemplate);
+
+    // params.amplitude 作为模板全部速率的整体缩放
+    void initialize(const ManeuverParameters& params) override;
+    void update(Aircraft& aircraft, double dt) override;
+    std::string getName() const override { return "Template: " + maneuverTemplate->getName(); }
+    void reset() override;
+
+    bool isCompleted() const { return maneuverTemplate->isCompleted(totalTime); }
+    const ManeuverTemplate& getTemplate() const { return *maneuverTemplate; }
+
+private:
+    std::shared_ptr<const ManeuverTemplate> maneuverTemplate;
+    ManeuverTemplate::Cursor cursor;
+    double totalTime = 0.0;
+    double scale = 1.0;
+};
+
 // 预定义机动模板
 class ManeuverTemplates {
 public:
@@ -80,23 +122,26 @@ public:
     static ManeuverTemplate createDiveAttackManeuver();
 };
 
-// 机动模板管理器
+// 机动模板管理器（预置 ManeuverTemplates 中的全部模板）
+// 注册不加锁：应在仿真线程启动前完成，之后的查询可并发进行
 class ManeuverTemplateManager {
 public:
-    // 注册机动模板
+    // 注册机动模板（同名覆盖）
     static void registerTemplate(const ManeuverTemplate& template_);
     
-    // 获取机动模板
+    // 获取机动模板；名称不存在时抛出 std::invalid_argument
     static ManeuverTemplate getTemplate(const std::string& name);
     
     // 获取所有可用模板名称
     static std::vector<std::string> getAvailableTemplates();
     
-    // 创建机动模型
+    // 创建机动模型（共享已注册的模板）；名称不存在时抛出 std::invalid_argument
     static std::shared_ptr<ManeuverModel> createManeuverModel(const std::string& templateName);
 
 private:
-    static std::map<std::string, ManeuverTemplate> templates;
+    static std::shared_ptr<const ManeuverTemplate> findTemplate(const std::string& name);
+
+    static std::map<std::string, std::shared_ptr<const ManeuverTemplate>> templates;
 };
 
 #endif // MANEUVER_TEMPLATE_H 
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include "ModuleRegistry.h"
+#include "AircraftModelLibrary.h"
+#include <atomic>
+
+std::size_t ModuleRegistryDetail::nextTypeId() {
+    static std::atomic<std::size_t> counter{ 0 };
+    return counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+EntityId ModuleRegistry::createEntity(Aircraft& owner) {
+    if (!freeIds.empty()) {
+        EntityId entity = freeIds.back();
+        freeIds.pop_back();
+        aircraft[entity] = &owner;
+        return entity;
+    }
+    if (aircraft.size() >= ModulePool<int>::NONE) {
+        throw std::invalid_argument("ModuleRegistry: too many entities");
+    }
+    aircraft.push_back(&owner);
+    return static_cast<EntityId>(aircraft.size() - 1);
+}
+
+void ModuleRegistry::destroyEntity(EntityId entity) {
+    checkEntity(entity);
+    for (auto& p : pools) {
+        if (p) p->erase(entity);
+    }
+    aircraft[entity] = nullptr;
+    freeIds.push_back(entity);
+}
+
+Aircraft& ModuleRegistry::getAircraft(EntityId entity) const {
+    checkEntity(entity);
+    return *aircraft[entity];
+}
+
+void ModuleRegistry::checkEntity(EntityId entity) const {
+    if (!isAlive(entity)) {
+        throw std::invalid_argument("ModuleRegistry: entity " + std::to_string(entity) + " does not exist");
+    }
+}
+
+std::size_t ModuleRegistry::adoptModules(EntityId entity) {
+    const auto& modules = getAircraft(entity).getModules();
+    if (modules.empty()) {
+        remove<LegacyModuleList>(entity);
+        return 0;
+    }
+    LegacyModuleList* list = get<LegacyModuleList>(entity);
+    if (!list) list = &add<LegacyModuleList>(entity);
+    list->modules = modules;
+
+    std::size_t id = ModuleRegistryDetail::typeId<LegacyModuleList>();
+    if (id >= moduleSystems.size()) moduleSystems.resize(id + 1, false);
+    if (!moduleSystems[id]) {
+        moduleSystems[id] = true;
+        addSystem<LegacyModuleList>([](Aircraft& owner, LegacyModuleList& legacy, double dt) {
+            for (auto& m : legacy.modules) m->update(owner, dt);
+        });
+    }
+    return modules.size();
+}
+
+void ModuleRegistry::update(double dt) {
+    for (auto& system : systems) {
+        system(dt);
+    }
+}
@@ -0,0 +1,208 @@
+#ifndef MODULE_REGISTRY_H
+#define MODULE_REGISTRY_H
+
+#include "AircraftModule.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// 实体编号：一架飞机在 ModuleRegistry 中的下标
+using EntityId = std::uint32_t;
+
+namespace ModuleRegistryDetail {
+
+// 为每个组件类型分配进程内唯一的连续编号（首次使用该类型时分配）
+std::size_t nextTypeId();
+
+template<class T>
+std::size_t typeId() {
+    static const std::size_t id = nextTypeId();
+    return id;
+}
+
+} // namespace ModuleRegistryDetail
+
+class ModulePoolBase {
+public:
+    virtual ~ModulePoolBase() = default;
+    virtual bool erase(EntityId entity) = 0;
+    virtual std::size_t size() const = 0;
+};
+
+// 单一类型组件的稠密存储（稀疏集合）：组件与所属实体各自连续存放，
+// sparse 按实体编号索引到稠密下标，查找、添加、删除均为 O(1)。删除时把末尾元素移到空位，
+// 因此添加、删除会使已取得的组件指针与遍历顺序失效。
+template<class T>
+class ModulePool : public ModulePoolBase {
+public:
+    static constexpr std::uint32_t NONE = std::numeric_limits<std::uint32_t>::max();
+
+    T* find(EntityId entity) {
+        return entity < sparse.size() && sparse[entity] != NONE ? &components[sparse[entity]] : nullptr;
+    }
+    const T* find(EntityId entity) const {
+        return entity < sparse.size() && sparse[entity] != NONE ? &components[sparse[entity]] : nullptr;
+    }
+
+    template<class... Args>
+    T& emplace(EntityId entity, Args&&... args) {
+        if (entity >= sparse.size()) sparse.resize(static_cast<std::size_t>(entity) + 1, NONE);
+        components.emplace_back(std::forward<Args>(args)...);
+        owners.push_back(entity);
+        sparse[entity] = static_cast<std::uint32_t>(components.size() - 1);
+        return components.back();
+    }
+
+    bool erase(EntityId entity) override {
+        if (entity >= sparse.size() || sparse[entity] == NONE) return false;
+        std::uint32_t index = sparse[entity];
+        std::uint32_t last = static_cast<std::uint32_t>(components.size() - 1);
+        if (index != last) {
+            components[index] = std::move(components[last]);
+            owners[index] = owners[last];
+            sparse[owners[index]] = index;
+        }
+        components.pop_back();
+        owners.pop_back();
+        sparse[entity] = NONE;
+        return true;
+    }
+
+    std::size_t size() const override { return components.size(); }
+    T* data() { return components.data(); }
+    const T* data() const { return components.data(); }
+    const EntityId* entities() const { return owners.data(); }
+
+private:
+    std::vector<T> components;
+    std::vector<EntityId> owners;        // 与 components 一一对应
+    std::vector<std::uint32_t> sparse;   // 实体编号 -> 稠密下标
+};
+
+// 兼容路径：未改为按类型存储的模块（如已通过 Aircraft::addModule 挂载的 shared_ptr 模块）
+// 整体作为一个组件，由同一个系统逐个虚函数调用 update
+struct LegacyModuleList {
+    std::vector<std::shared_ptr<AircraftModule>> modules;
+};
+
+// 功能模块的实体-组件存储：每架飞机是一个实体，每种模块（组件）类型一个稠密池，按类型编号直接索引，
+// get<T>(entity) 为两次数组下标访问，不做 dynamic_pointer_cast 或线性查找。
+// 系统按类型注册，update 时每个系统在一个连续循环中处理持有该类型组件的所有飞机
+// （例如所有 JammerModule 一次更新完），系统之间按注册顺序执行。
+// 已有的 AircraftModule 子类无需修改即可用 addModule<T> 按值存入池中，其 update 由自动注册的系统调用
+// （按具体类型直接调用，不经虚函数表）；仍以 shared_ptr 持有的模块可用 adoptModules 接入。
+// 非线程安全；注册表不持有飞机，飞机须比其实体存活更久。
+class ModuleRegistry {
+public:
+    ModuleRegistry() = default;
+    // 系统引用注册表自身与各池，不可复制或移动
+    ModuleRegistry(const ModuleRegistry&) = delete;
+    ModuleRegistry& operator=(const ModuleRegistry&) = delete;
+
+    // 创建实体（复用已销毁实体的编号）；销毁实体时删除其全部组件
+    EntityId createEntity(Aircraft& aircraft);
+    void destroyEntity(EntityId entity);
+    bool isAlive(EntityId entity) const { return entity < aircraft.size() && aircraft[entity] != nullptr; }
+    std::size_t entityCount() const { return aircraft.size() - freeIds.size(); }
+    // 实体不存在时抛出 std::invalid_argument
+    Aircraft& getAircraft(EntityId entity) const;
+
+    // 添加组件；实体不存在或已有该类型组件时抛出 std::invalid_argument
+    template<class T, class... Args>
+    T& add(EntityId entity, Args&&... args) {
+        checkEntity(entity);
+        ModulePool<T>& p = pool<T>();
+        if (p.find(entity)) {
+            throw std::invalid_argument("ModuleRegistry: entity " + std::to_string(entity) + " already has this component");
+        }
+        return p.emplace(entity, std::forward<Args>(args)...);
+    }
+
+    // 添加 AircraftModule 子类组件，并在该类型第一次添加时注册调用其 update 的系统
+    template<class T, class... Args>
+    T& addModule(EntityId entity, Args&&... args) {
+        static_assert(std::is_base_of<AircraftModule, T>::value, "ModuleRegistry::addModule requires an AircraftModule");
+        T& module = add<T>(entity, std::forward<Args>(args)...);
+        std::size_t id = ModuleRegistryDetail::typeId<T>();
+        if (id >= moduleSystems.size()) moduleSystems.resize(id + 1, false);
+        if (!moduleSystems[id]) {
+            moduleSystems[id] = true;
+            addSystem<T>([](Aircraft& owner, T& m, double dt) { m.T::update(owner, dt); });
+        }
+        return module;
+    }
+
+    // 兼容路径：把飞机上已挂载的 shared_ptr 模块接入注册表（与原模块共享实例，之后不应再调用 updateModules），
+    // 重复调用时以飞机当前的模块列表为准，返回接入的模块数
+    std::size_t adoptModules(EntityId entity);
+
+    template<class T>
+    bool remove(EntityId entity) {
+        ModulePool<T>* p = findPool<T>();
+        return p && p->erase(entity);
+    }
+
+    // O(1) 类型化访问，没有该组件时返回 nullptr
+    template<class T>
+    T* get(EntityId entity) {
+        ModulePool<T>* p = findPool<T>();
+        return p ? p->find(entity) : nullptr;
+    }
+    template<class T>
+    const T* get(EntityId entity) const {
+        const ModulePool<T>* p = findPool<T>();
+        return p ? p->find(entity) : nullptr;
+    }
+    template<class T>
+    bool has(EntityId entity) const { return get<T>(entity) != nullptr; }
+
+    // 取得类型 T 的池（不存在时创建）
+    template<class T>
+    ModulePool<T>& pool() {
+        std::size_t id = ModuleRegistryDetail::typeId<T>();
+        if (id >= pools.size()) pools.resize(id + 1);
+        if (!pools[id]) pools[id].reset(new ModulePool<T>());
+        return static_cast<ModulePool<T>&>(*pools[id]);
+    }
+
+    // 注册系统：update 时对持有 T 的每个实体调用 f(Aircraft&, T&, dt)，f 在循环内内联
+    template<class T, class F>
+    void addSystem(F f) {
+        ModulePool<T>* p = &pool<T>();
+        systems.push_back([this, p, f](double dt) mutable {
+            T* components = p->data();
+            const EntityId* owners = p->entities();
+            for (std::size_t i = 0, n = p->size(); i < n; ++i) {
+                f(*aircraft[owners[i]], components[i], dt);
+            }
+        });
+    }
+
+    // 按注册顺序执行所有系统
+    void update(double dt);
+    std::size_t systemCount() const { return systems.size(); }
+
+private:
+    template<class T>
+    ModulePool<T>* findPool() const {
+        std::size_t id = ModuleRegistryDetail::typeId<T>();
+        return id < pools.size() ? static_cast<ModulePool<T>*>(pools[id].get()) : nullptr;
+    }
+
+    void checkEntity(EntityId entity) const;
+
+    std::vector<Aircraft*> aircraft;     // 按实体编号索引，已销毁为 nullptr
+    std::vector<EntityId> freeIds;
+    std::vector<std::unique_ptr<ModulePoolBase>> pools;   // 按类型编号索引
+    std::vector<bool> moduleSystems;     // 按类型编号记录是否已注册模块系统
+    std::vector<std::function<void(double)>> systems;
+};
+
+#endif // MODULE_REGISTRY_H
@@ -0,0 +1,114 @@
+#include "MultiRateScheduler.h"
+#include "AircraftModelLibrary.h"
+#include "AircraftModule.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <ostream>
+#include <stdexcept>
+
+MultiRateScheduler::MultiRateScheduler(double tickRate)
+    : tickRate(tickRate) {
+    if (!(tickRate > 0.0) || !std::isfinite(tickRate)) {
+        throw std::invalid_argument("MultiRateScheduler: tickRate must be positive");
+    }
+}
+
+std::size_t MultiRateScheduler::addStage(const std::string& name, double rate, std::uint64_t phase, StageFunc func) {
+    if (!func) {
+        throw std::invalid_argument("MultiRateScheduler: stage '" + name + "' has no function");
+    }
+    // 周期须为整数个节拍（允许频率本身的浮点舍入）
+    double ticks = tickRate / rate;
+    double period = std::round(ticks);
+    if (!(rate > 0.0) || !(period >= 1.0) || std::abs(ticks - period) > 1e-9 * period) {
+        throw std::invalid_argument("MultiRateScheduler: rate of stage '" + name +
+                                    "' must divide the tick rate");
+    }
+    Stage stage;
+    stage.stats.name = name;
+    stage.stats.period = static_cast<std::uint64_t>(period);
+    stage.stats.rate = tickRate / period;
+    stage.stats.phase = phase;
+    if (phase >= stage.stats.period) {
+        throw std::invalid_argument("MultiRateScheduler: phase of stage '" + name + "' must be less than its period");
+    }
+    stage.stats.runs = 0;
+    stage.stats.totalSeconds = 0.0;
+    stage.stats.maxSeconds = 0.0;
+    stage.func = std::move(func);
+    stage.dt = period / tickRate;
+    // 运行中途注册的阶段从当前节拍起第一个满足相位的节拍开始
+    stage.nextTick = tick + (phase + stage.stats.period - tick % stage.stats.period) % stage.stats.period;
+    stages.push_back(std::move(stage));
+    return stages.size() - 1;
+}
+
+std::size_t MultiRateScheduler::addModule(Aircraft& aircraft, std::shared_ptr<AircraftModule> module, double rate,
+                                          std::uint64_t phase) {
+    if (!module) {
+        throw std::invalid_argument("MultiRateScheduler: module is null");
+    }
+    std::string name = module->getModuleName();
+    return addStage(name, rate, phase, [&aircraft, module](double, double dt) { module->update(aircraft, dt); });
+}
+
+void MultiRateScheduler::step() {
+    const double endTime = static_cast<double>(tick + 1) / tickRate;
+    for (Stage& stage : stages) {
+        if (stage.nextTick != tick) continue;
+        auto start = std::chrono::steady_clock::now();
+        stage.func(endTime, stage.dt);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        stage.nextTick += stage.stats.period;
+        ++stage.stats.runs;
+        stage.stats.totalSeconds += seconds;
+        stage.stats.maxSeconds = std::max(stage.stats.maxSeconds, seconds);
+    }
+    ++tick;
+}
+
+void MultiRateScheduler::run(std::uint64_t ticks) {
+    for (std::uint64_t i = 0; i < ticks; ++i) {
+        step();
+    }
+}
+
+const MultiRateScheduler::StageStats& MultiRateScheduler::getStats(std::size_t stage) const {
+    if (stage >= stages.size()) {
+        throw std::invalid_argument("MultiRateScheduler: stage " + std::to_string(stage) + " out of range");
+    }
+    return stages[stage].stats;
+}
+
+void MultiRateScheduler::resetStats() {
+    for (Stage& stage : stages) {
+        stage.stats.runs = 0;
+        stage.stats.totalSeconds = 0.0;
+        stage.stats.maxSeconds = 0.0;
+    }
+}
+
+void MultiRateScheduler::printReport(std::ostream& os) const {
+    double total = 0.0;
+    for (const Stage& stage : stages) total += stage.stats.totalSeconds;
+    std::ios_base::fmtflags flags = os.flags();
+    std::streamsize precision = os.precision();
+    os.unsetf(std::ios_base::floatfield);
+    os << "节拍 " << tick << "（" << tickRate << " Hz，仿真时刻 " << getTime() << " s）" << std::endl;
+    // 表头每个汉字占3字节、2列宽，宽度按汉字个数补齐
+    os << std::left << std::setw(22) << "阶段" << std::right << std::setw(12) << "频率Hz" << std::setw(8) << "相位"
+       << std::setw(12) << "次数" << std::setw(14) << "累计ms" << std::setw(14) << "平均us" << std::setw(14) << "最大us"
+       << std::setw(10) << "占比%" << std::endl;
+    os << std::fixed;
+    for (const Stage& stage : stages) {
+        const StageStats& s = stage.stats;
+        os << std::left << std::setw(20) << s.name << std::right << std::setprecision(2) << std::setw(10) << s.rate
+           << std::setw(6) << s.phase << std::setw(10) << s.runs << std::setprecision(3) << std::setw(12)
+           << s.totalSeconds * 1e3 << std::setw(12) << s.averageSeconds() * 1e6 << std::setw(12) << s.maxSeconds * 1e6
+           << std::setprecision(1) << std::setw(8) << (total > 0.0 ? s.totalSeconds / total * 100.0 : 0.0) << std::endl;
+    }
+    os.flags(flags);
+    os.precision(precision);
+}
@@ -0,0 +1,76 @@
+#ifndef MULTI_RATE_SCHEDULER_H
+#define MULTI_RATE_SCHEDULER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Aircraft;
+class AircraftModule;
+
+// 多速率调度器：仿真时间按整数节拍计数，时刻 = 节拍数 / 节拍频率，不累加浮点步长，长时间运行不漂移。
+// 各阶段（功能模块、机动、运动学、轨迹输出等）以自身频率和相位注册：频率须为节拍频率的整数分之一，
+// 周期 period = 节拍频率 / 频率，在满足 n ≡ phase (mod period) 的节拍 n 运行，同一节拍内按注册顺序执行。
+// 例：节拍 100Hz，运动学 100Hz 每节拍推进 0.01s，机动 10Hz 每 10 个节拍推进 0.1s，干扰模块 10Hz 相位 5 错开机动所在节拍。
+// 非线程安全：注册与推进须在同一线程。
+class MultiRateScheduler {
+public:
+    // time：本节拍结束时刻（秒）；dt：该阶段的步长，即 period 个节拍（秒）
+    using StageFunc = std::function<void(double time, double dt)>;
+
+    struct StageStats {
+        std::string name;
+        double rate;               // 运行频率（Hz）
+        std::uint64_t period;      // 周期（节拍数）
+        std::uint64_t phase;       // 相位（节拍数）
+        std::uint64_t runs;        // 已运行次数
+        double totalSeconds;       // 累计耗时（墙钟）
+        double maxSeconds;         // 单次最大耗时
+        double averageSeconds() const { return runs ? totalSeconds / runs : 0.0; }
+    };
+
+    // tickRate 为节拍频率（Hz），必须为正，否则抛出 std::invalid_argument
+    explicit MultiRateScheduler(double tickRate);
+
+    // 注册阶段，返回阶段下标。rate 不能整除节拍频率、phase 不小于周期或 func 为空时抛出 std::invalid_argument
+    std::size_t addStage(const std::string& name, double rate, std::uint64_t phase, StageFunc func);
+
+    // 注册飞机的一个功能模块（阶段名取模块名），运行时调用 module->update(aircraft, dt)；
+    // 通过调度器运行的模块不应再经 Aircraft::updateModules 更新
+    std::size_t addModule(Aircraft& aircraft, std::shared_ptr<AircraftModule> module, double rate,
+                          std::uint64_t phase = 0);
+
+    // 推进一个节拍 / 连续推进 ticks 个节拍
+    void step();
+    void run(std::uint64_t ticks);
+
+    std::uint64_t getTick() const { return tick; }
+    double getTime() const { return static_cast<double>(tick) / tickRate; }
+    double getTickRate() const { return tickRate; }
+
+    std::size_t stageCount() const { return stages.size(); }
+    // 阶段下标越界时抛出 std::invalid_argument
+    const StageStats& getStats(std::size_t stage) const;
+    void resetStats();
+
+    // 输出各阶段频率、相位、运行次数、累计/平均/最大耗时及占总耗时比例
+    void printReport(std::ostream& os) const;
+
+private:
+    struct Stage {
+        StageStats stats;
+        StageFunc func;
+        std::uint64_t nextTick;   // 下一次运行的节拍
+        double dt;
+    };
+
+    double tickRate;
+    std::uint64_t tick = 0;
+    std::vector<Stage> stages;
+};
+
+#endif // MULTI_RATE_SCHEDULER_H
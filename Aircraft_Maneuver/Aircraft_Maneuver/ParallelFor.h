@@ -0,0 +1,37 @@
+#ifndef PARALLEL_FOR_H
+#define PARALLEL_FOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// 把区间 [0, count) 均分给多个线程，每个线程执行 body(begin, end)
+// 每个线程至少分到 minPerThread 个元素；不足两份或只有一个硬件线程时直接在调用线程执行。
+// 分块边界按8对齐，批量SIMD内核只有最后一块存在尾部。
+template<class Body>
+void parallelFor(std::size_t count, std::size_t minPerThread, Body body) {
+    std::size_t hardware = std::thread::hardware_concurrency();
+    std::size_t threads = std::min<std::size_t>(hardware == 0 ? 1 : hardware,
+                                                count / std::max<std::size_t>(minPerThread, 1));
+    if (threads <= 1) {
+        body(std::size_t(0), count);
+        return;
+    }
+
+    std::size_t chunk = (count + threads - 1) / threads;
+    chunk = (chunk + 7) / 8 * 8;
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (std::size_t begin = chunk; begin < count; begin += chunk) {
+        std::size_t end = std::min(count, begin + chunk);
+        workers.emplace_back([&body, begin, end]() { body(begin, end); });
+    }
+    // 第一块由调用线程完成
+    body(std::size_t(0), std::min(count, chunk));
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+#endif // PARALLEL_FOR_H
@@ -0,0 +1,28 @@
+#include "SimdKernels.h"
+#include "AircraftModelLibrary.h"
+
+const SimdKernelTable* getSimdKernels(SimdLevel level) {
+    switch (level) {
+    case SimdLevel::AVX512: return simd::avx512KernelTable();
+    case SimdLevel::AVX2: return simd::avx2KernelTable();
+    default: return simd::scalarKernelTable();
+    }
+}
+
+const SimdKernelTable& getSimdKernels() {
+    // 激活级别未编译进来时逐级回退
+    int level = static_cast<int>(getActiveSimdLevel());
+    for (; level > 0; --level) {
+        const SimdKernelTable* table = getSimdKernels(static_cast<SimdLevel>(level));
+        if (table) return *table;
+    }
+    return *simd::scalarKernelTable();
+}
+
+// 批量位置积分：按当前SIMD级别分派
+void updateGeoPositionBatch(double* latitude, double* longitude, double* altitude,
+                            const double* velocityNorth, const double* velocityUp,
+                            const double* velocityEast, std::size_t count, double dt) {
+    getSimdKernels().updateGeoPosition(latitude, longitude, altitude,
+                                       velocityNorth, velocityUp, velocityEast, count, dt);
+}
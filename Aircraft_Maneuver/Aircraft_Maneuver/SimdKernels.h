@@ -0,0 +1,108 @@
+#ifndef SIMD_KERNELS_H
+#define SIMD_KERNELS_H
+
+#include "SimdSupport.h"
+#include <cstddef>
+#include <cstdint>
+
+struct GeoPosition;
+struct DirectionCosineMatrix;
+
+// 分段三次多项式系数块布局（CompiledManeuverTemplate）：
+// 每段 SPLINE_SEGMENT_STRIDE 个值，按 0~3 次项分 4 行，每行 SPLINE_CHANNEL_STRIDE 个通道槽位；
+// 超出通道数的槽位可由调用方存放其他数据（内核按向量宽度整行读取，但不输出这些槽位的结果）
+constexpr std::size_t SPLINE_CHANNEL_STRIDE = 8;
+constexpr std::size_t SPLINE_SEGMENT_STRIDE = 4 * SPLINE_CHANNEL_STRIDE;
+
+// 批量计算内核函数表
+// 每个指令集级别一份（SimdKernels_scalar/avx2/avx512.cpp），运行时按CPU检测结果选择。
+// 新增内核：在此添加函数指针，在 SimdKernels.inl 中实现模板，并在各级别表中登记。
+struct SimdKernelTable {
+    SimdLevel level;
+
+    // 批量位置积分（与 updateGeoPosition 相同的球面模型）
+    void (*updateGeoPosition)(double* latitude, double* longitude, double* altitude,
+                              const double* velocityNorth, const double* velocityUp,
+                              const double* velocityEast, std::size_t count, double dt);
+
+    // 机群运动学一步：推力减阻力加速度更新速度，再积分位置（AircraftFleet::stepKinematics）
+    void (*stepKinematics)(double* latitude, double* longitude, double* altitude,
+                           double* velocityNorth, double* velocityUp, double* velocityEast,
+                           const double* thrust, const double* dragCoefficient, const double* mass,
+                           std::size_t count, double dt);
+
+    // 机群运动学一步，经典四阶 Runge-Kutta（IntegrationMethod::RK4）
+    void (*stepKinematicsRK4)(double* latitude, double* longitude, double* altitude,
+                              double* velocityNorth, double* velocityUp, double* velocityEast,
+                              const double* thrust, const double* dragCoefficient, const double* mass,
+                              std::size_t count, double dt);
+
+    // 机群运动学一步，Dormand-Prince 5(4) 自适应子步长（IntegrationMethod::RK45）
+    // stepSize 为各槽位的建议子步长（<=0 表示从 dt 开始），返回时更新；误差按位置/速度容差归一化
+    void (*stepKinematicsRK45)(double* latitude, double* longitude, double* altitude,
+                               double* velocityNorth, double* velocityUp, double* velocityEast,
+                               double* stepSize,
+                               const double* thrust, const double* dragCoefficient, const double* mass,
+                               std::size_t count, double dt,
+                               double positionTolerance, double velocityTolerance);
+
+    // 机群运动学一步，位置为ECEF直角坐标（KinematicsFrame::ECEF），速度仍为当地北上东分量
+    // sinLat..cosLon 为各槽位当前位置的当地坐标轴（大地纬度、经度的正余弦），返回时更新为新位置的值
+    void (*stepKinematicsECEF)(double* x, double* y, double* z,
+                               double* velocityNorth, double* velocityUp, double* velocityEast,
+                               double* sinLat, double* cosLat, double* sinLon, double* cosLon,
+                               const double* thrust, const double* dragCoefficient, const double* mass,
+                               std::size_t count, double dt);
+
+    // 批量大地坐标 -> ECEF（WGS84），ecef 按 x,y,z 交错存放（与 Eigen::Matrix3Xd 列主序一致）
+    void (*geodeticToECEF)(const GeoPosition* geodetic, double* ecef, std::size_t count);
+
+    // 批量 ECEF -> 大地坐标（WGS84）
+    void (*ecefToGeodetic)(const double* ecef, GeoPosition* geodetic, std::size_t count);
+
+    // 批量分段三次多项式求值（Horner）：offset[i] 为第i个点所在段系数块的起始下标，u[i] 为段内局部时间，
+    // output[c][i] = Σk coefficients[offset[i] + k*SPLINE_CHANNEL_STRIDE + c] * u[i]^k，c < channelCount
+    void (*evaluatePiecewiseCubic)(const double* coefficients, const std::int64_t* offset, const double* u,
+                                   double* const* output, std::size_t channelCount, std::size_t count);
+
+    // 批量由速度推导姿态角（EulerAngleCalculator::calculateFromVelocity）：
+    // 俯仰 = atan2(上, 水平速率)，偏航 = atan2(东, 北)，滚转为0；速率 <= 1e-3 时三者均为0。
+    // 向量级别使用 simd::atan2Fast（误差 < 3e-7 弧度），标量级别使用 std::atan2，与逐个版本逐位一致
+    void (*attitudeFromVelocity)(const double* velocityNorth, const double* velocityUp, const double* velocityEast,
+                                 double* pitch, double* roll, double* yaw, std::size_t count);
+
+    // 批量姿态角限制（EulerAngleCalculator::limitAttitudeAngles）：俯仰、滚转截断到 ±maxPitch、±maxRoll，
+    // 偏航回绕到 [-pi, pi]（向量级别按 round(yaw/2pi) 一次减去整周，无循环）
+    void (*limitAttitude)(double* pitch, double* roll, double* yaw, std::size_t count,
+                          double maxPitch, double maxRoll);
+
+    // 四元数字段数组批量换算为欧拉角（EulerAngleCalculator::fromQuaternion），反正切使用 simd::atan2
+    void (*quaternionToEuler)(const double* w, const double* x, const double* y, const double* z,
+                              double* pitch, double* roll, double* yaw, std::size_t count);
+
+    // 四元数字段数组批量换算为方向余弦矩阵（EulerAngleCalculator::toDCM），逐个矩阵连续存放
+    void (*quaternionToDCM)(const double* w, const double* x, const double* y, const double* z,
+                            DirectionCosineMatrix* dcm, std::size_t count);
+
+    // 一个起点到一组终点的Vincenty反算（ImprovedCoordinateTransform::calculateDistanceMatrix 的一行）：
+    // 各点预先给出归化纬度的正余弦与经度（弧度），输出椭球面距离（米）与起点处初始方位角（度，[0, 360)）。
+    // 各车道独立判断收敛，已收敛的车道冻结，整组都收敛即停止；100次迭代仍不收敛（近对跖点）的
+    // 距离与方位角写 NaN，返回其个数。标量级别与 calculateDistanceImproved 运算顺序相同，结果逐位一致
+    std::size_t (*vincentyInverse)(double sinU1, double cosU1, double longitude1,
+                                   const double* sinU2, const double* cosU2, const double* longitude2,
+                                   double* distance, double* bearing, std::size_t count);
+};
+
+// 当前激活级别对应的内核表
+const SimdKernelTable& getSimdKernels();
+
+// 指定级别的内核表（本次编译未包含该级别时返回nullptr）
+const SimdKernelTable* getSimdKernels(SimdLevel level);
+
+namespace simd {
+const SimdKernelTable* scalarKernelTable();
+const SimdKernelTable* avx2KernelTable();
+const SimdKernelTable* avx512KernelTable();
+} // namespace simd
+
+#endif // SIMD_KERNELS_H
@@ -0,0 +1,721 @@
+// 批量计算内核的通用实现（按向量类型模板化）
+//
+// 由各指令集翻译单元包含，包含前需定义：
+//   SIMD_KERNEL_NS  : 本级别的命名空间名（scalar / avx2 / avx512）
+//   SIMD_KERNEL_VEC : 本级别的向量类型（simd::VecScalar / simd::VecAVX2 / simd::VecAVX512）
+// 各级别的实例位于不同命名空间，避免不同编译选项生成的同名内联函数在链接时被相互替换。
+
+#include "SimdKernels.h"
+#include "SimdMath.h"
+#include "AircraftModelLibrary.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace simd {
+namespace SIMD_KERNEL_NS {
+
+using Vec = SIMD_KERNEL_VEC;
+constexpr int W = Vec::width;
+
+// 地球半径 (单位：米)，与 updateGeoPosition 保持一致
+constexpr double EARTH_RADIUS = 6371000.0;
+constexpr double DEG_TO_RAD = 3.14159265358979323846 / 180.0;
+constexpr double RAD_TO_DEG = 180.0 / 3.14159265358979323846;
+
+// WGS84椭球参数，与 CoordinateTransform 保持一致
+constexpr double WGS84_A = 6378137.0;               // 长半轴
+constexpr double WGS84_E2 = 0.006694379990141316;   // 第一偏心率平方
+// Vincenty反算的椭球参数与迭代设置，与 ImprovedCoordinateTransform 保持一致
+constexpr double WGS84_B = 6356752.314245;          // 短半轴
+constexpr double WGS84_F = 1.0 / 298.257223563;     // 扁率
+constexpr int VINCENTY_MAX_ITERATIONS = 100;
+constexpr double VINCENTY_TOLERANCE = 1e-12;
+
+// ECEF -> 大地坐标的迭代次数（近地面点每次迭代误差约缩小为原来的 e2 倍）
+constexpr int ECEF_TO_GEODETIC_ITERATIONS = 6;
+
+// 按W路分块遍历，尾部不足W个元素时拷贝到补零的临时缓冲区处理
+// block(ptrs...) 对各数组从当前位置起的W个元素进行计算
+template<int NOut, int NIn, class Block>
+inline void forEachBlock(double* const (&out)[NOut], const double* const (&in)[NIn],
+                         std::size_t count, Block block) {
+    std::size_t i = 0;
+    double* o[NOut];
+    const double* p[NIn];
+    for (; i + W <= count; i += W) {
+        for (int k = 0; k < NOut; ++k) o[k] = out[k] + i;
+        for (int k = 0; k < NIn; ++k) p[k] = in[k] + i;
+        block(o, p);
+    }
+    std::size_t rest = count - i;
+    if (rest == 0) return;
+
+    double outBuf[NOut][W];
+    double inBuf[NIn][W];
+    std::memset(outBuf, 0, sizeof(outBuf));
+    std::memset(inBuf, 0, sizeof(inBuf));
+    for (int k = 0; k < NOut; ++k) {
+        std::memcpy(outBuf[k], out[k] + i, rest * sizeof(double));
+        o[k] = outBuf[k];
+    }
+    for (int k = 0; k < NIn; ++k) {
+        std::memcpy(inBuf[k], in[k] + i, rest * sizeof(double));
+        p[k] = inBuf[k];
+    }
+    block(o, p);
+    for (int k = 0; k < NOut; ++k) {
+        std::memcpy(out[k] + i, outBuf[k], rest * sizeof(double));
+    }
+}
+
+// ===== 批量位置积分 =====
+inline void updateGeoPositionKernel(double* latitude, double* longitude, double* altitude,
+                                    const double* velocityNorth, const double* velocityUp,
+                                    const double* velocityEast, std::size_t count, double dt) {
+    double* const out[3] = { latitude, longitude, altitude };
+    const double* const in[3] = { velocityNorth, velocityUp, velocityEast };
+    const Vec vdt(dt);
+    const Vec latScale(RAD_TO_DEG / EARTH_RADIUS);
+
+    forEachBlock(out, in, count, [&](double* const* o, const double* const* p) {
+        Vec lat = Vec::load(o[0]);
+        Vec lon = Vec::load(o[1]);
+        Vec alt = Vec::load(o[2]);
+        Vec vn = Vec::load(p[0]);
+        Vec vu = Vec::load(p[1]);
+        Vec ve = Vec::load(p[2]);
+
+        // 经度变化使用更新前的纬度
+        Vec radiusAtLat = Vec(EARTH_RADIUS) * simd::cos(lat * Vec(DEG_TO_RAD));
+        Vec dLon = (ve * vdt / radiusAtLat) * Vec(RAD_TO_DEG);
+        lon = lon + select(abs(radiusAtLat) > Vec(1e-6), dLon, Vec(0.0));
+        lat = fmadd(vn * vdt, latScale, lat);
+        alt = fmadd(vu, vdt, alt);
+
+        lat.store(o[0]);
+        lon.store(o[1]);
+        alt.store(o[2]);
+    });
+}
+
+// ===== 机群运动学一步（加速度 + 位置积分） =====
+inline void stepKinematicsKernel(double* latitude, double* longitude, double* altitude,
+                                 double* velocityNorth, double* velocityUp, double* velocityEast,
+                                 const double* thrust, const double* dragCoefficient, const double* mass,
+                                 std::size_t count, double dt) {
+    double* const out[6] = { latitude, longitude, altitude, velocityNorth, velocityUp, velocityEast };
+    const double* const in[3] = { thrust, dragCoefficient, mass };
+    const Vec vdt(dt);
+    const Vec latScale(RAD_TO_DEG / EARTH_RADIUS);
+
+    forEachBlock(out, in, count, [&](double* const* o, const double* const* p) {
+        Vec lat = Vec::load(o[0]);
+        Vec lon = Vec::load(o[1]);
+        Vec alt = Vec::load(o[2]);
+        Vec vn = Vec::load(o[3]);
+        Vec vu = Vec::load(o[4]);
+        Vec ve = Vec::load(o[5]);
+        Vec T = Vec::load(p[0]);
+        Vec k = Vec::load(p[1]);
+        // 尾部补零的槽位质量为0，替换为1避免除零
+        Vec m = Vec::load(p[2]);
+        m = select(m == Vec(0.0), Vec(1.0), m);
+
+        // 加速度（推力减阻力，方向与速度一致），速度过小时不加速
+        Vec speedSq = fmadd(vn, vn, fmadd(vu, vu, ve * ve));
+        Vec speed = sqrt(speedSq);
+        Vec netAcc = (T - k * speedSq) / m;
+        Vec scale = select(speed > Vec(1e-3), netAcc * vdt / speed, Vec(0.0));
+        vn = fmadd(vn, scale, vn);
+        vu = fmadd(vu, scale, vu);
+        ve = fmadd(ve, scale, ve);
+
+        // 位置积分（经度变化使用更新前的纬度）
+        Vec radiusAtLat = Vec(EARTH_RADIUS) * simd::cos(lat * Vec(DEG_TO_RAD));
+        Vec dLon = (ve * vdt / radiusAtLat) * Vec(RAD_TO_DEG);
+        lon = lon + select(abs(radiusAtLat) > Vec(1e-6), dLon, Vec(0.0));
+        lat = fmadd(vn * vdt, latScale, lat);
+        alt = fmadd(vu, vdt, alt);
+
+        lat.store(o[0]);
+        lon.store(o[1]);
+        alt.store(o[2]);
+        vn.store(o[3]);
+        vu.store(o[4]);
+        ve.store(o[5]);
+    });
+}
+
+// ===== 机群运动学高阶积分（RK4 / Dormand-Prince RK45） =====
+// 状态为经纬高与北上东速度；导数与 stepKinematicsKernel 使用同一加速度模型和球面位置变化率
+struct KinematicsState {
+    Vec lat, lon, alt, vn, vu, ve;
+};
+
+inline KinematicsState kinematicsDerivative(const KinematicsState& s, Vec T, Vec k, Vec m) {
+    Vec speedSq = fmadd(s.vn, s.vn, fmadd(s.vu, s.vu, s.ve * s.ve));
+    Vec speed = sqrt(speedSq);
+    Vec scale = select(speed > Vec(1e-3), (T - k * speedSq) / m / speed, Vec(0.0));
+    Vec radiusAtLat = Vec(EARTH_RADIUS) * simd::cos(s.lat * Vec(DEG_TO_RAD));
+    KinematicsState d;
+    d.lat = s.vn * Vec(RAD_TO_DEG / EARTH_RADIUS);
+    d.lon = select(abs(radiusAtLat) > Vec(1e-6), s.ve / radiusAtLat * Vec(RAD_TO_DEG), Vec(0.0));
+    d.alt = s.vu;
+    d.vn = s.vn * scale;
+    d.vu = s.vu * scale;
+    d.ve = s.ve * scale;
+    return d;
+}
+
+// s + c * d
+inline KinematicsState addScaled(const KinematicsState& s, Vec c, const KinematicsState& d) {
+    return { fmadd(d.lat, c, s.lat), fmadd(d.lon, c, s.lon), fmadd(d.alt, c, s.alt),
+             fmadd(d.vn, c, s.vn), fmadd(d.vu, c, s.vu), fmadd(d.ve, c, s.ve) };
+}
+
+inline KinematicsState loadKinematicsState(double* const* o) {
+    return { Vec::load(o[0]), Vec::load(o[1]), Vec::load(o[2]), Vec::load(o[3]), Vec::load(o[4]), Vec::load(o[5]) };
+}
+
+inline void storeKinematicsState(const KinematicsState& s, double* const* o) {
+    s.lat.store(o[0]);
+    s.lon.store(o[1]);
+    s.alt.store(o[2]);
+    s.vn.store(o[3]);
+    s.vu.store(o[4]);
+    s.ve.store(o[5]);
+}
+
+// 经典四阶 Runge-Kutta，每步4次导数求值
+inline void stepKinematicsRK4Kernel(double* latitude, double* longitude, double* altitude,
+                                    double* velocityNorth, double* velocityUp, double* velocityEast,
+                                    const double* thrust, const double* dragCoefficient, const double* mass,
+                                    std::size_t count, double dt) {
+    double* const out[6] = { latitude, longitude, altitude, velocityNorth, velocityUp, velocityEast };
+    const double* const in[3] = { thrust, dragCoefficient, mass };
+    const Vec half(0.5 * dt);
+    const Vec full(dt);
+    const Vec sixth(dt / 6.0);
+    const Vec third(dt / 3.0);
+
+    forEachBlock(out, in, count, [&](double* const* o, const double* const* p) {
+        KinematicsState s = loadKinematicsState(o);
+        Vec T = Vec::load(p[0]);
+        Vec k = Vec::load(p[1]);
+        Vec m = Vec::load(p[2]);
+        m = select(m == Vec(0.0), Vec(1.0), m);
+
+        KinematicsState k1 = kinematicsDerivative(s, T, k, m);
+        KinematicsState k2 = kinematicsDerivative(addScaled(s, half, k1), T, k, m);
+        KinematicsState k3 = kinematicsDerivative(addScaled(s, half, k2), T, k, m);
+        KinematicsState k4 = kinematicsDerivative(addScaled(s, full, k3), T, k, m);
+        s = addScaled(s, sixth, k1);
+        s = addScaled(s, third, k2);
+        s = addScaled(s, third, k3);
+        s = addScaled(s, sixth, k4);
+        storeKinematicsState(s, o);
+    });
+}
+
+// Dormand-Prince 5(4) 嵌入式 Runge-Kutta，步长自适应（FSAL：接受一步后末级导数即下一步首级导数）
+// 同一向量块内的飞机共用子步长（按块内最大误差控制），建议步长存于 stepSize（<=0 表示从 dt 开始）。
+// 误差按位置（米，经纬度按赤道处的弧长换算，偏保守）与速度（米/秒）分别除以容差后取最大值，<=1 时接受。
+inline void stepKinematicsRK45Kernel(double* latitude, double* longitude, double* altitude,
+                                     double* velocityNorth, double* velocityUp, double* velocityEast,
+                                     double* stepSize,
+                                     const double* thrust, const double* dragCoefficient, const double* mass,
+                                     std::size_t count, double dt,
+                                     double positionTolerance, double velocityTolerance) {
+    double* const out[7] = { latitude, longitude, altitude, velocityNorth, velocityUp, velocityEast, stepSize };
+    const double* const in[3] = { thrust, dragCoefficient, mass };
+    const Vec angleScale(EARTH_RADIUS * DEG_TO_RAD / positionTolerance);
+    const Vec positionScale(1.0 / positionTolerance);
+    const Vec velocityScale(1.0 / velocityTolerance);
+    // 最小子步长：误差仍超限时强制接受，保证有限步内结束
+    const double minStep = dt * 1e-6;
+
+    forEachBlock(out, in, count, [&](double* const* o, const double* const* p) {
+        KinematicsState s = loadKinematicsState(o);
+        Vec T = Vec::load(p[0]);
+        Vec k = Vec::load(p[1]);
+        Vec m = Vec::load(p[2]);
+        m = select(m == Vec(0.0), Vec(1.0), m);
+
+        double h = dt;
+        for (int i = 0; i < W; ++i) {
+            if (o[6][i] > 0.0) h = std::min(h, o[6][i]);
+        }
+
+        KinematicsState k1 = kinematicsDerivative(s, T, k, m);
+        double t = 0.0;
+        while (t < dt) {
+            bool clipped = t + h >= dt;
+            double step = clipped ? dt - t : h;
+            const Vec c(step);
+            KinematicsState k2 = kinematicsDerivative(addScaled(s, c * Vec(1.0 / 5.0), k1), T, k, m);
+            KinematicsState y = addScaled(s, c * Vec(3.0 / 40.0), k1);
+            y = addScaled(y, c * Vec(9.0 / 40.0), k2);
+            KinematicsState k3 = kinematicsDerivative(y, T, k, m);
+            y = addScaled(s, c * Vec(44.0 / 45.0), k1);
+            y = addScaled(y, c * Vec(-56.0 / 15.0), k2);
+            y = addScaled(y, c * Vec(32.0 / 9.0), k3);
+            KinematicsState k4 = kinematicsDerivative(y, T, k, m);
+            y = addScaled(s, c * Vec(19372.0 / 6561.0), k1);
+            y = addScaled(y, c * Vec(-25360.0 / 2187.0), k2);
+            y = addScaled(y, c * Vec(64448.0 / 6561.0), k3);
+            y = addScaled(y, c * Vec(-212.0 / 729.0), k4);
+            KinematicsState k5 = kinematicsDerivative(y, T, k, m);
+            y = addScaled(s, c * Vec(9017.0 / 3168.0), k1);
+            y = addScaled(y, c * Vec(-355.0 / 33.0), k2);
+            y = addScaled(y, c * Vec(46732.0 / 5247.0), k3);
+            y = addScaled(y, c * Vec(49.0 / 176.0), k4);
+            y = addScaled(y, c * Vec(-5103.0 / 18656.0), k5);
+            KinematicsState k6 = kinematicsDerivative(y, T, k, m);
+            // 五阶解
+            y = addScaled(s, c * Vec(35.0 / 384.0), k1);
+            y = addScaled(y, c * Vec(500.0 / 1113.0), k3);
+            y = addScaled(y, c * Vec(125.0 / 192.0), k4);
+            y = addScaled(y, c * Vec(-2187.0 / 6784.0), k5);
+            y = addScaled(y, c * Vec(11.0 / 84.0), k6);
+            KinematicsState k7 = kinematicsDerivative(y, T, k, m);
+
+            // 五阶解与嵌入四阶解之差
+            KinematicsState zero = { Vec(0.0), Vec(0.0), Vec(0.0), Vec(0.0), Vec(0.0), Vec(0.0) };
+            KinematicsState e = addScaled(zero, c * Vec(71.0 / 57600.0), k1);
+            e = addScaled(e, c * Vec(-71.0 / 16695.0), k3);
+            e = addScaled(e, c * Vec(71.0 / 1920.0), k4);
+            e = addScaled(e, c * Vec(-17253.0 / 339200.0), k5);
+            e = addScaled(e, c * Vec(22.0 / 525.0), k6);
+            e = addScaled(e, c * Vec(-1.0 / 40.0), k7);
+            Vec error = max(max(abs(e.lat), abs(e.lon)) * angleScale, abs(e.alt) * positionScale);
+            error = max(error, max(max(abs(e.vn), abs(e.vu)), abs(e.ve)) * velocityScale);
+            double lanes[W];
+            error.store(lanes);
+            double errorMax = 0.0;
+            for (int i = 0; i < W; ++i) {
+                errorMax = std::max(errorMax, lanes[i]);
+            }
+
+            bool accepted = errorMax <= 1.0 || step <= minStep;
+            if (accepted) {
+                s = y;
+                k1 = k7;
+                t = clipped ? dt : t + step;
+            }
+            // 标准步长控制：安全系数0.9，每步缩放限制在 [0.2, 5]
+            double factor = errorMax > 0.0 ? 0.9 * std::pow(errorMax, -0.2) : 5.0;
+            double proposed = std::max(step * std::min(5.0, std::max(0.2, factor)), minStep);
+            // 截到 dt 末尾的短步不缩小后续步长
+            if (!(accepted && clipped && proposed < h)) h = proposed;
+        }
+
+        storeKinematicsState(s, o);
+        for (int i = 0; i < W; ++i) {
+            o[6][i] = h;
+        }
+    });
+}
+
+// ===== 机群运动学一步（ECEF直角坐标） =====
+// 每架飞机缓存当前位置的当地北-上-东坐标轴（sinφ、cosφ、sinλ、cosλ），每步位置积分后就地更新：
+// 经度方向余弦为 x/p、y/p；纬度用 ecefToGeodeticKernel 的 (S, C) 迭代，以上一步纬度为初值只迭代一次，
+// 初值误差为一步内的纬度变化，迭代后缩小为约 e2 倍（dt=0.01、250米/秒时 < 1e-11 弧度），且不随步数累积。
+// 全程无三角函数，只用开方与除法；极轴上（p=0）取经度0的坐标轴。
+struct LocalAxes {
+    Vec sinLat, cosLat, sinLon, cosLon;
+};
+
+inline LocalAxes updateLocalAxes(Vec x, Vec y, Vec z, Vec sinLat, Vec cosLat) {
+    const Vec tiny(1e-300);
+    // 1/sqrt(1 - e2·sin²φ) 的级数展开（u ≤ e2，截断误差 < 1e-13）
+    Vec u = Vec(WGS84_E2) * sinLat * sinLat;
+    Vec invW = fmadd(fmadd(fmadd(fmadd(fmadd(u, Vec(63.0 / 256.0), Vec(35.0 / 128.0)), u, Vec(5.0 / 16.0)),
+                                   u, Vec(3.0 / 8.0)), u, Vec(0.5)), u, Vec(1.0));
+    Vec p = sqrt(fmadd(x, x, y * y));
+    Vec C = p - Vec(WGS84_E2 * WGS84_A) * cosLat * invW;
+    Vec invNorm = Vec(1.0) / max(sqrt(fmadd(C, C, z * z)), tiny);
+    Vec invP = Vec(1.0) / max(p, tiny);
+    LocalAxes a;
+    a.sinLat = z * invNorm;
+    a.cosLat = C * invNorm;
+    a.cosLon = select(p > Vec(1e-9), x * invP, Vec(1.0));
+    a.sinLon = select(p > Vec(1e-9), y * invP, Vec(0.0));
+    return a;
+}
+
+// 速度更新与 stepKinematicsKernel 相同；北上东速度按缓存的坐标轴换算为ECEF速度积分位置，
+// 再把水平速度投影到新位置的坐标轴并恢复原水平速率（航向沿大圆平移，垂直速度不变），
+// 因此不随经纬度换算出现极点奇异，飞越极点后北向速度自然变为南向
+inline void stepKinematicsECEFKernel(double* x, double* y, double* z,
+                                     double* velocityNorth, double* velocityUp, double* velocityEast,
+                                     double* sinLat, double* cosLat, double* sinLon, double* cosLon,
+                                     const double* thrust, const double* dragCoefficient, const double* mass,
+                                     std::size_t count, double dt) {
+    double* const out[10] = { x, y, z, velocityNorth, velocityUp, velocityEast, sinLat, cosLat, sinLon, cosLon };
+    const double* const in[3] = { thrust, dragCoefficient, mass };
+    const Vec vdt(dt);
+
+    forEachBlock(out, in, count, [&](double* const* o, const double* const* p) {
+        Vec px = Vec::load(o[0]);
+        Vec py = Vec::load(o[1]);
+        Vec pz = Vec::load(o[2]);
+        Vec vn = Vec::load(o[3]);
+        Vec vu = Vec::load(o[4]);
+        Vec ve = Vec::load(o[5]);
+        LocalAxes a = { Vec::load(o[6]), Vec::load(o[7]), Vec::load(o[8]), Vec::load(o[9]) };
+        Vec T = Vec::load(p[0]);
+        Vec k = Vec::load(p[1]);
+        Vec m = Vec::load(p[2]);
+        m = select(m == Vec(0.0), Vec(1.0), m);
+
+        Vec speedSq = fmadd(vn, vn, fmadd(vu, vu, ve * ve));
+        Vec speed = sqrt(speedSq);
+        Vec netAcc = (T - k * speedSq) / m;
+        Vec scale = select(speed > Vec(1e-3), netAcc * vdt / speed, Vec(0.0));
+        vn = fmadd(vn, scale, vn);
+        vu = fmadd(vu, scale, vu);
+        ve = fmadd(ve, scale, ve);
+
+        // 北 = (-sinφcosλ, -sinφsinλ, cosφ)，上 = (cosφcosλ, cosφsinλ, sinφ)，东 = (-sinλ, cosλ, 0)
+        Vec radial = fmadd(vu, a.cosLat, -(vn * a.sinLat));   // 赤道面内沿经线向外的分量
+        Vec vx = fmadd(radial, a.cosLon, -(ve * a.sinLon));
+        Vec vy = fmadd(radial, a.sinLon, ve * a.cosLon);
+        Vec vz = fmadd(vn, a.cosLat, vu * a.sinLat);
+        // 沿切线直线前进会离开地面 s²/2R，沿当地“上”方向补偿，使平飞（vu=0）保持高度；
+        // R 取赤道半径，与当地曲率半径相差 < 0.7%，补偿后每小时残余高度漂移在 dt=1 时约0.1米
+        Vec horizontalSq = fmadd(vn, vn, ve * ve);
+        Vec drop = horizontalSq * vdt * vdt * Vec(0.5 / WGS84_A);
+        Vec dropRadial = -(drop * a.cosLat);
+        px = fmadd(vx, vdt, fmadd(dropRadial, a.cosLon, px));
+        py = fmadd(vy, vdt, fmadd(dropRadial, a.sinLon, py));
+        pz = fmadd(vz, vdt, fmadd(-drop, a.sinLat, pz));
+
+        LocalAxes b = updateLocalAxes(px, py, pz, a.sinLat, a.cosLat);
+        Vec outward = fmadd(vx, b.cosLon, vy * b.sinLon);
+        Vec north = fmadd(vz, b.cosLat, -(outward * b.sinLat));
+        Vec east = fmadd(vy, b.cosLon, -(vx * b.sinLon));
+        // 投影后的水平速率与原速率只差二阶小量，sqrt(H/P) 用 (1 + H/P)/2 代替
+        Vec projectedSq = fmadd(north, north, east * east);
+        Vec ratio = select(projectedSq > Vec(1e-24), fmadd(horizontalSq / projectedSq, Vec(0.5), Vec(0.5)), Vec(0.0));
+        vn = north * ratio;
+        ve = east * ratio;
+
+        px.store(o[0]);
+        py.store(o[1]);
+        pz.store(o[2]);
+        vn.store(o[3]);
+        vu.store(o[4]);
+        ve.store(o[5]);
+        b.sinLat.store(o[6]);
+        b.cosLat.store(o[7]);
+        b.sinLon.store(o[8]);
+        b.cosLon.store(o[9]);
+    });
+}
+
+// ===== 批量大地坐标 -> ECEF =====
+// 输入输出均为逐点交错存放，每W个点先拆成字段数组再向量计算
+inline void geodeticToECEFKernel(const GeoPosition* geodetic, double* ecef, std::size_t count) {
+    for (std::size_t i = 0; i < count; i += W) {
+        std::size_t n = (count - i < static_cast<std::size_t>(W)) ? count - i : W;
+        double lat[W] = {}, lon[W] = {}, alt[W] = {};
+        for (std::size_t k = 0; k < n; ++k) {
+            lat[k] = geodetic[i + k].latitude;
+            lon[k] = geodetic[i + k].longitude;
+            alt[k] = geodetic[i + k].altitude;
+        }
+
+        Vec sinLat, cosLat, sinLon, cosLon;
+        simd::sincos(Vec::load(lat) * Vec(DEG_TO_RAD), sinLat, cosLat);
+        simd::sincos(Vec::load(lon) * Vec(DEG_TO_RAD), sinLon, cosLon);
+        Vec h = Vec::load(alt);
+
+        // 卯酉圈曲率半径
+        Vec N = Vec(WGS84_A) / sqrt(Vec(1.0) - Vec(WGS84_E2) * sinLat * sinLat);
+        Vec r = (N + h) * cosLat;
+        double x[W], y[W], z[W];
+        (r * cosLon).store(x);
+        (r * sinLon).store(y);
+        (fmadd(N, Vec(1.0 - WGS84_E2), h) * sinLat).store(z);
+
+        for (std::size_t k = 0; k < n; ++k) {
+            ecef[3 * (i + k)] = x[k];
+            ecef[3 * (i + k) + 1] = y[k];
+            ecef[3 * (i + k) + 2] = z[k];
+        }
+    }
+}
+
+// ===== 批量 ECEF -> 大地坐标 =====
+// 迭代量取 (S, C) ∝ (sinφ, cosφ)：C' = p - e2·a·C / sqrt(C² + (1-e2)·S²)，S' = z，
+// 与逐点版本的纬度不动点迭代相同，但每次只需一次开方和除法；p=0（极点）时也不退化。
+// 高度用 p·cosφ + z·sinφ - a·sqrt(1 - e2·sin²φ)，在高纬度比 p/cosφ - N 数值稳定。
+inline void ecefToGeodeticKernel(const double* ecef, GeoPosition* geodetic, std::size_t count) {
+    for (std::size_t i = 0; i < count; i += W) {
+        std::size_t n = (count - i < static_cast<std::size_t>(W)) ? count - i : W;
+        // 尾部补赤道上的点，避免地心处的无效运算
+        double xs[W], ys[W] = {}, zs[W] = {};
+        for (int k = 0; k < W; ++k) xs[k] = WGS84_A;
+        for (std::size_t k = 0; k < n; ++k) {
+            xs[k] = ecef[3 * (i + k)];
+            ys[k] = ecef[3 * (i + k) + 1];
+            zs[k] = ecef[3 * (i + k) + 2];
+        }
+        Vec x = Vec::load(xs);
+        Vec y = Vec::load(ys);
+        Vec z = Vec::load(zs);
+
+        Vec p = sqrt(fmadd(x, x, y * y));
+        const Vec tiny(1e-300);
+        const Vec oneMinusE2(1.0 - WGS84_E2);
+        const Vec e2a(WGS84_E2 * WGS84_A);
+        const Vec zz = z * z;
+        Vec C = p * oneMinusE2;
+        for (int it = 0; it < ECEF_TO_GEODETIC_ITERATIONS; ++it) {
+            Vec r = max(sqrt(fmadd(C, C, oneMinusE2 * zz)), tiny);
+            C = p - e2a * C / r;
+        }
+
+        Vec norm = max(sqrt(fmadd(C, C, zz)), tiny);
+        Vec sinLat = z / norm;
+        Vec cosLat = C / norm;
+        Vec lat = simd::atan2(z, C);
+        Vec lon = simd::atan2(y, x);
+        Vec h = fmadd(p, cosLat, z * sinLat)
+              - Vec(WGS84_A) * sqrt(Vec(1.0) - Vec(WGS84_E2) * sinLat * sinLat);
+
+        double latOut[W], lonOut[W], altOut[W];
+        (lat * Vec(RAD_TO_DEG)).store(latOut);
+        (lon * Vec(RAD_TO_DEG)).store(lonOut);
+        h.store(altOut);
+        for (std::size_t k = 0; k < n; ++k) {
+            geodetic[i + k].longitude = lonOut[k];
+            geodetic[i + k].latitude = latOut[k];
+            geodetic[i + k].altitude = altOut[k];
+        }
+    }
+}
+
+// ===== 分段三次多项式批量求值 =====
+// 系数块每行的通道槽位连续存放，按通道方向向量化：每个点读取所在段的4行（每行 SPLINE_CHANNEL_STRIDE/W 个向量），
+// 以段内时间广播做 Horner，一次得到全部通道，再拆分写入各通道数组
+inline void evaluatePiecewiseCubicKernel(const double* coefficients, const std::int64_t* offset, const double* u,
+                                         double* const* output, std::size_t channelCount, std::size_t count) {
+    constexpr std::size_t ROW = SPLINE_CHANNEL_STRIDE;
+    static_assert(ROW % W == 0, "channel slots must be a multiple of the vector width");
+    // 输出指针拷贝到局部（否则每次写入后编译器都须按可能别名重新读取 output[c]）
+    double* out[ROW];
+    for (std::size_t c = 0; c < channelCount && c < ROW; ++c) out[c] = output[c];
+    for (std::size_t i = 0; i < count; ++i) {
+        const double* block = coefficients + offset[i];
+        const Vec x(u[i]);
+        double value[ROW];
+        for (std::size_t c = 0; c < channelCount; c += W) {
+            Vec r = Vec::load(block + 3 * ROW + c);
+            r = fmadd(r, x, Vec::load(block + 2 * ROW + c));
+            r = fmadd(r, x, Vec::load(block + ROW + c));
+            r = fmadd(r, x, Vec::load(block + c));
+            r.store(value + c);
+        }
+        for (std::size_t c = 0; c < channelCount; ++c) {
+            out[c][i] = value[c];
+        }
+    }
+}
+
+// ===== 批量姿态角 =====
+// 速率判断用平方比较（speed > 1e-3 即 speedSq > 1e-6），省去一次开方
+inline void attitudeFromVelocityKernel(const double* velocityNorth, const double* velocityUp,
+                                       const double* velocityEast, double* pitch, double* roll, double* yaw,
+                                       std::size_t count) {
+    double* const out[3] = { pitch, roll, yaw };
+    const double* const in[3] = { velocityNorth, velocityUp, velocityEast };
+
+    forEachBlock(out, in, count, [&](double* const* o, const double* const* p) {
+        Vec vn = Vec::load(p[0]);
+        Vec vu = Vec::load(p[1]);
+        Vec ve = Vec::load(p[2]);
+        Vec horizontalSq = fmadd(vn, vn, ve * ve);
+        auto moving = fmadd(vu, vu, horizontalSq) > Vec(1e-6);
+        select(moving, simd::atan2Fast(vu, sqrt(horizontalSq)), Vec(0.0)).store(o[0]);
+        Vec(0.0).store(o[1]);
+        select(moving, simd::atan2Fast(ve, vn), Vec(0.0)).store(o[2]);
+    });
+}
+
+// 偏航只在超出 [-pi, pi] 时回绕，边界值 ±pi 保持不变（与逐个版本的 while 循环一致）
+inline void limitAttitudeKernel(double* pitch, double* roll, double* yaw, std::size_t count,
+                                double maxPitch, double maxRoll) {
+    double* const out[3] = { pitch, roll, yaw };
+    const double* const in[1] = { yaw };   // 无只读输入，forEachBlock 至少需要一个，偏航兼作占位
+    const Vec pitchLimit(maxPitch);
+    const Vec rollLimit(maxRoll);
+    const Vec pi(3.14159265358979323846);
+    const Vec twoPi(2.0 * 3.14159265358979323846);
+    const Vec invTwoPi(0.5 / 3.14159265358979323846);
+
+    forEachBlock(out, in, count, [&](double* const* o, const double* const*) {
+        max(-pitchLimit, min(pitchLimit, Vec::load(o[0]))).store(o[0]);
+        max(-rollLimit, min(rollLimit, Vec::load(o[1]))).store(o[1]);
+        Vec y = Vec::load(o[2]);
+        Vec turns = select(abs(y) > pi, round(y * invTwoPi), Vec(0.0));
+        fmadd(-turns, twoPi, y).store(o[2]);
+    });
+}
+
+// ===== 四元数批量换算 =====
+inline void quaternionToEulerKernel(const double* w, const double* x, const double* y, const double* z,
+                                    double* pitch, double* roll, double* yaw, std::size_t count) {
+    double* const out[3] = { pitch, roll, yaw };
+    const double* const in[4] = { w, x, y, z };
+    const Vec one(1.0);
+    const Vec two(2.0);
+
+    forEachBlock(out, in, count, [&](double* const* o, const double* const* p) {
+        Vec qw = Vec::load(p[0]);
+        Vec qx = Vec::load(p[1]);
+        Vec qy = Vec::load(p[2]);
+        Vec qz = Vec::load(p[3]);
+        Vec s = max(-one, min(one, two * (qw * qy - qz * qx)));
+        simd::atan2(s, sqrt(one - s * s)).store(o[0]);
+        simd::atan2(two * fmadd(qw, qx, qy * qz), one - two * fmadd(qx, qx, qy * qy)).store(o[1]);
+        simd::atan2(two * fmadd(qw, qz, qx * qy), one - two * fmadd(qy, qy, qz * qz)).store(o[2]);
+    });
+}
+
+// 输出为逐个矩阵交错存放，每W个四元数算出9个元素向量后拆开写回
+inline void quaternionToDCMKernel(const double* w, const double* x, const double* y, const double* z,
+                                  DirectionCosineMatrix* dcm, std::size_t count) {
+    const Vec one(1.0);
+    const Vec two(2.0);
+    for (std::size_t i = 0; i < count; i += W) {
+        std::size_t n = (count - i < static_cast<std::size_t>(W)) ? count - i : W;
+        Vec qw, qx, qy, qz;
+        if (n == static_cast<std::size_t>(W)) {
+            qw = Vec::load(w + i);
+            qx = Vec::load(x + i);
+            qy = Vec::load(y + i);
+            qz = Vec::load(z + i);
+        } else {
+            double ws[W] = {}, xs[W] = {}, ys[W] = {}, zs[W] = {};
+            std::memcpy(ws, w + i, n * sizeof(double));
+            std::memcpy(xs, x + i, n * sizeof(double));
+            std::memcpy(ys, y + i, n * sizeof(double));
+            std::memcpy(zs, z + i, n * sizeof(double));
+            qw = Vec::load(ws);
+            qx = Vec::load(xs);
+            qy = Vec::load(ys);
+            qz = Vec::load(zs);
+        }
+
+        Vec xx = qx * qx, yy = qy * qy, zz = qz * qz;
+        Vec xy = qx * qy, xz = qx * qz, yz = qy * qz;
+        Vec wx = qw * qx, wy = qw * qy, wz = qw * qz;
+        double e[9][W];
+        (one - two * (yy + zz)).store(e[0]);
+        (two * (xy - wz)).store(e[1]);
+        (two * (xz + wy)).store(e[2]);
+        (two * (wy - xz)).store(e[3]);
+        (-(two * (yz + wx))).store(e[4]);
+        (two * (xx + yy) - one).store(e[5]);
+        (two * (xy + wz)).store(e[6]);
+        (one - two * (xx + zz)).store(e[7]);
+        (two * (yz - wx)).store(e[8]);
+        for (std::size_t k = 0; k < n; ++k) {
+            double* m = &dcm[i + k].m[0][0];
+            for (int c = 0; c < 9; ++c) m[c] = e[c][k];
+        }
+    }
+}
+
+// ===== Vincenty反算（一个起点对一组终点） =====
+// 与 λ 无关的 cosU1·cosU2、sinU1·sinU2 等乘积在迭代前算好；每次迭代后只更新仍在迭代的车道，
+// 收敛（|Δλ| <= 1e-12）、出现 NaN 或两点重合（sinσ = 0）的车道退出，整组车道都退出即结束。
+// 迭代结束后按最终的 λ 计算距离与方位角，cosSqAlpha 取各车道最后一次迭代的值（与逐对版本相同）
+inline std::size_t vincentyInverseKernel(double sinU1, double cosU1, double longitude1,
+                                         const double* sinU2, const double* cosU2, const double* longitude2,
+                                         double* distance, double* bearing, std::size_t count) {
+    double* const out[2] = { distance, bearing };
+    const double* const in[3] = { sinU2, cosU2, longitude2 };
+    const Vec sU1(sinU1);
+    const Vec cU1(cosU1);
+    const Vec lon1(longitude1);
+    const Vec zero(0.0);
+    const Vec one(1.0);
+    const Vec two(2.0);
+    const Vec f(WGS84_F);
+    const Vec tolerance(VINCENTY_TOLERANCE);
+    const Vec nan(std::numeric_limits<double>::quiet_NaN());
+    std::size_t unconverged = 0;
+
+    forEachBlock(out, in, count, [&](double* const* o, const double* const* p) {
+        Vec sU2 = Vec::load(p[0]);
+        Vec cU2 = Vec::load(p[1]);
+        Vec L = Vec::load(p[2]) - lon1;
+        Vec cc = cU1 * cU2;
+        Vec ss = sU1 * sU2;
+        Vec cs = cU1 * sU2;
+        Vec sc = sU1 * cU2;
+
+        Vec lambda = L;
+        Vec cosSqAlpha = zero;
+        auto active = zero == zero;
+        auto coincident = zero != zero;
+        for (int iteration = 0; iteration < VINCENTY_MAX_ITERATIONS && any(active); ++iteration) {
+            Vec sinLambda, cosLambda;
+            simd::sincos(lambda, sinLambda, cosLambda);
+            Vec t1 = cU2 * sinLambda;
+            Vec t2 = cs - sc * cosLambda;
+            Vec sinSigma = sqrt(t1 * t1 + t2 * t2);
+            auto zeroSigma = active & (sinSigma == zero);
+            coincident = coincident | zeroSigma;
+            active = active & !zeroSigma;
+
+            Vec cosSigma = ss + cc * cosLambda;
+            Vec sigma = simd::atan2(sinSigma, cosSigma);
+            Vec sinAlpha = cc * sinLambda / sinSigma;
+            Vec newCosSqAlpha = one - sinAlpha * sinAlpha;
+            Vec cos2SigmaM = select(newCosSqAlpha != zero, cosSigma - two * ss / newCosSqAlpha, zero);
+            Vec C = f / Vec(16.0) * newCosSqAlpha * (Vec(4.0) + f * (Vec(4.0) - Vec(3.0) * newCosSqAlpha));
+            Vec newLambda = L + (one - C) * f * sinAlpha *
+                            (sigma + C * sinSigma * (cos2SigmaM + C * cosSigma * (two * cos2SigmaM * cos2SigmaM - one)));
+            cosSqAlpha = select(active, newCosSqAlpha, cosSqAlpha);
+            Vec previous = lambda;
+            lambda = select(active, newLambda, lambda);
+            active = active & (abs(lambda - previous) > tolerance);
+        }
+
+        Vec sinLambda, cosLambda;
+        simd::sincos(lambda, sinLambda, cosLambda);
+        Vec t1 = cU2 * sinLambda;
+        Vec t2 = cs - sc * cosLambda;
+        Vec sinSigma = sqrt(t1 * t1 + t2 * t2);
+        Vec cosSigma = ss + cc * cosLambda;
+        Vec sigma = simd::atan2(sinSigma, cosSigma);
+        Vec cos2SigmaM = select(cosSqAlpha != zero, cosSigma - two * ss / cosSqAlpha, zero);
+        Vec cos2SigmaMSq = cos2SigmaM * cos2SigmaM;
+
+        Vec uSq = cosSqAlpha * Vec((WGS84_A * WGS84_A - WGS84_B * WGS84_B) / (WGS84_B * WGS84_B));
+        Vec A = one + uSq / Vec(16384.0) * (Vec(4096.0) + uSq * (Vec(-768.0) + uSq * (Vec(320.0) - Vec(175.0) * uSq)));
+        Vec B = uSq / Vec(1024.0) * (Vec(256.0) + uSq * (Vec(-128.0) + uSq * (Vec(74.0) - Vec(47.0) * uSq)));
+        Vec deltaSigma = B * sinSigma * (cos2SigmaM + B / Vec(4.0) * (cosSigma * (two * cos2SigmaMSq - one) -
+                         B / Vec(6.0) * cos2SigmaM * (Vec(4.0) * sinSigma * sinSigma - Vec(3.0)) *
+                         (Vec(4.0) * cos2SigmaMSq - Vec(3.0))));
+        Vec s = Vec(WGS84_B) * A * (sigma - deltaSigma);
+        Vec azimuth = simd::atan2(t1, t2) * Vec(RAD_TO_DEG);
+        azimuth = select(azimuth < zero, azimuth + Vec(360.0), azimuth);
+
+        select(active, nan, select(coincident, zero, s)).store(o[0]);
+        select(active, nan, select(coincident, zero, azimuth)).store(o[1]);
+        // 尾部补零的车道 cosU2 = 0，sinσ = 0 按重合点处理，不计入不收敛数
+        double flags[W];
+        select(active, one, zero).store(flags);
+        for (int k = 0; k < W; ++k) unconverged += flags[k] != 0.0;
+    });
+    return unconverged;
+}
+
+} // namespace SIMD_KERNEL_NS
+} // namespace simd
@@ -0,0 +1,38 @@
+// AVX2 + FMA 级别内核（本文件需以 -mavx2 -mfma 或 /arch:AVX2 编译）
+#include "SimdKernels.h"
+
+// MSVC 的 /arch:AVX2 不定义 __FMA__，但同样生成FMA指令
+#if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+
+#define SIMD_KERNEL_NS avx2
+#define SIMD_KERNEL_VEC simd::VecAVX2
+#include "SimdKernels.inl"
+
+namespace simd {
+namespace {
+const SimdKernelTable table = {
+    SimdLevel::AVX2,
+    &avx2::updateGeoPositionKernel,
+    &avx2::stepKinematicsKernel,
+    &avx2::stepKinematicsRK4Kernel,
+    &avx2::stepKinematicsRK45Kernel,
+    &avx2::stepKinematicsECEFKernel,
+    &avx2::geodeticToECEFKernel,
+    &avx2::ecefToGeodeticKernel,
+    &avx2::evaluatePiecewiseCubicKernel,
+    &avx2::attitudeFromVelocityKernel,
+    &avx2::limitAttitudeKernel,
+    &avx2::quaternionToEulerKernel,
+    &avx2::quaternionToDCMKernel,
+    &avx2::vincentyInverseKernel,
+};
+} // namespace
+
+const SimdKernelTable* avx2KernelTable() { return &table; }
+} // namespace simd
+
+#else
+
+const SimdKernelTable* simd::avx2KernelTable() { return nullptr; }
+
+#endif
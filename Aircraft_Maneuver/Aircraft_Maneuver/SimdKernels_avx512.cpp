@@ -0,0 +1,37 @@
+// AVX-512F 级别内核（本文件需以 -mavx512f -mavx2 -mfma 或 /arch:AVX512 编译）
+#include "SimdKernels.h"
+
+#if defined(__AVX512F__)
+
+#define SIMD_KERNEL_NS avx512
+#define SIMD_KERNEL_VEC simd::VecAVX512
+#include "SimdKernels.inl"
+
+namespace simd {
+namespace {
+const SimdKernelTable table = {
+    SimdLevel::AVX512,
+    &avx512::updateGeoPositionKernel,
+    &avx512::stepKinematicsKernel,
+    &avx512::stepKinematicsRK4Kernel,
+    &avx512::stepKinematicsRK45Kernel,
+    &avx512::stepKinematicsECEFKernel,
+    &avx512::geodeticToECEFKernel,
+    &avx512::ecefToGeodeticKernel,
+    &avx512::evaluatePiecewiseCubicKernel,
+    &avx512::attitudeFromVelocityKernel,
+    &avx512::limitAttitudeKernel,
+    &avx512::quaternionToEulerKernel,
+    &avx512::quaternionToDCMKernel,
+    &avx512::vincentyInverseKernel,
+};
+} // namespace
+
+const SimdKernelTable* avx512KernelTable() { return &table; }
+} // namespace simd
+
+#else
+
+const SimdKernelTable* simd::avx512KernelTable() { return nullptr; }
+
+#endif
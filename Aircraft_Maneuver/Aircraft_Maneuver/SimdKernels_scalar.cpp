@@ -0,0 +1,214 @@
+// 可移植标量内核（不依赖任何指令集扩展，作为所有平台的回退实现）
+#include "SimdKernels.h"
+#include <cmath>
+#include <limits>
+
+#define SIMD_KERNEL_NS scalar
+#define SIMD_KERNEL_VEC simd::VecScalar
+#include "SimdKernels.inl"
+
+namespace simd {
+namespace scalar {
+
+constexpr double PI = 3.14159265358979323846;
+
+// 标量回退直接使用 std::cos，与 updateGeoPosition 结果逐位一致
+void updateGeoPositionExact(double* latitude, double* longitude, double* altitude,
+                            const double* velocityNorth, const double* velocityUp,
+                            const double* velocityEast, std::size_t count, double dt) {
+    for (std::size_t i = 0; i < count; ++i) {
+        double dNorth = velocityNorth[i] * dt;
+        double dEast = velocityEast[i] * dt;
+        double radiusAtLat = EARTH_RADIUS * std::cos(latitude[i] * PI / 180.0);
+        latitude[i] += (dNorth / EARTH_RADIUS) * (180.0 / PI);
+        if (std::abs(radiusAtLat) > 1e-6)
+            longitude[i] += (dEast / radiusAtLat) * (180.0 / PI);
+        altitude[i] += velocityUp[i] * dt;
+    }
+}
+
+// 标量回退：运算顺序与 Aircraft::updateKinematics / updateGeoPosition 相同，结果逐位一致
+void stepKinematicsExact(double* latitude, double* longitude, double* altitude,
+                         double* velocityNorth, double* velocityUp, double* velocityEast,
+                         const double* thrust, const double* dragCoefficient, const double* mass,
+                         std::size_t count, double dt) {
+    for (std::size_t i = 0; i < count; ++i) {
+        double vn = velocityNorth[i];
+        double vu = velocityUp[i];
+        double ve = velocityEast[i];
+        double speed = std::sqrt(vn * vn + vu * vu + ve * ve);
+        if (speed > 1e-3) {
+            double thrustAcc = thrust[i] / mass[i];
+            double dragAcc = dragCoefficient[i] * speed * speed / mass[i];
+            double netAcc = thrustAcc - dragAcc;
+            vn += netAcc * (vn / speed) * dt;
+            vu += netAcc * (vu / speed) * dt;
+            ve += netAcc * (ve / speed) * dt;
+            velocityNorth[i] = vn;
+            velocityUp[i] = vu;
+            velocityEast[i] = ve;
+        }
+
+        double radiusAtLat = EARTH_RADIUS * std::cos(latitude[i] * PI / 180.0);
+        latitude[i] += (vn * dt / EARTH_RADIUS) * (180.0 / PI);
+        if (std::abs(radiusAtLat) > 1e-6)
+            longitude[i] += (ve * dt / radiusAtLat) * (180.0 / PI);
+        altitude[i] += vu * dt;
+    }
+}
+
+// 标量回退：与 CoordinateTransform::geodeticToECEF 逐点版本运算顺序相同
+void geodeticToECEFExact(const GeoPosition* geodetic, double* ecef, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        double lat = geodetic[i].latitude * PI / 180.0;
+        double lon = geodetic[i].longitude * PI / 180.0;
+        double h = geodetic[i].altitude;
+        double N = WGS84_A / std::sqrt(1 - WGS84_E2 * std::sin(lat) * std::sin(lat));
+        ecef[3 * i] = (N + h) * std::cos(lat) * std::cos(lon);
+        ecef[3 * i + 1] = (N + h) * std::cos(lat) * std::sin(lon);
+        ecef[3 * i + 2] = (N * (1 - WGS84_E2) + h) * std::sin(lat);
+    }
+}
+
+// 标量回退：与 CoordinateTransform::ecefToGeodetic 逐点版本的迭代相同
+void ecefToGeodeticExact(const double* ecef, GeoPosition* geodetic, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        double x = ecef[3 * i];
+        double y = ecef[3 * i + 1];
+        double z = ecef[3 * i + 2];
+        double p = std::sqrt(x * x + y * y);
+        double lat = std::atan2(z, p * (1 - WGS84_E2));
+        for (int k = 0; k < 5; ++k) {
+            double N = WGS84_A / std::sqrt(1 - WGS84_E2 * std::sin(lat) * std::sin(lat));
+            double h = p / std::cos(lat) - N;
+            double latNew = std::atan2(z, p * (1 - WGS84_E2 * N / (N + h)));
+            if (std::abs(lat - latNew) < 1e-12) break;
+            lat = latNew;
+        }
+        double N = WGS84_A / std::sqrt(1 - WGS84_E2 * std::sin(lat) * std::sin(lat));
+        geodetic[i].latitude = lat * 180.0 / PI;
+        geodetic[i].longitude = std::atan2(y, x) * 180.0 / PI;
+        geodetic[i].altitude = p / std::cos(lat) - N;
+    }
+}
+
+// 标量回退：与 EulerAngleCalculator::calculateFromVelocity 运算顺序相同，结果逐位一致
+void attitudeFromVelocityExact(const double* velocityNorth, const double* velocityUp, const double* velocityEast,
+                               double* pitch, double* roll, double* yaw, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        double vn = velocityNorth[i];
+        double vu = velocityUp[i];
+        double ve = velocityEast[i];
+        double speed = std::sqrt(vn * vn + ve * ve + vu * vu);
+        pitch[i] = 0.0;
+        roll[i] = 0.0;
+        yaw[i] = 0.0;
+        if (speed > 1e-3) {
+            pitch[i] = std::atan2(vu, std::sqrt(vn * vn + ve * ve));
+            yaw[i] = std::atan2(ve, vn);
+        }
+    }
+}
+
+// 标量回退：与 EulerAngleCalculator::limitAttitudeAngles 相同（偏航逐周回绕）
+void limitAttitudeExact(double* pitch, double* roll, double* yaw, std::size_t count,
+                        double maxPitch, double maxRoll) {
+    for (std::size_t i = 0; i < count; ++i) {
+        pitch[i] = std::max(-maxPitch, std::min(maxPitch, pitch[i]));
+        roll[i] = std::max(-maxRoll, std::min(maxRoll, roll[i]));
+        double y = yaw[i];
+        while (y > PI) y -= 2.0 * PI;
+        while (y < -PI) y += 2.0 * PI;
+        yaw[i] = y;
+    }
+}
+
+// 标量回退：与 ImprovedCoordinateTransform::vincentyInverse 运算顺序相同，收敛时结果逐位一致
+std::size_t vincentyInverseExact(double sinU1, double cosU1, double longitude1,
+                                 const double* sinU2, const double* cosU2, const double* longitude2,
+                                 double* distance, double* bearing, std::size_t count) {
+    std::size_t unconverged = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        double L = longitude2[i] - longitude1;
+        double lambda = L;
+        double lambdaP = L;
+        double cosSqAlpha = 0;
+        int iterations = 0;
+        bool coincident = false;
+        do {
+            double sinLambda = std::sin(lambda);
+            double cosLambda = std::cos(lambda);
+            double sinSigma = std::sqrt((cosU2[i] * sinLambda) * (cosU2[i] * sinLambda) +
+                                        (cosU1 * sinU2[i] - sinU1 * cosU2[i] * cosLambda) *
+                                        (cosU1 * sinU2[i] - sinU1 * cosU2[i] * cosLambda));
+            if (sinSigma == 0) {
+                coincident = true;
+                break;
+            }
+            double cosSigma = sinU1 * sinU2[i] + cosU1 * cosU2[i] * cosLambda;
+            double sigma = std::atan2(sinSigma, cosSigma);
+            double sinAlpha = cosU1 * cosU2[i] * sinLambda / sinSigma;
+            cosSqAlpha = 1 - sinAlpha * sinAlpha;
+            double cos2SigmaM = cosSqAlpha != 0 ? cosSigma - 2 * sinU1 * sinU2[i] / cosSqAlpha : 0.0;
+            double C = WGS84_F / 16 * cosSqAlpha * (4 + WGS84_F * (4 - 3 * cosSqAlpha));
+            lambdaP = lambda;
+            lambda = L + (1 - C) * WGS84_F * sinAlpha *
+                     (sigma + C * sinSigma * (cos2SigmaM + C * cosSigma * (-1 + 2 * cos2SigmaM * cos2SigmaM)));
+        } while (std::abs(lambda - lambdaP) > VINCENTY_TOLERANCE && ++iterations < VINCENTY_MAX_ITERATIONS);
+
+        if (coincident) {
+            distance[i] = 0;
+            bearing[i] = 0;
+            continue;
+        }
+        if (std::abs(lambda - lambdaP) > VINCENTY_TOLERANCE) {
+            distance[i] = std::numeric_limits<double>::quiet_NaN();
+            bearing[i] = std::numeric_limits<double>::quiet_NaN();
+            ++unconverged;
+            continue;
+        }
+
+        double uSq = cosSqAlpha * (WGS84_A * WGS84_A - WGS84_B * WGS84_B) / (WGS84_B * WGS84_B);
+        double A = 1 + uSq / 16384 * (4096 + uSq * (-768 + uSq * (320 - 175 * uSq)));
+        double B = uSq / 1024 * (256 + uSq * (-128 + uSq * (74 - 47 * uSq)));
+        double sinLambda = std::sin(lambda);
+        double cosLambda = std::cos(lambda);
+        double sinSigma = std::sqrt((cosU2[i] * sinLambda) * (cosU2[i] * sinLambda) +
+                                    (cosU1 * sinU2[i] - sinU1 * cosU2[i] * cosLambda) *
+                                    (cosU1 * sinU2[i] - sinU1 * cosU2[i] * cosLambda));
+        double cosSigma = sinU1 * sinU2[i] + cosU1 * cosU2[i] * cosLambda;
+        double sigma = std::atan2(sinSigma, cosSigma);
+        double cos2SigmaM = cosSqAlpha != 0 ? cosSigma - 2 * sinU1 * sinU2[i] / cosSqAlpha : 0.0;
+        double deltaSigma = B * sinSigma * (cos2SigmaM + B / 4 * (cosSigma * (-1 + 2 * cos2SigmaM * cos2SigmaM) -
+                            B / 6 * cos2SigmaM * (-3 + 4 * sinSigma * sinSigma) * (-3 + 4 * cos2SigmaM * cos2SigmaM)));
+        distance[i] = WGS84_B * A * (sigma - deltaSigma);
+        double azimuth = std::atan2(cosU2[i] * sinLambda, cosU1 * sinU2[i] - sinU1 * cosU2[i] * cosLambda) *
+                         180.0 / PI;
+        bearing[i] = azimuth < 0 ? azimuth + 360.0 : azimuth;
+    }
+    return unconverged;
+}
+
+} // namespace scalar
+
+namespace {
+const SimdKernelTable table = {
+    SimdLevel::Scalar,
+    &scalar::updateGeoPositionExact,
+    &scalar::stepKinematicsExact,
+    &scalar::stepKinematicsRK4Kernel,
+    &scalar::stepKinematicsRK45Kernel,
+    &scalar::stepKinematicsECEFKernel,
+    &scalar::geodeticToECEFExact,
+    &scalar::ecefToGeodeticExact,
+    &scalar::evaluatePiecewiseCubicKernel,
+    &scalar::attitudeFromVelocityExact,
+    &scalar::limitAttitudeExact,
+    &scalar::quaternionToEulerKernel,
+    &scalar::quaternionToDCMKernel,
+    &scalar::vincentyInverseExact,
+};
+} // namespace
+
+const SimdKernelTable* scalarKernelTable() { return &table; }
+} // namespace simd
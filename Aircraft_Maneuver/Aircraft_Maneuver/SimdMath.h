@@ -0,0 +1,190 @@
+#ifndef SIMD_MATH_H
+#define SIMD_MATH_H
+
+// 向量化初等函数（对 SimdVec.h 中任意向量类型通用）
+//
+// 精度（与 std::sin/std::cos/std::atan2 对比，test_simd_kernels 中验证）：
+//   sin/cos : |x| <= 1e6 弧度时绝对误差 < 5e-16（多项式为Cephes在[-pi/4, pi/4]上的极小极大逼近，
+//             区间约简使用三段Cody-Waite拆分的pi/2）
+//   atan/atan2 : 全定义域绝对误差 < 5e-16 弧度
+//   atan2Fast : 全定义域绝对误差 < 3e-7 弧度（只用一次除法和多项式，供姿态角等低精度场合批量使用）
+// 不处理NaN/无穷大输入的特殊语义（输入应为有限值）
+
+#include "SimdVec.h"
+
+namespace simd {
+
+namespace detail {
+// pi/2 的三段拆分（Cephes DP1~DP3 的2倍），n*DP1 在 |n| < 2^29 时精确
+constexpr double PIO2_1 = 1.570796251296997070312;
+constexpr double PIO2_2 = 7.549789415861596353e-8;
+constexpr double PIO2_3 = 5.3903028581581190529e-15;
+constexpr double TWO_OVER_PI = 0.63661977236758134308;
+
+// [-pi/4, pi/4] 上的 sin/cos 多项式系数
+constexpr double S0 = 1.58962301576546568060E-10;
+constexpr double S1 = -2.50507477628578072866E-8;
+constexpr double S2 = 2.75573136213857245213E-6;
+constexpr double S3 = -1.98412698295895385996E-4;
+constexpr double S4 = 8.33333333332211858878E-3;
+constexpr double S5 = -1.66666666666666307295E-1;
+
+constexpr double C0 = -1.13585365213876817300E-11;
+constexpr double C1 = 2.08757008419747316778E-9;
+constexpr double C2 = -2.75573141792967388112E-7;
+constexpr double C3 = 2.48015872888517045348E-5;
+constexpr double C4 = -1.38888888888730564116E-3;
+constexpr double C5 = 4.16666666666665929218E-2;
+
+// atan 有理逼近系数（[0, 0.66]）
+constexpr double P0 = -8.750608600031904122785E-1;
+constexpr double P1 = -1.615753718733365076637E1;
+constexpr double P2 = -7.500855792314704667340E1;
+constexpr double P3 = -1.228866684490136173410E2;
+constexpr double P4 = -6.485021904942025371773E1;
+constexpr double Q0 = 2.485846490142306297962E1;
+constexpr double Q1 = 1.650270098316988542046E2;
+constexpr double Q2 = 4.328810604912902668951E2;
+constexpr double Q3 = 4.853903996359136964868E2;
+constexpr double Q4 = 1.945506571482613964425E2;
+constexpr double MOREBITS = 6.123233995736765886130E-17;
+
+// atanFast 在 [0, 1] 上的奇次极小极大多项式系数：atan(x) ≈ x·Σ Fk·x^(2k)，逼近误差 2.5e-7
+constexpr double F0 = 9.99996111549570910e-01;
+constexpr double F1 = -3.33173680547493301e-01;
+constexpr double F2 = 1.98078155649891785e-01;
+constexpr double F3 = -1.32333420955746295e-01;
+constexpr double F4 = 7.96236723656165851e-02;
+constexpr double F5 = -3.36042205650249962e-02;
+constexpr double F6 = 6.81179329087325171e-03;
+
+constexpr double PI = 3.14159265358979323846;
+constexpr double PIO2 = 1.57079632679489661923;
+constexpr double PIO4 = 0.78539816339744830962;
+
+// 判断整数值n（以double表示）是否为奇数
+template<class V>
+inline typename V::Mask isOdd(V n) {
+    V half = n * V(0.5);
+    return half != floor(half);
+}
+
+// [-pi/4, pi/4] 上的 sin 与 cos
+template<class V>
+inline void sincosReduced(V r, V& s, V& c) {
+    V z = r * r;
+    V ps = fmadd(fmadd(fmadd(fmadd(fmadd(V(S0), z, V(S1)), z, V(S2)), z, V(S3)), z, V(S4)), z, V(S5));
+    s = fmadd(r * z, ps, r);
+    V pc = fmadd(fmadd(fmadd(fmadd(fmadd(V(C0), z, V(C1)), z, V(C2)), z, V(C3)), z, V(C4)), z, V(C5));
+    c = fmadd(z * z, pc, fmadd(V(-0.5), z, V(1.0)));
+}
+
+// x = n*pi/2 + r，|r| <= pi/4
+template<class V>
+inline V reduce(V x, V& n) {
+    n = round(x * V(TWO_OVER_PI));
+    V r = fmadd(-n, V(PIO2_1), x);
+    r = fmadd(-n, V(PIO2_2), r);
+    r = fmadd(-n, V(PIO2_3), r);
+    return r;
+}
+
+// [0, 1] 上的 atan
+template<class V>
+inline V atanUnit(V x) {
+    // x > 0.66 时使用 atan(x) = pi/4 + atan((x-1)/(x+1))
+    auto big = x > V(0.66);
+    V xr = select(big, (x - V(1.0)) / (x + V(1.0)), x);
+    V z = xr * xr;
+    V p = fmadd(fmadd(fmadd(fmadd(V(P0), z, V(P1)), z, V(P2)), z, V(P3)), z, V(P4));
+    V q = fmadd(fmadd(fmadd(fmadd(z + V(Q0), z, V(Q1)), z, V(Q2)), z, V(Q3)), z, V(Q4));
+    V y = fmadd(xr * z, p / q, xr);
+    return select(big, (y + V(0.5 * MOREBITS)) + V(PIO4), y);
+}
+
+// [0, 1] 上的低精度 atan（不做区间约简）
+template<class V>
+inline V atanUnitFast(V x) {
+    V z = x * x;
+    V p = fmadd(fmadd(fmadd(fmadd(fmadd(fmadd(V(F6), z, V(F5)), z, V(F4)), z, V(F3)), z, V(F2)), z, V(F1)), z, V(F0));
+    return x * p;
+}
+} // namespace detail
+
+// 同时计算 sin 与 cos
+template<class V>
+inline void sincos(V x, V& s, V& c) {
+    V n;
+    V r = detail::reduce(x, n);
+    V sr, cr;
+    detail::sincosReduced(r, sr, cr);
+    // 象限：n mod 4 = 0: (s, c); 1: (c, -s); 2: (-s, -c); 3: (-c, s)
+    auto swap = detail::isOdd(n);
+    V s0 = select(swap, cr, sr);
+    V c0 = select(swap, sr, cr);
+    V q = floor(n * V(0.5));
+    auto sinNeg = detail::isOdd(q);
+    auto cosNeg = detail::isOdd(floor((n + V(1.0)) * V(0.5)));
+    s = select(sinNeg, -s0, s0);
+    c = select(cosNeg, -c0, c0);
+}
+
+template<class V>
+inline V sin(V x) {
+    V s, c;
+    sincos(x, s, c);
+    return s;
+}
+
+template<class V>
+inline V cos(V x) {
+    V n;
+    V r = detail::reduce(x, n);
+    V sr, cr;
+    detail::sincosReduced(r, sr, cr);
+    V c0 = select(detail::isOdd(n), sr, cr);
+    auto neg = detail::isOdd(floor((n + V(1.0)) * V(0.5)));
+    return select(neg, -c0, c0);
+}
+
+template<class V>
+inline V atan(V x) {
+    V ax = abs(x);
+    auto large = ax > V(1.0);
+    V t = detail::atanUnit(select(large, V(1.0) / ax, ax));
+    t = select(large, (V(detail::PIO2) - t) + V(detail::MOREBITS), t);
+    return select(x < V(0.0), -t, t);
+}
+
+// 四象限反正切，与 std::atan2 约定一致（按符号位区分 ±0）
+template<class V>
+inline V atan2(V y, V x) {
+    V ax = abs(x);
+    V ay = abs(y);
+    V mx = max(ax, ay);
+    V mn = min(ax, ay);
+    auto zero = mx == V(0.0);
+    V ratio = select(zero, V(0.0), mn / select(zero, V(1.0), mx));
+    V t = detail::atanUnit(ratio);
+    t = select(ay > ax, (V(detail::PIO2) - t) + V(detail::MOREBITS), t);
+    t = select(signBit(x), (V(detail::PI) - t) + V(2.0 * detail::MOREBITS), t);
+    return select(signBit(y), -t, t);
+}
+
+// 低精度四象限反正切，象限约定与 atan2 相同；折叠到 [0, 1] 后直接用多项式，误差界见文件头
+template<class V>
+inline V atan2Fast(V y, V x) {
+    V ax = abs(x);
+    V ay = abs(y);
+    V mx = max(ax, ay);
+    V mn = min(ax, ay);
+    auto zero = mx == V(0.0);
+    V t = detail::atanUnitFast(select(zero, V(0.0), mn / select(zero, V(1.0), mx)));
+    t = select(ay > ax, V(detail::PIO2) - t, t);
+    t = select(signBit(x), V(detail::PI) - t, t);
+    return select(signBit(y), -t, t);
+}
+
+} // namespace simd
+
+#endif // SIMD_MATH_H
@@ -0,0 +1,84 @@
+#include "SimdSupport.h"
+#include "SimdKernels.h"
+#include <atomic>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+namespace {
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+// MSVC：通过cpuid与xgetbv检测（需同时确认操作系统保存了YMM/ZMM寄存器）
+bool cpuHasAVX2() {
+    int info[4];
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool fma = (info[2] & (1 << 12)) != 0;
+    if (!osxsave || !fma) return false;
+    if ((_xgetbv(0) & 0x6) != 0x6) return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+}
+
+bool cpuHasAVX512() {
+    if (!cpuHasAVX2()) return false;
+    if ((_xgetbv(0) & 0xE6) != 0xE6) return false;
+    int info[4];
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 16)) != 0;
+}
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+// GCC/Clang：__builtin_cpu_supports已包含操作系统支持检查
+bool cpuHasAVX2() {
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+
+bool cpuHasAVX512() {
+    return cpuHasAVX2() && __builtin_cpu_supports("avx512f");
+}
+#else
+bool cpuHasAVX2() { return false; }
+bool cpuHasAVX512() { return false; }
+#endif
+
+// 只有同时编译进了对应级别的内核表才会选用
+SimdLevel detectOnce() {
+    if (simd::avx512KernelTable() && cpuHasAVX512()) return SimdLevel::AVX512;
+    if (simd::avx2KernelTable() && cpuHasAVX2()) return SimdLevel::AVX2;
+    return SimdLevel::Scalar;
+}
+
+std::atomic<int> activeLevel{ -1 };
+
+} // namespace
+
+SimdLevel detectSimdLevel() {
+    static const SimdLevel detected = detectOnce();
+    return detected;
+}
+
+SimdLevel getActiveSimdLevel() {
+    int level = activeLevel.load(std::memory_order_relaxed);
+    if (level < 0) {
+        return detectSimdLevel();
+    }
+    return static_cast<SimdLevel>(level);
+}
+
+void setActiveSimdLevel(SimdLevel level) {
+    SimdLevel best = detectSimdLevel();
+    if (static_cast<int>(level) > static_cast<int>(best)) {
+        level = best;
+    }
+    activeLevel.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+const char* getSimdLevelName(SimdLevel level) {
+    switch (level) {
+    case SimdLevel::AVX2: return "AVX2";
+    case SimdLevel::AVX512: return "AVX-512";
+    default: return "Scalar";
+    }
+}
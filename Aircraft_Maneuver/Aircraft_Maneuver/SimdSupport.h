@@ -0,0 +1,23 @@
+#ifndef SIMD_SUPPORT_H
+#define SIMD_SUPPORT_H
+
+// SIMD指令集级别
+enum class SimdLevel {
+    Scalar = 0,   // 可移植标量实现
+    AVX2 = 1,     // AVX2 + FMA，每次4个double
+    AVX512 = 2    // AVX-512F，每次8个double
+};
+
+// 检测当前CPU与本次编译都支持的最高级别
+SimdLevel detectSimdLevel();
+
+// 当前批量算法实际使用的级别（默认等于detectSimdLevel()）
+SimdLevel getActiveSimdLevel();
+
+// 强制使用指定级别（用于测试与基准对比），超过detectSimdLevel()时取detectSimdLevel()
+void setActiveSimdLevel(SimdLevel level);
+
+// 级别名称
+const char* getSimdLevelName(SimdLevel level);
+
+#endif // SIMD_SUPPORT_H
@@ -0,0 +1,178 @@
+#ifndef SIMD_VEC_H
+#define SIMD_VEC_H
+
+// SIMD向量封装：为批量算法提供统一的运算接口
+// VecScalar 总是可用；VecAVX2 / VecAVX512 仅在对应指令集编译选项下可用
+// （由 SimdKernels_avx2.cpp / SimdKernels_avx512.cpp 使用）
+
+#include <cmath>
+#include <cstddef>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+namespace simd {
+
+// ===== 标量（1路） =====
+struct MaskScalar {
+    bool m;
+};
+inline MaskScalar operator&(MaskScalar a, MaskScalar b) { return { a.m && b.m }; }
+inline MaskScalar operator|(MaskScalar a, MaskScalar b) { return { a.m || b.m }; }
+inline MaskScalar operator!(MaskScalar a) { return { !a.m }; }
+inline bool any(MaskScalar a) { return a.m; }
+inline bool all(MaskScalar a) { return a.m; }
+
+struct VecScalar {
+    using Mask = MaskScalar;
+    static constexpr int width = 1;
+    double v;
+
+    VecScalar() : v(0.0) {}
+    VecScalar(double x) : v(x) {}
+
+    static VecScalar load(const double* p) { return VecScalar(*p); }
+    void store(double* p) const { *p = v; }
+    double lane(int) const { return v; }
+};
+inline VecScalar operator+(VecScalar a, VecScalar b) { return a.v + b.v; }
+inline VecScalar operator-(VecScalar a, VecScalar b) { return a.v - b.v; }
+inline VecScalar operator*(VecScalar a, VecScalar b) { return a.v * b.v; }
+inline VecScalar operator/(VecScalar a, VecScalar b) { return a.v / b.v; }
+inline VecScalar operator-(VecScalar a) { return -a.v; }
+inline MaskScalar operator<(VecScalar a, VecScalar b) { return { a.v < b.v }; }
+inline MaskScalar operator<=(VecScalar a, VecScalar b) { return { a.v <= b.v }; }
+inline MaskScalar operator>(VecScalar a, VecScalar b) { return { a.v > b.v }; }
+inline MaskScalar operator>=(VecScalar a, VecScalar b) { return { a.v >= b.v }; }
+inline MaskScalar operator==(VecScalar a, VecScalar b) { return { a.v == b.v }; }
+inline MaskScalar operator!=(VecScalar a, VecScalar b) { return { a.v != b.v }; }
+inline VecScalar fmadd(VecScalar a, VecScalar b, VecScalar c) { return a.v * b.v + c.v; }
+inline VecScalar sqrt(VecScalar a) { return std::sqrt(a.v); }
+inline VecScalar abs(VecScalar a) { return std::fabs(a.v); }
+inline VecScalar min(VecScalar a, VecScalar b) { return a.v < b.v ? a.v : b.v; }
+inline VecScalar max(VecScalar a, VecScalar b) { return a.v > b.v ? a.v : b.v; }
+inline VecScalar floor(VecScalar a) { return std::floor(a.v); }
+inline VecScalar round(VecScalar a) { return std::nearbyint(a.v); }
+inline VecScalar select(MaskScalar m, VecScalar a, VecScalar b) { return m.m ? a : b; }
+inline MaskScalar signBit(VecScalar a) { return { std::signbit(a.v) }; }
+
+#if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+// ===== AVX2（4路） =====
+struct MaskAVX2 {
+    __m256d m;
+};
+inline MaskAVX2 operator&(MaskAVX2 a, MaskAVX2 b) { return { _mm256_and_pd(a.m, b.m) }; }
+inline MaskAVX2 operator|(MaskAVX2 a, MaskAVX2 b) { return { _mm256_or_pd(a.m, b.m) }; }
+inline MaskAVX2 operator!(MaskAVX2 a) {
+    return { _mm256_xor_pd(a.m, _mm256_castsi256_pd(_mm256_set1_epi64x(-1))) };
+}
+inline bool any(MaskAVX2 a) { return _mm256_movemask_pd(a.m) != 0; }
+inline bool all(MaskAVX2 a) { return _mm256_movemask_pd(a.m) == 0xF; }
+
+struct VecAVX2 {
+    using Mask = MaskAVX2;
+    static constexpr int width = 4;
+    __m256d v;
+
+    VecAVX2() : v(_mm256_setzero_pd()) {}
+    VecAVX2(double x) : v(_mm256_set1_pd(x)) {}
+    VecAVX2(__m256d x) : v(x) {}
+
+    static VecAVX2 load(const double* p) { return _mm256_loadu_pd(p); }
+    void store(double* p) const { _mm256_storeu_pd(p, v); }
+    double lane(int i) const {
+        alignas(32) double tmp[4];
+        _mm256_store_pd(tmp, v);
+        return tmp[i];
+    }
+};
+inline VecAVX2 operator+(VecAVX2 a, VecAVX2 b) { return _mm256_add_pd(a.v, b.v); }
+inline VecAVX2 operator-(VecAVX2 a, VecAVX2 b) { return _mm256_sub_pd(a.v, b.v); }
+inline VecAVX2 operator*(VecAVX2 a, VecAVX2 b) { return _mm256_mul_pd(a.v, b.v); }
+inline VecAVX2 operator/(VecAVX2 a, VecAVX2 b) { return _mm256_div_pd(a.v, b.v); }
+inline VecAVX2 operator-(VecAVX2 a) { return _mm256_xor_pd(a.v, _mm256_set1_pd(-0.0)); }
+inline MaskAVX2 operator<(VecAVX2 a, VecAVX2 b) { return { _mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ) }; }
+inline MaskAVX2 operator<=(VecAVX2 a, VecAVX2 b) { return { _mm256_cmp_pd(a.v, b.v, _CMP_LE_OQ) }; }
+inline MaskAVX2 operator>(VecAVX2 a, VecAVX2 b) { return { _mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ) }; }
+inline MaskAVX2 operator>=(VecAVX2 a, VecAVX2 b) { return { _mm256_cmp_pd(a.v, b.v, _CMP_GE_OQ) }; }
+inline MaskAVX2 operator==(VecAVX2 a, VecAVX2 b) { return { _mm256_cmp_pd(a.v, b.v, _CMP_EQ_OQ) }; }
+inline MaskAVX2 operator!=(VecAVX2 a, VecAVX2 b) { return { _mm256_cmp_pd(a.v, b.v, _CMP_NEQ_UQ) }; }
+inline VecAVX2 fmadd(VecAVX2 a, VecAVX2 b, VecAVX2 c) { return _mm256_fmadd_pd(a.v, b.v, c.v); }
+inline VecAVX2 sqrt(VecAVX2 a) { return _mm256_sqrt_pd(a.v); }
+inline VecAVX2 abs(VecAVX2 a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a.v); }
+inline VecAVX2 min(VecAVX2 a, VecAVX2 b) { return _mm256_min_pd(a.v, b.v); }
+inline VecAVX2 max(VecAVX2 a, VecAVX2 b) { return _mm256_max_pd(a.v, b.v); }
+inline VecAVX2 floor(VecAVX2 a) { return _mm256_floor_pd(a.v); }
+inline VecAVX2 round(VecAVX2 a) {
+    return _mm256_round_pd(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+inline VecAVX2 select(MaskAVX2 m, VecAVX2 a, VecAVX2 b) { return _mm256_blendv_pd(b.v, a.v, m.m); }
+inline MaskAVX2 signBit(VecAVX2 a) {
+    return { _mm256_castsi256_pd(_mm256_cmpgt_epi64(_mm256_setzero_si256(), _mm256_castpd_si256(a.v))) };
+}
+#endif // __AVX2__
+
+#if defined(__AVX512F__)
+// ===== AVX-512（8路） =====
+struct MaskAVX512 {
+    __mmask8 m;
+};
+inline MaskAVX512 operator&(MaskAVX512 a, MaskAVX512 b) { return { static_cast<__mmask8>(a.m & b.m) }; }
+inline MaskAVX512 operator|(MaskAVX512 a, MaskAVX512 b) { return { static_cast<__mmask8>(a.m | b.m) }; }
+inline MaskAVX512 operator!(MaskAVX512 a) { return { static_cast<__mmask8>(~a.m) }; }
+inline bool any(MaskAVX512 a) { return a.m != 0; }
+inline bool all(MaskAVX512 a) { return a.m == 0xFF; }
+
+struct VecAVX512 {
+    using Mask = MaskAVX512;
+    static constexpr int width = 8;
+    __m512d v;
+
+    VecAVX512() : v(_mm512_setzero_pd()) {}
+    VecAVX512(double x) : v(_mm512_set1_pd(x)) {}
+    VecAVX512(__m512d x) : v(x) {}
+
+    static VecAVX512 load(const double* p) { return _mm512_loadu_pd(p); }
+    void store(double* p) const { _mm512_storeu_pd(p, v); }
+    double lane(int i) const {
+        alignas(64) double tmp[8];
+        _mm512_store_pd(tmp, v);
+        return tmp[i];
+    }
+};
+inline VecAVX512 operator+(VecAVX512 a, VecAVX512 b) { return _mm512_add_pd(a.v, b.v); }
+inline VecAVX512 operator-(VecAVX512 a, VecAVX512 b) { return _mm512_sub_pd(a.v, b.v); }
+inline VecAVX512 operator*(VecAVX512 a, VecAVX512 b) { return _mm512_mul_pd(a.v, b.v); }
+inline VecAVX512 operator/(VecAVX512 a, VecAVX512 b) { return _mm512_div_pd(a.v, b.v); }
+inline VecAVX512 operator-(VecAVX512 a) {
+    return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(a.v),
+                                                _mm512_set1_epi64(static_cast<long long>(0x8000000000000000ULL))));
+}
+inline MaskAVX512 operator<(VecAVX512 a, VecAVX512 b) { return { _mm512_cmp_pd_mask(a.v, b.v, _CMP_LT_OQ) }; }
+inline MaskAVX512 operator<=(VecAVX512 a, VecAVX512 b) { return { _mm512_cmp_pd_mask(a.v, b.v, _CMP_LE_OQ) }; }
+inline MaskAVX512 operator>(VecAVX512 a, VecAVX512 b) { return { _mm512_cmp_pd_mask(a.v, b.v, _CMP_GT_OQ) }; }
+inline MaskAVX512 operator>=(VecAVX512 a, VecAVX512 b) { return { _mm512_cmp_pd_mask(a.v, b.v, _CMP_GE_OQ) }; }
+inline MaskAVX512 operator==(VecAVX512 a, VecAVX512 b) { return { _mm512_cmp_pd_mask(a.v, b.v, _CMP_EQ_OQ) }; }
+inline MaskAVX512 operator!=(VecAVX512 a, VecAVX512 b) { return { _mm512_cmp_pd_mask(a.v, b.v, _CMP_NEQ_UQ) }; }
+inline VecAVX512 fmadd(VecAVX512 a, VecAVX512 b, VecAVX512 c) { return _mm512_fmadd_pd(a.v, b.v, c.v); }
+// sqrt/min/max/floor/round 使用带掩码的形式：GCC 12 的非掩码版本内部使用 _mm512_undefined_pd，会误报未初始化警告
+inline VecAVX512 sqrt(VecAVX512 a) { return _mm512_mask_sqrt_pd(a.v, 0xFF, a.v); }
+inline VecAVX512 abs(VecAVX512 a) { return _mm512_abs_pd(a.v); }
+inline VecAVX512 min(VecAVX512 a, VecAVX512 b) { return _mm512_mask_min_pd(a.v, 0xFF, a.v, b.v); }
+inline VecAVX512 max(VecAVX512 a, VecAVX512 b) { return _mm512_mask_max_pd(a.v, 0xFF, a.v, b.v); }
+inline VecAVX512 floor(VecAVX512 a) {
+    return _mm512_mask_roundscale_pd(a.v, 0xFF, a.v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+}
+inline VecAVX512 round(VecAVX512 a) {
+    return _mm512_mask_roundscale_pd(a.v, 0xFF, a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+inline VecAVX512 select(MaskAVX512 m, VecAVX512 a, VecAVX512 b) { return _mm512_mask_blend_pd(m.m, b.v, a.v); }
+inline MaskAVX512 signBit(VecAVX512 a) {
+    return { _mm512_cmplt_epi64_mask(_mm512_castpd_si512(a.v), _mm512_setzero_si512()) };
+}
+#endif // __AVX512F__
+
+} // namespace simd
+
+#endif // SIMD_VEC_H
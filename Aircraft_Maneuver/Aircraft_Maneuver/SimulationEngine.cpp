@@ -0,0 +1,39 @@
+#include "SimulationEngine.h"
+#include <algorithm>
+#include <stdexcept>
+
+SimulationEngine::SimulationEngine(std::size_t threadCount)
+    : pool(threadCount), grainSize(DEFAULT_GRAIN_SIZE), stepCount(0), time(0.0) {}
+
+std::size_t SimulationEngine::addAircraft(std::shared_ptr<Aircraft> newAircraft) {
+    if (!newAircraft) {
+        throw std::invalid_argument("SimulationEngine: aircraft is null");
+    }
+    if (std::find(aircraft.begin(), aircraft.end(), newAircraft) != aircraft.end()) {
+        throw std::invalid_argument("SimulationEngine: aircraft already added");
+    }
+    aircraft.push_back(std::move(newAircraft));
+    return aircraft.size() - 1;
+}
+
+void SimulationEngine::step(double dt) {
+    pool.parallelFor(aircraft.size(), grainSize, [this, dt](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            Aircraft& a = *aircraft[i];
+            a.updateModules(dt);
+            a.updateManeuver(dt);
+            a.updateKinematics(dt);
+        }
+    });
+    ++stepCount;
+    time += dt;
+    if (stepCallback) {
+        stepCallback(*this);
+    }
+}
+
+void SimulationEngine::run(std::size_t steps, double dt) {
+    for (std::size_t i = 0; i < steps; ++i) {
+        step(dt);
+    }
+}
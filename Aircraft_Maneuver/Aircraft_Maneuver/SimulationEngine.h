@@ -0,0 +1,56 @@
+#ifndef SIMULATION_ENGINE_H
+#define SIMULATION_ENGINE_H
+
+#include "AircraftModelLibrary.h"
+#include "ThreadPool.h"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// 多机仿真引擎：持有多架飞机，每个仿真步在线程池上并行推进所有飞机
+// 每架飞机每步执行与 main.cpp 仿真循环相同的顺序：updateModules -> updateManeuver -> updateKinematics。
+// 各飞机的更新只读写自身状态，引擎不做跨飞机的归约，因此结果与线程数、调度顺序无关，逐位一致。
+// 要求：同一个机动模型/功能模块实例不能被多架飞机共享（模型内部带有状态）。
+class SimulationEngine {
+public:
+    using StepCallback = std::function<void(const SimulationEngine&)>;
+
+    // threadCount 为参与计算的总线程数（含调用线程），0 表示使用硬件线程数
+    explicit SimulationEngine(std::size_t threadCount = 0);
+
+    // 添加飞机，返回其下标；同一架飞机重复添加抛出 std::invalid_argument
+    std::size_t addAircraft(std::shared_ptr<Aircraft> aircraft);
+
+    std::size_t size() const { return aircraft.size(); }
+    Aircraft& getAircraft(std::size_t index) { return *aircraft[index]; }
+    const Aircraft& getAircraft(std::size_t index) const { return *aircraft[index]; }
+    const std::vector<std::shared_ptr<Aircraft>>& getAircraftList() const { return aircraft; }
+
+    // 推进一步 / 连续推进 steps 步
+    void step(double dt);
+    void run(std::size_t steps, double dt);
+
+    double getTime() const { return time; }
+    std::size_t getStepCount() const { return stepCount; }
+    std::size_t getThreadCount() const { return pool.size(); }
+
+    // 每步结束后在调用线程上执行的回调（如记录轨迹），此时所有飞机已完成本步更新
+    void setStepCallback(StepCallback callback) { stepCallback = std::move(callback); }
+
+    // 每个工作块包含的飞机数（块是工作窃取的最小单位）
+    void setGrainSize(std::size_t grain) { grainSize = grain == 0 ? 1 : grain; }
+    std::size_t getGrainSize() const { return grainSize; }
+
+    static const std::size_t DEFAULT_GRAIN_SIZE = 8;
+
+private:
+    ThreadPool pool;
+    std::vector<std::shared_ptr<Aircraft>> aircraft;
+    StepCallback stepCallback;
+    std::size_t grainSize;
+    std::size_t stepCount;
+    double time;
+};
+
+#endif // SIMULATION_ENGINE_H
@@ -0,0 +1,79 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+// 无锁单生产者/单消费者环形队列
+// 只允许一个线程调用 tryPush、一个线程调用 tryPop；容量向上取整为2的幂。
+// 读写下标各占一条缓存行，并各自缓存对方下标，仅在看起来满/空时才重新读取，减少缓存行争用。
+template<class T>
+class SpscRing {
+public:
+    explicit SpscRing(std::size_t capacity)
+        : slots(roundUpPow2(capacity)), mask(slots.size() - 1),
+          head(0), cachedTail(0), tail(0), cachedHead(0) {
+        if (capacity == 0) {
+            throw std::invalid_argument("SpscRing: capacity must be positive");
+        }
+    }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    std::size_t capacity() const { return slots.size(); }
+
+    // 生产者：队列满时返回 false
+    bool tryPush(const T& value) {
+        std::size_t t = tail.load(std::memory_order_relaxed);
+        if (t - cachedHead == slots.size()) {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (t - cachedHead == slots.size()) return false;
+        }
+        slots[t & mask] = value;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 消费者：队列空时返回 false
+    bool tryPop(T& value) {
+        std::size_t h = head.load(std::memory_order_relaxed);
+        if (h == cachedTail) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (h == cachedTail) return false;
+        }
+        value = slots[h & mask];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 当前元素个数（任意线程调用时为近似值）
+    std::size_t size() const {
+        std::size_t t = tail.load(std::memory_order_acquire);
+        std::size_t h = head.load(std::memory_order_acquire);
+        return t - h;
+    }
+
+    bool empty() const { return size() == 0; }
+
+private:
+    static std::size_t roundUpPow2(std::size_t n) {
+        std::size_t p = 1;
+        while (p < n) p <<= 1;
+        return p;
+    }
+
+    std::vector<T> slots;
+    const std::size_t mask;
+
+    // 消费者侧
+    alignas(64) std::atomic<std::size_t> head;
+    std::size_t cachedTail;
+    // 生产者侧
+    alignas(64) std::atomic<std::size_t> tail;
+    std::size_t cachedHead;
+};
+
+#endif // SPSC_RING_H
@@ -0,0 +1,151 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+ThreadPool::ThreadPool(std::size_t threadCount)
+    : currentBody(nullptr), generation(0), busyWorkers(0), stopping(false), pendingChunks(0) {
+    if (threadCount == 0) {
+        threadCount = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        queues.push_back(std::make_unique<WorkQueue>());
+    }
+    workers.reserve(threadCount - 1);
+    for (std::size_t i = 1; i < threadCount; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = true;
+    }
+    wakeCondition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::parallelFor(std::size_t count, std::size_t grain,
+                             const std::function<void(std::size_t, std::size_t)>& body) {
+    if (count == 0) return;
+    grain = std::max<std::size_t>(grain, 1);
+    std::size_t chunks = (count + grain - 1) / grain;
+    if (queues.size() == 1 || chunks == 1) {
+        body(0, count);
+        return;
+    }
+
+    std::lock_guard<std::mutex> callLock(callMutex);
+
+    // 先发布任务状态再填充队列：线程只有从队列取到块后才会调用 body，队列互斥量保证 currentBody 可见
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        currentBody = &body;
+        firstError = nullptr;
+        pendingChunks.store(chunks);
+    }
+
+    // 块按顺序连续分给各线程，保持访问局部性
+    std::size_t threads = queues.size();
+    for (std::size_t t = 0; t < threads; ++t) {
+        std::size_t firstChunk = chunks * t / threads;
+        std::size_t lastChunk = chunks * (t + 1) / threads;
+        std::lock_guard<std::mutex> lock(queues[t]->mutex);
+        for (std::size_t c = firstChunk; c < lastChunk; ++c) {
+            queues[t]->ranges.emplace_back(c * grain, std::min(count, (c + 1) * grain));
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        ++generation;
+    }
+    wakeCondition.notify_all();
+
+    // 调用线程同样执行和窃取
+    while (pendingChunks.load() > 0) {
+        if (!runOne(0)) {
+            std::this_thread::yield();
+        }
+    }
+
+    // 等待所有工作线程离开本次任务后才能释放 body
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(stateMutex);
+        doneCondition.wait(lock, [this] { return busyWorkers == 0; });
+        currentBody = nullptr;
+        error = firstError;
+        firstError = nullptr;
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void ThreadPool::workerLoop(std::size_t index) {
+    std::size_t seenGeneration = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(stateMutex);
+            wakeCondition.wait(lock, [&] { return stopping || generation != seenGeneration; });
+            if (stopping) return;
+            seenGeneration = generation;
+            ++busyWorkers;
+        }
+
+        while (pendingChunks.load() > 0) {
+            if (!runOne(index)) {
+                std::this_thread::yield();
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            --busyWorkers;
+        }
+        doneCondition.notify_all();
+    }
+}
+
+bool ThreadPool::runOne(std::size_t self) {
+    std::pair<std::size_t, std::size_t> range;
+    if (!popLocal(self, range) && !steal(self, range)) {
+        return false;
+    }
+    try {
+        (*currentBody)(range.first, range.second);
+    }
+    catch (...) {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        if (!firstError) {
+            firstError = std::current_exception();
+        }
+    }
+    pendingChunks.fetch_sub(1);
+    return true;
+}
+
+bool ThreadPool::popLocal(std::size_t self, std::pair<std::size_t, std::size_t>& range) {
+    WorkQueue& queue = *queues[self];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.ranges.empty()) return false;
+    range = queue.ranges.front();
+    queue.ranges.pop_front();
+    return true;
+}
+
+bool ThreadPool::steal(std::size_t self, std::pair<std::size_t, std::size_t>& range) {
+    std::size_t threads = queues.size();
+    for (std::size_t k = 1; k < threads; ++k) {
+        WorkQueue& victim = *queues[(self + k) % threads];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.ranges.empty()) {
+            range = victim.ranges.back();
+            victim.ranges.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
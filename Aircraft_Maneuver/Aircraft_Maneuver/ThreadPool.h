@@ -0,0 +1,65 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// 常驻工作线程池，提供带工作窃取的 parallelFor
+// 区间 [0, count) 按 grain 切块后连续地分配到各线程的本地队列，
+// 线程先从自己队列的头部取块，队列空时从其它线程队列的尾部窃取，
+// 因此各元素耗时不均（如不同机动模型）时负载仍能自动均衡。
+// 调用线程也参与计算，线程数 = 工作线程数 + 1。
+// 与 ParallelFor.h 的区别：线程常驻复用，适合每个仿真步都要调用一次的场景。
+class ThreadPool {
+public:
+    // threadCount 为参与计算的总线程数（含调用线程），0 表示使用硬件线程数
+    explicit ThreadPool(std::size_t threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    std::size_t size() const { return queues.size(); }
+
+    // 对 [0, count) 的每个块执行 body(begin, end)，全部完成后返回
+    // 每个元素恰好被处理一次；body 抛出的第一个异常在所有块结束后于调用线程重新抛出。
+    // 不支持在 body 内嵌套调用同一个线程池；多个线程同时调用时串行执行。
+    void parallelFor(std::size_t count, std::size_t grain,
+                     const std::function<void(std::size_t, std::size_t)>& body);
+
+private:
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<std::pair<std::size_t, std::size_t>> ranges;
+    };
+
+    void workerLoop(std::size_t index);
+    bool runOne(std::size_t self);   // 执行一个块（本地或窃取），没有可执行的块时返回false
+    bool popLocal(std::size_t self, std::pair<std::size_t, std::size_t>& range);
+    bool steal(std::size_t self, std::pair<std::size_t, std::size_t>& range);
+
+    std::vector<std::unique_ptr<WorkQueue>> queues;  // 下标0为调用线程
+    std::vector<std::thread> workers;
+
+    std::mutex callMutex;            // 串行化并发的 parallelFor 调用
+    std::mutex stateMutex;
+    std::condition_variable wakeCondition;
+    std::condition_variable doneCondition;
+    const std::function<void(std::size_t, std::size_t)>* currentBody;
+    std::size_t generation;          // 每次 parallelFor 递增，唤醒工作线程
+    std::size_t busyWorkers;         // 正在处理当前任务的工作线程数
+    bool stopping;
+    std::atomic<std::size_t> pendingChunks;
+    std::exception_ptr firstError;
+};
+
+#endif // THREAD_POOL_H
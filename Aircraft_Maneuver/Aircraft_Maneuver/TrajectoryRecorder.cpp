@@ -0,0 +1,374 @@
+#include "TrajectoryRecorder.h"
+#include <cstring>
+#include <iomanip>
+#include <stdexcept>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const std::size_t COLUMN_COUNT = static_cast<std::size_t>(TrajectoryColumn::Count);
+
+// 文件头字段偏移
+const std::size_t OFFSET_VERSION = 8;
+const std::size_t OFFSET_COLUMN_COUNT = 12;
+const std::size_t OFFSET_ROW_COUNT = 16;
+const std::size_t OFFSET_BLOCK_COUNT = 24;
+const std::size_t OFFSET_BLOCK_INDEX = 32;
+
+std::size_t alignTo8(std::size_t n) {
+    return (n + 7) / 8 * 8;
+}
+
+template<class T>
+T readField(const unsigned char* p) {
+    T value;
+    std::memcpy(&value, p, sizeof(T));
+    return value;
+}
+
+template<class T>
+void writeField(unsigned char* p, T value) {
+    std::memcpy(p, &value, sizeof(T));
+}
+
+} // namespace
+
+const char* TrajectoryFormat::getColumnName(TrajectoryColumn column) {
+    static const char* const NAMES[COLUMN_COUNT] = {
+        "time", "latitude", "longitude", "altitude",
+        "velocity_north", "velocity_up", "velocity_east",
+        "pitch", "roll", "yaw",
+        "ecef_x", "ecef_y", "ecef_z",
+        "local_north", "local_up", "local_east"
+    };
+    std::size_t index = static_cast<std::size_t>(column);
+    return index < COLUMN_COUNT ? NAMES[index] : "unknown";
+}
+
+// ===== TrajectoryRecorder =====
+
+TrajectoryRecorder::TrajectoryRecorder(const std::string& path, unsigned optionalColumns,
+                                       std::size_t flushInterval)
+    : flushInterval(flushInterval), bufferedRows(0), rowCount(0), writeOffset(0),
+      recordECEF((optionalColumns & RECORD_ECEF) != 0),
+      recordNUE((optionalColumns & RECORD_NUE) != 0), closed(false) {
+    if (flushInterval == 0) {
+        throw std::invalid_argument("TrajectoryRecorder: flushInterval must be positive");
+    }
+    for (std::uint32_t c = 0; c <= static_cast<std::uint32_t>(TrajectoryColumn::Yaw); ++c) {
+        columns.push_back(static_cast<TrajectoryColumn>(c));
+    }
+    if (recordECEF) {
+        columns.insert(columns.end(), { TrajectoryColumn::EcefX, TrajectoryColumn::EcefY, TrajectoryColumn::EcefZ });
+    }
+    if (recordNUE) {
+        columns.insert(columns.end(), { TrajectoryColumn::LocalNorth, TrajectoryColumn::LocalUp, TrajectoryColumn::LocalEast });
+    }
+    buffers.resize(columns.size());
+    for (auto& buffer : buffers) {
+        buffer.reserve(flushInterval);
+    }
+
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("TrajectoryRecorder: cannot open " + path);
+    }
+
+    // 文件头先写占位，close() 时回填行数、块数和块索引偏移
+    writeHeader(0);
+    std::vector<unsigned char> columnTable(alignTo8(columns.size() * sizeof(std::uint32_t)), 0);
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+        writeField(columnTable.data() + i * sizeof(std::uint32_t), static_cast<std::uint32_t>(columns[i]));
+    }
+    file.write(reinterpret_cast<const char*>(columnTable.data()), columnTable.size());
+    writeOffset = TrajectoryFormat::HEADER_SIZE + columnTable.size();
+}
+
+TrajectoryRecorder::~TrajectoryRecorder() {
+    try {
+        close();
+    }
+    catch (...) {
+        // 析构中不抛出异常
+    }
+}
+
+void TrajectoryRecorder::record(double time, const Aircraft& aircraft) {
+    TrajectorySample sample = { time, aircraft.position, aircraft.velocity, aircraft.getAttitude() };
+    record(sample, recordECEF ? aircraft.getECEFPosition() : Vector3{},
+           recordNUE ? aircraft.getLocalNUEPosition() : Vector3{});
+}
+
+void TrajectoryRecorder::record(const TrajectorySample& sample, const Vector3& ecef, const Vector3& nue) {
+    if (closed) {
+        throw std::invalid_argument("TrajectoryRecorder: record after close");
+    }
+    std::size_t c = 0;
+    buffers[c++].push_back(sample.time);
+    buffers[c++].push_back(sample.position.latitude);
+    buffers[c++].push_back(sample.position.longitude);
+    buffers[c++].push_back(sample.position.altitude);
+    buffers[c++].push_back(sample.velocity.north);
+    buffers[c++].push_back(sample.velocity.up);
+    buffers[c++].push_back(sample.velocity.east);
+    buffers[c++].push_back(sample.attitude.pitch);
+    buffers[c++].push_back(sample.attitude.roll);
+    buffers[c++].push_back(sample.attitude.yaw);
+    if (recordECEF) {
+        buffers[c++].push_back(ecef.north);
+        buffers[c++].push_back(ecef.up);
+        buffers[c++].push_back(ecef.east);
+    }
+    if (recordNUE) {
+        buffers[c++].push_back(nue.north);
+        buffers[c++].push_back(nue.up);
+        buffers[c++].push_back(nue.east);
+    }
+    ++rowCount;
+    if (++bufferedRows == flushInterval) {
+        flush();
+    }
+}
+
+void TrajectoryRecorder::flush() {
+    if (closed || bufferedRows == 0) return;
+    BlockEntry block;
+    block.firstRow = rowCount - bufferedRows;
+    block.rows = bufferedRows;
+    for (auto& buffer : buffers) {
+        block.columnOffsets.push_back(writeOffset);
+        file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size() * sizeof(double));
+        writeOffset += buffer.size() * sizeof(double);
+        buffer.clear();
+    }
+    if (!file) {
+        throw std::runtime_error("TrajectoryRecorder: write failed");
+    }
+    blocks.push_back(std::move(block));
+    bufferedRows = 0;
+}
+
+void TrajectoryRecorder::close() {
+    if (closed) return;
+    flush();
+    closed = true;
+
+    std::uint64_t blockIndexOffset = writeOffset;
+    std::vector<unsigned char> entry((2 + columns.size()) * sizeof(std::uint64_t));
+    for (const BlockEntry& block : blocks) {
+        writeField(entry.data(), block.firstRow);
+        writeField(entry.data() + 8, block.rows);
+        for (std::size_t i = 0; i < columns.size(); ++i) {
+            writeField(entry.data() + 16 + 8 * i, block.columnOffsets[i]);
+        }
+        file.write(reinterpret_cast<const char*>(entry.data()), entry.size());
+    }
+    file.seekp(0);
+    writeHeader(blockIndexOffset);
+    file.close();
+    if (file.fail()) {
+        throw std::runtime_error("TrajectoryRecorder: write failed");
+    }
+}
+
+void TrajectoryRecorder::writeHeader(std::uint64_t blockIndexOffset) {
+    unsigned char header[TrajectoryFormat::HEADER_SIZE] = {};
+    std::memcpy(header, TrajectoryFormat::MAGIC, sizeof(TrajectoryFormat::MAGIC));
+    writeField(header + OFFSET_VERSION, TrajectoryFormat::VERSION);
+    writeField(header + OFFSET_COLUMN_COUNT, static_cast<std::uint32_t>(columns.size()));
+    writeField(header + OFFSET_ROW_COUNT, rowCount);
+    writeField(header + OFFSET_BLOCK_COUNT, static_cast<std::uint64_t>(blocks.size()));
+    writeField(header + OFFSET_BLOCK_INDEX, blockIndexOffset);
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+}
+
+// ===== TrajectoryReader =====
+
+TrajectoryReader::TrajectoryReader(const std::string& path)
+    : data(nullptr), size(0), mapping(nullptr), version(0), rowCount(0), blockCount(0), blockIndex(nullptr) {
+#ifdef _WIN32
+    HANDLE fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("TrajectoryReader: cannot open " + path);
+    }
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(fileHandle, &fileSize);
+    size = static_cast<std::size_t>(fileSize.QuadPart);
+    HANDLE mappingHandle = size > 0 ? CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+    CloseHandle(fileHandle);
+    if (mappingHandle != nullptr) {
+        data = static_cast<const unsigned char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        if (data == nullptr) {
+            CloseHandle(mappingHandle);
+        } else {
+            mapping = mappingHandle;
+        }
+    }
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("TrajectoryReader: cannot open " + path);
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        size = static_cast<std::size_t>(st.st_size);
+        void* p = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED) {
+            data = static_cast<const unsigned char*>(p);
+        }
+    }
+    ::close(fd);
+#endif
+
+    const char* error = nullptr;
+    if (data == nullptr || size < TrajectoryFormat::HEADER_SIZE ||
+        std::memcmp(data, TrajectoryFormat::MAGIC, sizeof(TrajectoryFormat::MAGIC)) != 0) {
+        error = "TrajectoryReader: not a trajectory file: ";
+    } else {
+        version = readField<std::uint32_t>(data + OFFSET_VERSION);
+        std::uint32_t columnCount = readField<std::uint32_t>(data + OFFSET_COLUMN_COUNT);
+        rowCount = readField<std::uint64_t>(data + OFFSET_ROW_COUNT);
+        std::uint64_t blocks = readField<std::uint64_t>(data + OFFSET_BLOCK_COUNT);
+        std::uint64_t indexOffset = readField<std::uint64_t>(data + OFFSET_BLOCK_INDEX);
+        std::uint64_t entrySize = (2 + std::uint64_t(columnCount)) * sizeof(std::uint64_t);
+        if (version != TrajectoryFormat::VERSION) {
+            error = "TrajectoryReader: unsupported version: ";
+        } else if (columnCount == 0 || columnCount > COLUMN_COUNT || indexOffset == 0 ||
+                   TrajectoryFormat::HEADER_SIZE + alignTo8(columnCount * sizeof(std::uint32_t)) > indexOffset ||
+                   indexOffset > size || blocks > (size - indexOffset) / entrySize) {
+            error = "TrajectoryReader: truncated or unfinished file: ";
+        } else {
+            for (std::uint32_t i = 0; i < columnCount; ++i) {
+                columns.push_back(static_cast<TrajectoryColumn>(
+                    readField<std::uint32_t>(data + TrajectoryFormat::HEADER_SIZE + i * sizeof(std::uint32_t))));
+            }
+            blockCount = static_cast<std::size_t>(blocks);
+            blockIndex = data + indexOffset;
+            // 每块的列数据必须完整位于块索引之前
+            for (std::size_t b = 0; b < blockCount && error == nullptr; ++b) {
+                const unsigned char* entry = blockIndex + b * entrySize;
+                std::uint64_t rows = readField<std::uint64_t>(entry + 8);
+                for (std::uint32_t c = 0; c < columnCount; ++c) {
+                    std::uint64_t offset = readField<std::uint64_t>(entry + 16 + 8 * c);
+                    if (offset % 8 != 0 || offset > indexOffset || rows > (indexOffset - offset) / sizeof(double)) {
+                        error = "TrajectoryReader: corrupted block index: ";
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    if (error != nullptr) {
+        // 构造函数抛出时析构函数不会执行，需先释放映射
+        unmap();
+        throw std::runtime_error(error + path);
+    }
+}
+
+TrajectoryReader::~TrajectoryReader() {
+    unmap();
+}
+
+void TrajectoryReader::unmap() {
+    if (data == nullptr) return;
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+    CloseHandle(static_cast<HANDLE>(mapping));
+#else
+    munmap(const_cast<unsigned char*>(data), size);
+#endif
+    data = nullptr;
+}
+
+int TrajectoryReader::columnIndex(TrajectoryColumn column) const {
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+        if (columns[i] == column) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+bool TrajectoryReader::hasColumn(TrajectoryColumn column) const {
+    return columnIndex(column) >= 0;
+}
+
+const double* TrajectoryReader::getBlockColumn(std::size_t block, TrajectoryColumn column, std::size_t* rows) const {
+    int index = columnIndex(column);
+    if (block >= blockCount || index < 0) return nullptr;
+    const unsigned char* entry = blockIndex + block * (2 + columns.size()) * sizeof(std::uint64_t);
+    if (rows != nullptr) {
+        *rows = static_cast<std::size_t>(readField<std::uint64_t>(entry + 8));
+    }
+    std::uint64_t offset = readField<std::uint64_t>(entry + 16 + 8 * index);
+    return reinterpret_cast<const double*>(data + offset);
+}
+
+std::size_t TrajectoryReader::findBlock(std::size_t row) const {
+    std::size_t entrySize = (2 + columns.size()) * sizeof(std::uint64_t);
+    std::size_t low = 0, high = blockCount;
+    while (high - low > 1) {
+        std::size_t mid = (low + high) / 2;
+        if (readField<std::uint64_t>(blockIndex + mid * entrySize) <= row) {
+            low = mid;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+double TrajectoryReader::getValue(TrajectoryColumn column, std::size_t row) const {
+    if (row >= rowCount || !hasColumn(column)) {
+        throw std::invalid_argument("TrajectoryReader: row or column out of range");
+    }
+    std::size_t block = findBlock(row);
+    std::size_t entrySize = (2 + columns.size()) * sizeof(std::uint64_t);
+    std::uint64_t firstRow = readField<std::uint64_t>(blockIndex + block * entrySize);
+    return getBlockColumn(block, column, nullptr)[row - firstRow];
+}
+
+std::vector<double> TrajectoryReader::readColumn(TrajectoryColumn column) const {
+    std::vector<double> values;
+    if (!hasColumn(column)) return values;
+    values.reserve(getRowCount());
+    for (std::size_t b = 0; b < blockCount; ++b) {
+        std::size_t rows = 0;
+        const double* p = getBlockColumn(b, column, &rows);
+        values.insert(values.end(), p, p + rows);
+    }
+    return values;
+}
+
+void TrajectoryReader::writeCsv(std::ostream& out) const {
+    for (std::size_t c = 0; c < columns.size(); ++c) {
+        out << (c ? "," : "") << TrajectoryFormat::getColumnName(columns[c]);
+    }
+    out << '\n';
+
+    std::streamsize oldPrecision = out.precision(12);
+    std::vector<const double*> blockColumns(columns.size());
+    for (std::size_t b = 0; b < blockCount; ++b) {
+        std::size_t rows = 0;
+        for (std::size_t c = 0; c < columns.size(); ++c) {
+            blockColumns[c] = getBlockColumn(b, columns[c], &rows);
+        }
+        for (std::size_t r = 0; r < rows; ++r) {
+            for (std::size_t c = 0; c < columns.size(); ++c) {
+                out << (c ? "," : "") << blockColumns[c][r];
+            }
+            out << '\n';
+        }
+    }
+    out.precision(oldPrecision);
+}
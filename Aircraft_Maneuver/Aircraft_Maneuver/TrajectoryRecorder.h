@@ -0,0 +1,147 @@
+#ifndef TRAJECTORY_RECORDER_H
+#define TRAJECTORY_RECORDER_H
+
+#include "AircraftModelLibrary.h"
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// 轨迹列（每列为 double）
+enum class TrajectoryColumn : std::uint32_t {
+    Time = 0,
+    Latitude, Longitude, Altitude,              // 度、度、米
+    VelocityNorth, VelocityUp, VelocityEast,    // m/s
+    Pitch, Roll, Yaw,                           // 弧度
+    EcefX, EcefY, EcefZ,                        // 可选：ECEF位置 (米)
+    LocalNorth, LocalUp, LocalEast,             // 可选：相对参考点的NUE位置 (米)
+    Count
+};
+
+// 列式二进制轨迹文件格式（版本1，小端，所有偏移以字节计、均按8字节对齐）：
+//   文件头 (64字节)：magic "ACTRAJ\0\0"、版本号、列数、总行数、数据块数、块索引偏移
+//   列ID表：columnCount 个 uint32（补齐到8字节）
+//   数据块：每块内各列数据连续存放（rows 个 double），块大小由记录器的刷新间隔决定
+//   块索引（文件末尾）：每块 { 首行号, 行数, 各列数据偏移[columnCount] }，均为 uint64
+// 读取时整个文件内存映射，列数据直接以 const double* 访问，无需解析。
+namespace TrajectoryFormat {
+    const char MAGIC[8] = { 'A', 'C', 'T', 'R', 'A', 'J', '\0', '\0' };
+    const std::uint32_t VERSION = 1;
+    const std::size_t HEADER_SIZE = 64;
+
+    // 列名（CSV表头使用）
+    const char* getColumnName(TrajectoryColumn column);
+}
+
+// 单步状态快照（不含派生量，ECEF/NUE 由写入方按需计算）
+struct TrajectorySample {
+    double time;
+    GeoPosition position;
+    Vector3 velocity;
+    AttitudeAngles attitude;
+};
+
+// 轨迹记录器：每步把时间、位置、速度、姿态（及可选的ECEF/NUE）追加到按列的缓冲区，
+// 缓冲区满 flushInterval 行时作为一个数据块写入文件，close() 时写块索引并回填文件头。
+// 替代逐步 std::cout 格式化输出；未调用 close() 的文件（如进程崩溃）不可读取。
+class TrajectoryRecorder {
+public:
+    enum OptionalColumns : unsigned {
+        RECORD_ECEF = 1u << 0,  // 记录 Aircraft::getECEFPosition()
+        RECORD_NUE = 1u << 1    // 记录 Aircraft::getLocalNUEPosition()（需先设置参考位置）
+    };
+
+    // 打开文件失败抛出 std::runtime_error；flushInterval 为0抛出 std::invalid_argument
+    explicit TrajectoryRecorder(const std::string& path, unsigned optionalColumns = 0,
+                                std::size_t flushInterval = 65536);
+    ~TrajectoryRecorder();
+
+    TrajectoryRecorder(const TrajectoryRecorder&) = delete;
+    TrajectoryRecorder& operator=(const TrajectoryRecorder&) = delete;
+
+    // 追加一行
+    void record(double time, const Aircraft& aircraft);
+
+    // 由快照追加一行；ecef / nue 仅在启用对应可选列时写入
+    void record(const TrajectorySample& sample, const Vector3& ecef = Vector3{}, const Vector3& nue = Vector3{});
+
+    bool isRecordingECEF() const { return recordECEF; }
+    bool isRecordingNUE() const { return recordNUE; }
+
+    // 把缓冲区中的行作为一个数据块写入文件
+    void flush();
+
+    // 写入剩余数据、块索引并回填文件头（析构时自动调用）
+    void close();
+
+    std::size_t getRecordCount() const { return rowCount; }
+    const std::vector<TrajectoryColumn>& getColumns() const { return columns; }
+
+private:
+    struct BlockEntry {
+        std::uint64_t firstRow;
+        std::uint64_t rows;
+        std::vector<std::uint64_t> columnOffsets;
+    };
+
+    void writeHeader(std::uint64_t blockIndexOffset);
+
+    std::ofstream file;
+    std::vector<TrajectoryColumn> columns;
+    std::vector<std::vector<double>> buffers;   // 与 columns 一一对应
+    std::vector<BlockEntry> blocks;
+    std::size_t flushInterval;
+    std::size_t bufferedRows;
+    std::uint64_t rowCount;
+    std::uint64_t writeOffset;
+    bool recordECEF;
+    bool recordNUE;
+    bool closed;
+};
+
+// 轨迹文件读取器：内存映射整个文件，按块零拷贝访问列数据
+class TrajectoryReader {
+public:
+    // 文件不存在、格式或版本不符时抛出 std::runtime_error
+    explicit TrajectoryReader(const std::string& path);
+    ~TrajectoryReader();
+
+    TrajectoryReader(const TrajectoryReader&) = delete;
+    TrajectoryReader& operator=(const TrajectoryReader&) = delete;
+
+    std::uint32_t getVersion() const { return version; }
+    std::size_t getRowCount() const { return static_cast<std::size_t>(rowCount); }
+    std::size_t getBlockCount() const { return blockCount; }
+    const std::vector<TrajectoryColumn>& getColumns() const { return columns; }
+    bool hasColumn(TrajectoryColumn column) const;
+
+    // 第 block 块中某列的数据指针（指向映射内存），rows 返回该块行数；列不存在时返回 nullptr
+    const double* getBlockColumn(std::size_t block, TrajectoryColumn column, std::size_t* rows) const;
+
+    // 按全局行号读取单个值（越界或列不存在抛出 std::invalid_argument）
+    double getValue(TrajectoryColumn column, std::size_t row) const;
+
+    // 拷贝出整列
+    std::vector<double> readColumn(TrajectoryColumn column) const;
+
+    // 转换为CSV（首行为列名）
+    void writeCsv(std::ostream& out) const;
+
+private:
+    void unmap();
+    int columnIndex(TrajectoryColumn column) const;
+    std::size_t findBlock(std::size_t row) const;
+
+    const unsigned char* data;
+    std::size_t size;
+    void* mapping;   // 平台相关的映射句柄
+    std::uint32_t version;
+    std::uint64_t rowCount;
+    std::size_t blockCount;
+    const unsigned char* blockIndex;
+    std::vector<TrajectoryColumn> columns;
+};
+
+#endif // TRAJECTORY_RECORDER_H
@@ -0,0 +1,251 @@
+#ifndef BENCH_HARNESS_H
+#define BENCH_HARNESS_H
+
+// 微基准计时框架（仅头文件，无外部依赖）
+// 每个基准：自动确定每个样本的调用次数 -> 预热 -> 多次采样，
+// 统计单次调用耗时的中位数、p99、均值、最小值、最大值，以及每次调用的TSC周期数，结果可输出为JSON。
+// 所有基准程序共用本框架与 parseCommandLine，命令行与JSON格式一致。
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace bench {
+
+// 阻止编译器把基准结果当作无用计算优化掉
+template<class T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+// 时间戳计数器（x86为TSC，按标称频率计数；其它平台返回0，周期数不可用）
+inline std::uint64_t readCycleCounter() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+struct BenchOptions {
+    int samples = 200;                 // 采样次数
+    double minSampleSeconds = 50e-6;   // 每个样本的最短时长（据此确定每个样本内的调用次数；为0时每个样本一次调用）
+    double warmupSeconds = 0.05;       // 预热时长
+    std::string filter;                // 只运行名称包含该子串的基准（空为全部）
+};
+
+struct BenchResult {
+    std::string name;
+    std::size_t callsPerSample = 0;
+    int samples = 0;
+    double medianNs = 0.0;
+    double p99Ns = 0.0;
+    double meanNs = 0.0;
+    double minNs = 0.0;
+    double maxNs = 0.0;
+    double cyclesPerCall = 0.0;        // TSC周期（中位数样本），不支持时为0
+};
+
+class BenchHarness {
+public:
+    explicit BenchHarness(const BenchOptions& options = BenchOptions()) : options(options) {}
+
+    // 运行一个基准：fn() 为一次被测调用
+    // 返回false表示被过滤跳过
+    template<class Fn>
+    bool run(const std::string& name, Fn fn) {
+        if (!options.filter.empty() && name.find(options.filter) == std::string::npos) {
+            return false;
+        }
+        using clock = std::chrono::steady_clock;
+
+        // 确定每个样本的调用次数：倍增直到单个样本时长超过下限
+        std::size_t calls = 1;
+        for (;;) {
+            auto t0 = clock::now();
+            for (std::size_t i = 0; i < calls; ++i) fn();
+            double elapsed = std::chrono::duration<double>(clock::now() - t0).count();
+            if (elapsed >= options.minSampleSeconds || calls >= (std::size_t(1) << 30)) break;
+            calls *= 2;
+        }
+
+        // 预热
+        auto warmupEnd = clock::now() + std::chrono::duration_cast<clock::duration>(
+            std::chrono::duration<double>(options.warmupSeconds));
+        while (clock::now() < warmupEnd) {
+            for (std::size_t i = 0; i < calls; ++i) fn();
+        }
+
+        // 采样
+        std::vector<double> nsPerCall(options.samples);
+        std::vector<double> cyclesPerCall(options.samples);
+        for (int s = 0; s < options.samples; ++s) {
+            std::uint64_t c0 = readCycleCounter();
+            auto t0 = clock::now();
+            for (std::size_t i = 0; i < calls; ++i) fn();
+            auto t1 = clock::now();
+            std::uint64_t c1 = readCycleCounter();
+            nsPerCall[s] = std::chrono::duration<double, std::nano>(t1 - t0).count() / calls;
+            cyclesPerCall[s] = static_cast<double>(c1 - c0) / calls;
+        }
+
+        BenchResult result;
+        result.name = name;
+        result.callsPerSample = calls;
+        result.samples = options.samples;
+        double sum = 0.0;
+        for (double v : nsPerCall) sum += v;
+        result.meanNs = sum / options.samples;
+        std::vector<double> sorted = nsPerCall;
+        std::sort(sorted.begin(), sorted.end());
+        result.minNs = sorted.front();
+        result.maxNs = sorted.back();
+        result.medianNs = percentile(sorted, 0.5);
+        result.p99Ns = percentile(sorted, 0.99);
+        std::sort(cyclesPerCall.begin(), cyclesPerCall.end());
+        result.cyclesPerCall = percentile(cyclesPerCall, 0.5);
+
+        results.push_back(result);
+        printResult(result);
+        return true;
+    }
+
+    const std::vector<BenchResult>& getResults() const { return results; }
+
+    // 按名称查找结果（未运行或被过滤跳过时返回 nullptr）
+    const BenchResult* find(const std::string& name) const {
+        for (const BenchResult& r : results) {
+            if (r.name == name) return &r;
+        }
+        return nullptr;
+    }
+
+    static void printHeader() {
+        std::cout << std::left << std::setw(56) << "基准" << std::right
+                  << std::setw(15) << "中位数ns" << std::setw(15) << "p99 ns"
+                  << std::setw(15) << "周期/次" << std::setw(15) << "次/样本" << std::endl;
+    }
+
+    // 写出JSON，meta 为附加的键值（如编译器、SIMD级别）
+    bool writeJson(const std::string& path,
+                   const std::vector<std::pair<std::string, std::string>>& meta) const {
+        std::ofstream out(path);
+        if (!out) return false;
+        out << "{\n";
+        for (const auto& kv : meta) {
+            out << "  \"" << escape(kv.first) << "\": \"" << escape(kv.second) << "\",\n";
+        }
+        out << "  \"results\": [\n";
+        char buf[512];
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const BenchResult& r = results[i];
+            std::snprintf(buf, sizeof(buf),
+                          "    {\"name\": \"%s\", \"calls_per_sample\": %zu, \"samples\": %d, "
+                          "\"median_ns\": %.4f, \"p99_ns\": %.4f, \"mean_ns\": %.4f, \"min_ns\": %.4f, \"max_ns\": %.4f, "
+                          "\"cycles_per_call\": %.2f}",
+                          escape(r.name).c_str(), r.callsPerSample, r.samples,
+                          r.medianNs, r.p99Ns, r.meanNs, r.minNs, r.maxNs, r.cyclesPerCall);
+            out << buf << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        out << "  ]\n}\n";
+        return static_cast<bool>(out);
+    }
+
+private:
+    static double percentile(const std::vector<double>& sorted, double q) {
+        if (sorted.empty()) return 0.0;
+        double pos = q * (sorted.size() - 1);
+        std::size_t lo = static_cast<std::size_t>(pos);
+        std::size_t hi = std::min(lo + 1, sorted.size() - 1);
+        double frac = pos - lo;
+        return sorted[lo] * (1.0 - frac) + sorted[hi] * frac;
+    }
+
+    static std::string escape(const std::string& s) {
+        std::string out;
+        for (char c : s) {
+            if (c == '"' || c == '\\') out += '\\';
+            out += c;
+        }
+        return out;
+    }
+
+    static void printResult(const BenchResult& r) {
+        std::cout << std::left << std::setw(56) << r.name << std::right << std::fixed
+                  << std::setprecision(2) << std::setw(15) << r.medianNs << std::setw(15) << r.p99Ns
+                  << std::setprecision(1) << std::setw(15) << r.cyclesPerCall
+                  << std::setw(15) << r.callsPerSample << std::endl;
+    }
+
+    BenchOptions options;
+    std::vector<BenchResult> results;
+};
+
+// 基准程序的通用命令行：--filter 子串、--samples N、--json 输出路径，其余参数依次为位置参数
+struct CommandLine {
+    BenchOptions options;
+    std::string jsonPath;
+    std::vector<std::string> positional;
+
+    // 第 index 个位置参数的数值，未给出时取 fallback
+    double number(std::size_t index, double fallback) const {
+        return index < positional.size() ? std::strtod(positional[index].c_str(), nullptr) : fallback;
+    }
+};
+
+// defaults 为该程序的默认计时选项（长耗时基准可减少采样次数），jsonPath 为默认输出路径
+inline CommandLine parseCommandLine(int argc, char* argv[], const BenchOptions& defaults, const std::string& jsonPath) {
+    CommandLine cmd;
+    cmd.options = defaults;
+    cmd.jsonPath = jsonPath;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--filter" && i + 1 < argc) {
+            cmd.options.filter = argv[++i];
+        } else if (arg == "--samples" && i + 1 < argc) {
+            cmd.options.samples = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--json" && i + 1 < argc) {
+            cmd.jsonPath = argv[++i];
+        } else {
+            cmd.positional.push_back(arg);
+        }
+    }
+    return cmd;
+}
+
+inline std::string compilerName() {
+#if defined(__clang__)
+    return std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+    return std::string("gcc ") + __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc " + std::to_string(_MSC_VER);
+#else
+    return "unknown";
+#endif
+}
+
+} // namespace bench
+
+#endif // BENCH_HARNESS_H
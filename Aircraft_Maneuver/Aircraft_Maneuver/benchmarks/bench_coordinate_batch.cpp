@@ -0,0 +1,109 @@
+// 批量 geodeticToECEF / ecefToGeodetic 吞吐基准
+// 对比逐点循环（当前用法）、各SIMD级别单线程内核、以及 CoordinateTransform 批量接口（SIMD + 多线程）
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+#include "AircraftModelLibrary.h"
+#include "CoordinateTransform.h"
+#include "SimdKernels.h"
+
+#ifdef USE_EIGEN
+namespace {
+
+double nowSeconds() {
+    using clock = std::chrono::steady_clock;
+    return std::chrono::duration<double>(clock::now().time_since_epoch()).count();
+}
+
+// 每种规模处理的总点数约为4百万，取多轮中最快的一轮
+const std::size_t TOTAL_POINTS = 4000000;
+const int ROUNDS = 5;
+
+template<class Fn>
+double bestNsPerPoint(std::size_t n, Fn fn) {
+    std::size_t reps = std::max<std::size_t>(1, TOTAL_POINTS / n);
+    double best = 1e30;
+    for (int r = 0; r < ROUNDS; ++r) {
+        double t0 = nowSeconds();
+        for (std::size_t k = 0; k < reps; ++k) {
+            fn();
+        }
+        best = std::min(best, nowSeconds() - t0);
+    }
+    return best / (reps * n) * 1e9;
+}
+
+void printRow(const char* name, double ns, double baseline) {
+    std::cout << "  " << std::left << std::setw(22) << name << std::right << std::setw(9) << ns
+              << " ns/点  加速比 " << baseline / ns << "x" << std::endl;
+}
+
+} // namespace
+#endif
+
+int main() {
+    std::cout << "=== 批量坐标转换基准 ===" << std::endl;
+#ifdef USE_EIGEN
+    std::cout << "检测到的指令集: " << getSimdLevelName(detectSimdLevel())
+              << ", 硬件线程数: " << std::thread::hardware_concurrency() << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+
+    const std::size_t sizes[] = { 1000, 100000, 1000000 };
+    for (std::size_t n : sizes) {
+        std::vector<GeoPosition> points(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            points[i] = { 100.0 + 1e-4 * i, 30.0 + 1e-5 * i, 1000.0 + 0.01 * i };
+        }
+        Eigen::Matrix<double, 3, Eigen::Dynamic> ecef = CoordinateTransform::geodeticToECEF(points);
+        Eigen::Matrix<double, 3, Eigen::Dynamic> ecefOut(3, n);
+        std::vector<GeoPosition> geoOut(n);
+
+        std::cout << "\nN = " << n << std::endl;
+
+        // geodeticToECEF
+        std::cout << " geodeticToECEF" << std::endl;
+        double baseline = bestNsPerPoint(n, [&]() {
+            for (std::size_t i = 0; i < n; ++i) {
+                ecefOut.col(i) = CoordinateTransform::geodeticToECEF(points[i]);
+            }
+        });
+        printRow("逐点循环", baseline, baseline);
+        const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::AVX2, SimdLevel::AVX512 };
+        for (SimdLevel level : levels) {
+            const SimdKernelTable* table = getSimdKernels(level);
+            if (!table || static_cast<int>(level) > static_cast<int>(detectSimdLevel())) continue;
+            double ns = bestNsPerPoint(n, [&]() { table->geodeticToECEF(points.data(), ecefOut.data(), n); });
+            printRow((std::string("单线程 ") + getSimdLevelName(level)).c_str(), ns, baseline);
+        }
+        double ns = bestNsPerPoint(n, [&]() { ecefOut = CoordinateTransform::geodeticToECEF(points); });
+        printRow("批量接口(SIMD+多线程)", ns, baseline);
+
+        // ecefToGeodetic
+        std::cout << " ecefToGeodetic" << std::endl;
+        baseline = bestNsPerPoint(n, [&]() {
+            for (std::size_t i = 0; i < n; ++i) {
+                geoOut[i] = CoordinateTransform::ecefToGeodetic(Eigen::Vector3d(ecef.col(i)));
+            }
+        });
+        printRow("逐点循环", baseline, baseline);
+        for (SimdLevel level : levels) {
+            const SimdKernelTable* table = getSimdKernels(level);
+            if (!table || static_cast<int>(level) > static_cast<int>(detectSimdLevel())) continue;
+            ns = bestNsPerPoint(n, [&]() { table->ecefToGeodetic(ecef.data(), geoOut.data(), n); });
+            printRow((std::string("单线程 ") + getSimdLevelName(level)).c_str(), ns, baseline);
+        }
+        ns = bestNsPerPoint(n, [&]() { CoordinateTransform::ecefToGeodetic(ecef, geoOut.data()); });
+        printRow("批量接口(SIMD+多线程)", ns, baseline);
+
+        // 防止编译器把结果优化掉
+        volatile double sink = ecefOut(0, n / 2) + geoOut[n / 2].latitude;
+        (void)sink;
+    }
+#else
+    std::cout << "未启用Eigen，跳过" << std::endl;
+#endif
+    return 0;
+}
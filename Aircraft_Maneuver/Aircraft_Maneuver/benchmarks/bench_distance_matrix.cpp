@@ -0,0 +1,121 @@
+// 站点到航迹的 Vincenty 距离/方位角矩阵基准
+// 对比逐对调用 calculateDistanceImproved + calculateBearingImproved（原用法）、各SIMD级别单线程逐行内核、
+// 以及 calculateDistanceMatrix（SIMD + 多线程）
+// 用法：bench_distance_matrix [站点数，默认 500] [航迹数，默认 50000] [--filter 子串] [--samples N] [--json 路径]
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchHarness.h"
+#include "ImprovedCoordinateTransform.h"
+#include "SimdKernels.h"
+
+namespace {
+
+// 运行一个基准并返回中位数（秒），被过滤跳过时返回0
+template<class F>
+double medianSeconds(bench::BenchHarness& harness, const std::string& name, F f) {
+    return harness.run(name, f) ? harness.getResults().back().medianNs * 1e-9 : 0.0;
+}
+
+void printRow(const std::string& name, double seconds, double baseline) {
+    std::cout << "  " << std::left << std::setw(26) << name << std::right << std::setw(10) << seconds * 1e3
+              << " ms  加速比 " << baseline / seconds << "x" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    // 每次调用计算多行（数十毫秒以上），首次确定调用次数的那一次即为预热
+    bench::BenchOptions defaults;
+    defaults.samples = 3;
+    defaults.warmupSeconds = 0.0;
+    bench::CommandLine cmd = bench::parseCommandLine(argc, argv, defaults, "bench_distance_matrix.json");
+    std::size_t siteCount = static_cast<std::size_t>(cmd.number(0, 500));
+    std::size_t trackCount = static_cast<std::size_t>(cmd.number(1, 50000));
+    std::cout << "=== Vincenty距离矩阵基准（" << siteCount << " 站点 x " << trackCount << " 航迹）===" << std::endl;
+    std::cout << "检测到的指令集: " << getSimdLevelName(detectSimdLevel())
+              << ", 硬件线程数: " << std::thread::hardware_concurrency() << std::endl;
+    bench::BenchHarness harness(cmd.options);
+    bench::BenchHarness::printHeader();
+
+    // 站点分布在东亚，航迹分布在周边约 60°×40° 范围内
+    std::vector<GeoPosition> sites(siteCount), tracks(trackCount);
+    for (std::size_t i = 0; i < siteCount; ++i) {
+        sites[i] = { 100.0 + 30.0 * std::fmod(i * 0.618, 1.0), 20.0 + 25.0 * std::fmod(i * 0.377, 1.0), 0.0 };
+    }
+    for (std::size_t j = 0; j < trackCount; ++j) {
+        tracks[j] = { 80.0 + 60.0 * std::fmod(j * 0.618034, 1.0), 10.0 + 40.0 * std::fmod(j * 0.414214, 1.0), 9000.0 };
+    }
+    std::vector<double> distance(siteCount * trackCount), bearing(siteCount * trackCount);
+
+    // 逐对计算：前 sampleRows 行实测后按行数外推
+    const std::size_t sampleRows = std::min<std::size_t>(siteCount, 5);
+    const std::string sampled = " x" + std::to_string(sampleRows) + " rows";
+    double sample = medianSeconds(harness, "calculateDistanceImproved+BearingImproved" + sampled, [&]() {
+        for (std::size_t i = 0; i < sampleRows; ++i) {
+            for (std::size_t j = 0; j < trackCount; ++j) {
+                distance[i * trackCount + j] = ImprovedCoordinateTransform::calculateDistanceImproved(sites[i], tracks[j]);
+                bearing[i * trackCount + j] = ImprovedCoordinateTransform::calculateBearingImproved(sites[i], tracks[j]);
+            }
+        }
+    });
+    double baseline = sample / sampleRows * siteCount;
+    std::vector<std::pair<std::string, double>> summary = { { "逐对循环（外推）", baseline } };
+
+    // 单线程逐行内核：归化纬度预先算好，同样按前 sampleRows 行外推
+    std::vector<double> sinU(trackCount), cosU(trackCount), longitude(trackCount);
+    const double degToRad = 3.14159265358979323846 / 180.0;
+    for (std::size_t j = 0; j < trackCount; ++j) {
+        double U = std::atan((1 - ImprovedCoordinateTransform::EARTH_FLATTENING) * std::tan(tracks[j].latitude * degToRad));
+        sinU[j] = std::sin(U);
+        cosU[j] = std::cos(U);
+        longitude[j] = tracks[j].longitude * degToRad;
+    }
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::AVX2, SimdLevel::AVX512 };
+    for (SimdLevel level : levels) {
+        const SimdKernelTable* table = getSimdKernels(level);
+        if (!table || level > detectSimdLevel()) continue;
+        double seconds = medianSeconds(harness, std::string("vincentyInverse/") + getSimdLevelName(level) + sampled, [&]() {
+            for (std::size_t i = 0; i < sampleRows; ++i) {
+                double U = std::atan((1 - ImprovedCoordinateTransform::EARTH_FLATTENING) *
+                                     std::tan(sites[i].latitude * degToRad));
+                table->vincentyInverse(std::sin(U), std::cos(U), sites[i].longitude * degToRad, sinU.data(), cosU.data(),
+                                       longitude.data(), &distance[i * trackCount], &bearing[i * trackCount], trackCount);
+            }
+        });
+        summary.emplace_back(std::string("单线程 ") + getSimdLevelName(level) + "（外推）", seconds / sampleRows * siteCount);
+    }
+
+    std::size_t unconverged = 0;
+    double full = medianSeconds(harness, std::string("calculateDistanceMatrix/") + getSimdLevelName(getActiveSimdLevel()), [&]() {
+        unconverged = ImprovedCoordinateTransform::calculateDistanceMatrix(sites.data(), siteCount, tracks.data(), trackCount,
+                                                                           distance.data(), bearing.data());
+    });
+    summary.emplace_back(std::string("calculateDistanceMatrix ") + getSimdLevelName(getActiveSimdLevel()), full);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n整个矩阵耗时（" << siteCount << " 行）:" << std::endl;
+    for (const auto& row : summary) {
+        if (row.second > 0.0) printRow(row.first, row.second, baseline);
+    }
+    std::cout << "  不收敛点对: " << unconverged << "，每点对 " << full / (siteCount * trackCount) * 1e9 << " ns" << std::endl;
+
+    std::vector<std::pair<std::string, std::string>> meta = {
+        { "benchmark", "bench_distance_matrix" },
+        { "compiler", bench::compilerName() },
+        { "simd_level", getSimdLevelName(getActiveSimdLevel()) },
+        { "sites", std::to_string(siteCount) },
+        { "tracks", std::to_string(trackCount) },
+        { "hardware_threads", std::to_string(std::thread::hardware_concurrency()) }
+    };
+    if (!harness.writeJson(cmd.jsonPath, meta)) {
+        std::cerr << "无法写入结果文件: " << cmd.jsonPath << std::endl;
+        return 1;
+    }
+    std::cout << "结果已写入 " << cmd.jsonPath << std::endl;
+    return 0;
+}
@@ -0,0 +1,112 @@
+// 机群机动更新基准：逐机 shared_ptr<ManeuverModel> 虚函数调用 vs FleetManeuverStage 按类型批量更新
+// 机动类型随机混合（打乱顺序，逐机路径的间接跳转无法预测）
+// 另测姿态按需计算：每步都读取姿态（相当于原先每步计算）与每10步读取一次（100 Hz 步进、10 Hz 输出）
+// 用法：bench_fleet_maneuver [飞机数，默认 100000] [--filter 子串] [--samples N] [--json 路径]
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "BenchHarness.h"
+#include "AircraftFleet.h"
+#include "AircraftModelLibrary.h"
+#include "FighterJet.h"
+#include "FleetManeuverStage.h"
+#include "ManeuverRegistry.h"
+
+namespace {
+
+const double DT = 0.02;
+const int OUTPUT_INTERVAL = 10;   // 每隔多少步读取一次姿态
+
+// 中位数（毫秒/步），基准被过滤跳过时为0
+double msPerStep(const bench::BenchHarness& harness, const std::string& name, int stepsPerCall = 1) {
+    const bench::BenchResult* r = harness.find(name);
+    return r ? r->medianNs * 1e-6 / stepsPerCall : 0.0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    // 每次调用推进整个机群一步（毫秒级）
+    bench::BenchOptions defaults;
+    defaults.samples = 20;
+    bench::CommandLine cmd = bench::parseCommandLine(argc, argv, defaults, "bench_fleet_maneuver.json");
+    std::size_t count = static_cast<std::size_t>(cmd.number(0, 100000));
+    std::cout << "=== 机群机动更新基准（" << count << " 架，" << ManeuverRegistry::count() << " 种机动随机混合）===" << std::endl;
+
+    std::vector<ManeuverId> ids(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        ids[i] = static_cast<ManeuverId>(i % ManeuverRegistry::count());
+    }
+    std::mt19937 rng(12345);
+    std::shuffle(ids.begin(), ids.end(), rng);
+
+    std::vector<std::unique_ptr<FighterJet>> aircraftList;
+    AircraftFleet fleet(count);
+    FleetManeuverStage stage;
+    aircraftList.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto aircraft = std::make_unique<FighterJet>("F-15");
+        aircraft->position = { 116.0 + 1e-4 * i, 39.0, 1000.0 };
+        aircraft->velocity = { 200.0, 0.0, 0.0 };
+        aircraft->setManeuverModel(ManeuverRegistry::create(ids[i]));
+        aircraft->initializeManeuver(ManeuverRegistry::getDefaults(ids[i]).toParameters());
+        fleet.addAircraft(*aircraft);
+        stage.assign(fleet, i, ids[i]);
+        aircraftList.push_back(std::move(aircraft));
+    }
+
+    bench::BenchHarness harness(cmd.options);
+    bench::BenchHarness::printHeader();
+    const std::string intervalName = "FleetManeuverStage::update x" + std::to_string(OUTPUT_INTERVAL) + " + pitchData";
+    harness.run("Aircraft::updateManeuver (per aircraft)", [&] {
+        for (auto& aircraft : aircraftList) {
+            aircraft->updateManeuver(DT);
+        }
+    });
+    harness.run("FleetManeuverStage::update", [&] { stage.update(fleet, DT); });
+
+    // 姿态读取：每步都读 vs 每 OUTPUT_INTERVAL 步读一次（按步平均）
+    harness.run("FleetManeuverStage::update + pitchData", [&] {
+        stage.update(fleet, DT);
+        bench::doNotOptimize(fleet.pitchData());
+    });
+    AttitudeStats before = fleet.getAttitudeStats();
+    harness.run(intervalName, [&] {
+        for (int s = 0; s < OUTPUT_INTERVAL; ++s) {
+            stage.update(fleet, DT);
+        }
+        bench::doNotOptimize(fleet.pitchData());
+    });
+    double virtualMs = msPerStep(harness, "Aircraft::updateManeuver (per aircraft)");
+    double stageMs = msPerStep(harness, "FleetManeuverStage::update");
+    double readEveryStepMs = msPerStep(harness, "FleetManeuverStage::update + pitchData");
+    double readIntervalMs = msPerStep(harness, intervalName, OUTPUT_INTERVAL);
+    std::size_t requested = fleet.getAttitudeStats().requested - before.requested;
+    std::size_t computed = fleet.getAttitudeStats().computed - before.computed;
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "逐机虚函数调用:      " << std::setw(9) << virtualMs << " ms/步  "
+              << std::setw(7) << virtualMs * 1e6 / count << " ns/架" << std::endl;
+    std::cout << "FleetManeuverStage: " << std::setw(9) << stageMs << " ms/步  "
+              << std::setw(7) << stageMs * 1e6 / count << " ns/架" << std::endl;
+    std::cout << "加速比: " << virtualMs / stageMs << std::endl;
+    std::cout << "阶段更新 + 每步读取姿态:   " << std::setw(9) << readEveryStepMs << " ms/步" << std::endl;
+    std::cout << "阶段更新 + 每" << OUTPUT_INTERVAL << "步读取姿态: " << std::setw(9) << readIntervalMs << " ms/步（姿态请求 "
+              << requested << " 次，计算 " << computed << " 次，省去 " << requested - computed << " 次）" << std::endl;
+
+    std::vector<std::pair<std::string, std::string>> meta = {
+        { "benchmark", "bench_fleet_maneuver" },
+        { "compiler", bench::compilerName() },
+        { "aircraft", std::to_string(count) }
+    };
+    if (!harness.writeJson(cmd.jsonPath, meta)) {
+        std::cerr << "无法写入结果文件: " << cmd.jsonPath << std::endl;
+        return 1;
+    }
+    std::cout << "结果已写入 " << cmd.jsonPath << std::endl;
+    return 0;
+}
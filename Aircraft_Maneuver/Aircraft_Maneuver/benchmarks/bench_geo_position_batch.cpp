@@ -0,0 +1,89 @@
+// updateGeoPosition 批量内核吞吐基准
+// 对比逐对象调用 updateGeoPosition（当前用法）与各SIMD级别的 updateGeoPositionBatch，
+// 机群规模 1k / 100k / 1M
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <vector>
+#include "AircraftModelLibrary.h"
+#include "SimdKernels.h"
+
+namespace {
+
+double nowSeconds() {
+    using clock = std::chrono::steady_clock;
+    return std::chrono::duration<double>(clock::now().time_since_epoch()).count();
+}
+
+// 每种规模处理的总元素数约为2千万，取多轮中最快的一轮
+const std::size_t TOTAL_UPDATES = 20000000;
+const int ROUNDS = 5;
+
+} // namespace
+
+int main() {
+    std::cout << "=== updateGeoPosition 批量内核基准 ===" << std::endl;
+    std::cout << "检测到的指令集: " << getSimdLevelName(detectSimdLevel()) << std::endl;
+    std::cout << std::fixed << std::setprecision(3);
+
+    const std::size_t sizes[] = { 1000, 100000, 1000000 };
+    const double dt = 0.01;
+
+    for (std::size_t n : sizes) {
+        std::vector<GeoPosition> positions(n);
+        std::vector<Vector3> velocities(n);
+        std::vector<double> latitude(n), longitude(n), altitude(n), vn(n), vu(n), ve(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            positions[i] = { 100.0 + 1e-4 * i, 30.0 + 1e-5 * i, 1000.0 };
+            velocities[i] = { 200.0, 1.0, 50.0 };
+            latitude[i] = positions[i].latitude;
+            longitude[i] = positions[i].longitude;
+            altitude[i] = positions[i].altitude;
+            vn[i] = velocities[i].north;
+            vu[i] = velocities[i].up;
+            ve[i] = velocities[i].east;
+        }
+        std::size_t reps = TOTAL_UPDATES / n;
+
+        // 基线：逐对象调用
+        double best = 1e30;
+        for (int r = 0; r < ROUNDS; ++r) {
+            double t0 = nowSeconds();
+            for (std::size_t k = 0; k < reps; ++k) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    positions[i] = updateGeoPosition(positions[i], velocities[i], dt);
+                }
+            }
+            best = std::min(best, nowSeconds() - t0);
+        }
+        double baseline = best / (reps * n) * 1e9;
+        std::cout << "\nN = " << n << std::endl;
+        std::cout << "  逐对象 updateGeoPosition : " << std::setw(8) << baseline << " ns/架" << std::endl;
+
+        const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::AVX2, SimdLevel::AVX512 };
+        for (SimdLevel level : levels) {
+            const SimdKernelTable* table = getSimdKernels(level);
+            if (!table || static_cast<int>(level) > static_cast<int>(detectSimdLevel())) {
+                continue;
+            }
+            best = 1e30;
+            for (int r = 0; r < ROUNDS; ++r) {
+                double t0 = nowSeconds();
+                for (std::size_t k = 0; k < reps; ++k) {
+                    table->updateGeoPosition(latitude.data(), longitude.data(), altitude.data(),
+                                             vn.data(), vu.data(), ve.data(), n, dt);
+                }
+                best = std::min(best, nowSeconds() - t0);
+            }
+            double ns = best / (reps * n) * 1e9;
+            std::cout << "  批量 " << std::setw(8) << getSimdLevelName(level) << "          : "
+                      << std::setw(8) << ns << " ns/架  加速比 " << baseline / ns << "x" << std::endl;
+        }
+
+        // 防止编译器把结果优化掉
+        volatile double sink = positions[n / 2].latitude + latitude[n / 2];
+        (void)sink;
+    }
+    return 0;
+}
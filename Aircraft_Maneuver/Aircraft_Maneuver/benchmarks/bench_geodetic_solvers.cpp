@@ -0,0 +1,85 @@
+// ECEF -> 大地坐标求解器耗时基准，以及各求解器下 updateGeoPositionEigen 的单步耗时
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <vector>
+#include "AircraftModelLibrary.h"
+#include "CoordinateTransform.h"
+#include "GeodeticSolvers.h"
+
+namespace {
+
+double nowSeconds() {
+    using clock = std::chrono::steady_clock;
+    return std::chrono::duration<double>(clock::now().time_since_epoch()).count();
+}
+
+const int ROUNDS = 5;
+
+} // namespace
+
+int main() {
+    std::cout << "=== ECEF->大地坐标求解器基准 ===" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    // 全球分布、高度 -1km~100km 的测试点
+    const std::size_t n = 100000;
+    const int reps = 20;
+    std::vector<double> xs(n), ys(n), zs(n);
+    std::vector<GeoPosition> positions(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        double t = static_cast<double>(i) / n;
+        double lat = (-89.0 + 178.0 * t) * 3.14159265358979323846 / 180.0;
+        double lon = (-180.0 + 360.0 * std::fmod(t * 31.0, 1.0)) * 3.14159265358979323846 / 180.0;
+        double h = -1000.0 + 101000.0 * std::fmod(t * 7.0, 1.0);
+        double N = GeodeticSolvers::WGS84_A / std::sqrt(1.0 - GeodeticSolvers::WGS84_E2 * std::sin(lat) * std::sin(lat));
+        xs[i] = (N + h) * std::cos(lat) * std::cos(lon);
+        ys[i] = (N + h) * std::cos(lat) * std::sin(lon);
+        zs[i] = (N * (1.0 - GeodeticSolvers::WGS84_E2) + h) * std::sin(lat);
+        positions[i] = { lon * 180.0 / 3.14159265358979323846, lat * 180.0 / 3.14159265358979323846, h };
+    }
+    Vector3 velocity = { 200.0, 5.0, 80.0 };
+
+    const GeodeticSolver solvers[] = {
+        GeodeticSolver::Iterative, GeodeticSolver::Bowring, GeodeticSolver::Olson, GeodeticSolver::Vermeille
+    };
+    double sink = 0.0;
+    for (GeodeticSolver solver : solvers) {
+        double best = 1e30;
+        for (int r = 0; r < ROUNDS; ++r) {
+            double t0 = nowSeconds();
+            for (int k = 0; k < reps; ++k) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    sink += GeodeticSolvers::solve(xs[i], ys[i], zs[i], solver).altitude;
+                }
+            }
+            best = std::min(best, nowSeconds() - t0);
+        }
+        double solveNs = best / (static_cast<double>(n) * reps) * 1e9;
+
+#ifdef USE_EIGEN
+        best = 1e30;
+        for (int r = 0; r < ROUNDS; ++r) {
+            double t0 = nowSeconds();
+            for (int k = 0; k < reps; ++k) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    sink += CoordinateTransform::updateGeoPositionEigen(positions[i], velocity, 0.01, solver).altitude;
+                }
+            }
+            best = std::min(best, nowSeconds() - t0);
+        }
+        double stepNs = best / (static_cast<double>(n) * reps) * 1e9;
+#else
+        double stepNs = 0.0;
+#endif
+        std::cout << std::left << std::setw(10) << GeodeticSolvers::getName(solver) << std::right
+                  << " 求解 " << std::setw(7) << solveNs << " ns/点"
+                  << "   updateGeoPositionEigen " << std::setw(7) << stepNs << " ns/步" << std::endl;
+    }
+
+    // 防止编译器把结果优化掉
+    volatile double keep = sink;
+    (void)keep;
+    return 0;
+}
@@ -0,0 +1,129 @@
+// 机群运动学积分方法基准：各积分方法在不同步长下仿真60秒的耗时与位置误差
+// 误差相对于 RK4、dt=0.001 的参考解（机群中含大阻力小质量的飞机，速度弛豫时间约1秒）
+// 用法：bench_integrators [飞机数，默认 1024] [--filter 子串] [--samples N] [--json 路径]
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "BenchHarness.h"
+#include "AircraftFleet.h"
+#include "SimdSupport.h"
+
+namespace {
+
+const double DURATION = 60.0;
+
+AircraftFleet makeFleet(std::size_t count) {
+    AircraftFleet fleet(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        AircraftPerformance perf;
+        perf.mass = i % 6 == 0 ? 2000.0 : 8000.0 + 500.0 * (i % 7);
+        perf.dragCoefficient = i % 6 == 0 ? 2.0 : 0.01 + 0.005 * (i % 5);
+        GeoPosition position = { 116.0 + 1e-3 * i, -60.0 + 120.0 * static_cast<double>(i) / count, 1000.0 };
+        Vector3 velocity = { 150.0 + 0.3 * (i % 500), 5.0 * (i % 7) - 15.0, 40.0 * std::sin(0.1 * i) };
+        fleet.addAircraft(position, velocity, perf);
+    }
+    return fleet;
+}
+
+AircraftFleet simulate(std::size_t count, const IntegratorSettings& settings, double dt) {
+    AircraftFleet fleet = makeFleet(count);
+    fleet.setIntegrator(settings);
+    int steps = static_cast<int>(std::lround(DURATION / dt));
+    for (int s = 0; s < steps; ++s) {
+        fleet.stepKinematics(dt);
+    }
+    return fleet;
+}
+
+double maxPositionError(const AircraftFleet& a, const AircraftFleet& b) {
+    const double metersPerDegree = 6371000.0 * M_PI / 180.0;
+    double worst = 0.0;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        GeoPosition p = a.getPosition(i);
+        GeoPosition q = b.getPosition(i);
+        double dNorth = (p.latitude - q.latitude) * metersPerDegree;
+        double dEast = (p.longitude - q.longitude) * metersPerDegree * std::cos(q.latitude * M_PI / 180.0);
+        double dUp = p.altitude - q.altitude;
+        worst = std::max(worst, std::sqrt(dNorth * dNorth + dEast * dEast + dUp * dUp));
+    }
+    return worst;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    // 每次调用完整仿真60秒（数十至数百毫秒），首次确定调用次数的那一次即为预热
+    bench::BenchOptions defaults;
+    defaults.samples = 3;
+    defaults.warmupSeconds = 0.0;
+    bench::CommandLine cmd = bench::parseCommandLine(argc, argv, defaults, "bench_integrators.json");
+    std::size_t count = static_cast<std::size_t>(cmd.number(0, 1024));
+    std::cout << "=== 机群积分方法基准（" << count << " 架，仿真 " << DURATION << " 秒，SIMD级别 "
+              << getSimdLevelName(getActiveSimdLevel()) << "）===" << std::endl;
+
+    IntegratorSettings referenceSettings;
+    referenceSettings.method = IntegrationMethod::RK4;
+    const AircraftFleet reference = simulate(count, referenceSettings, 0.001);
+
+    struct Case {
+        IntegrationMethod method;
+        double dt;
+    };
+    const Case cases[] = {
+        { IntegrationMethod::SemiImplicitEuler, 0.002 }, { IntegrationMethod::SemiImplicitEuler, 0.01 },
+        { IntegrationMethod::SemiImplicitEuler, 0.05 },
+        { IntegrationMethod::RK4, 0.05 }, { IntegrationMethod::RK4, 0.1 }, { IntegrationMethod::RK4, 0.2 },
+        { IntegrationMethod::RK4, 0.5 },
+        { IntegrationMethod::RK45, 0.1 }, { IntegrationMethod::RK45, 0.5 }, { IntegrationMethod::RK45, 1.0 },
+        { IntegrationMethod::RK45, 5.0 },
+    };
+
+    bench::BenchHarness harness(cmd.options);
+    bench::BenchHarness::printHeader();
+    struct Row {
+        Case c;
+        double median;   // 毫秒
+        double error;    // 米
+    };
+    std::vector<Row> rows;
+    for (const Case& c : cases) {
+        IntegratorSettings settings;
+        settings.method = c.method;
+        char name[64];
+        std::snprintf(name, sizeof(name), "%s/dt=%g", getIntegrationMethodName(c.method), c.dt);
+        AircraftFleet result;
+        if (harness.run(name, [&] { result = simulate(count, settings, c.dt); })) {
+            rows.push_back({ c, harness.getResults().back().medianNs * 1e-6, maxPositionError(result, reference) });
+        }
+    }
+
+    std::cout << "\n方法                      dt       耗时 ms    ns/架/仿真秒     最大误差 米" << std::endl;
+    for (const Row& row : rows) {
+        const Case& c = row.c;
+        double median = row.median;
+        double error = row.error;
+        std::cout << std::left << std::setw(20) << getIntegrationMethodName(c.method) << std::right
+                  << std::fixed << std::setprecision(3) << std::setw(8) << c.dt
+                  << std::setw(14) << median
+                  << std::setw(16) << std::setprecision(1) << median * 1e6 / (count * DURATION)
+                  << std::setw(16) << std::scientific << std::setprecision(2) << error
+                  << std::defaultfloat << std::endl;
+    }
+
+    std::vector<std::pair<std::string, std::string>> meta = {
+        { "benchmark", "bench_integrators" },
+        { "compiler", bench::compilerName() },
+        { "simd_level", getSimdLevelName(getActiveSimdLevel()) },
+        { "aircraft", std::to_string(count) }
+    };
+    if (!harness.writeJson(cmd.jsonPath, meta)) {
+        std::cerr << "无法写入结果文件: " << cmd.jsonPath << std::endl;
+        return 1;
+    }
+    std::cout << "结果已写入 " << cmd.jsonPath << std::endl;
+    return 0;
+}
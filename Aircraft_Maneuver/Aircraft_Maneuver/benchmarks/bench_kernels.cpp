@@ -0,0 +1,376 @@
+// 热点内核微基准：逐个测量库中每次仿真步都会调用的函数的单次耗时
+// 用法：bench_kernels [输出JSON路径，默认 bench_kernels.json] [--filter 子串] [--samples N]（--json 路径 同第一个参数）
+// 结果以JSON输出，便于在不同提交之间对比回归。
+#include <algorithm>
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+#include "BenchHarness.h"
+#include "AircraftModelLibrary.h"
+#include "FighterJet.h"
+#include "ManeuverModel.h"
+#include "ManeuverRegistry.h"
+#include "ManeuverTemplate.h"
+#include "CompiledManeuverTemplate.h"
+#include "AnalyticPropagator.h"
+#include "AircraftFleet.h"
+#include "EulerAngleCalculation.h"
+#include "ImprovedCoordinateTransform.h"
+#include "SimdSupport.h"
+#ifdef USE_EIGEN
+#include "CoordinateTransform.h"
+#endif
+
+namespace {
+
+// 输入数组长度（2的幂，循环取用，避免编译器常量折叠和分支预测过于理想）
+const std::size_t INPUT_COUNT = 1024;
+
+// 机动基准每隔多少次调用恢复一次初始状态，防止长时间积分后状态漂移到非典型区域
+const std::size_t MANEUVER_RESET_INTERVAL = 4096;
+
+const char* MANEUVER_NAMES[] = {
+    "s", "s_advanced", "snake", "loop", "roll", "split_s", "immelmann",
+    "barrel_roll", "evasive_dive", "l_maneuver", "constant"
+};
+
+std::vector<GeoPosition> makePositions() {
+    std::vector<GeoPosition> positions(INPUT_COUNT);
+    for (std::size_t i = 0; i < INPUT_COUNT; ++i) {
+        double t = static_cast<double>(i) / INPUT_COUNT;
+        positions[i] = { -180.0 + 360.0 * std::fmod(t * 37.0, 1.0), -85.0 + 170.0 * t,
+                         100.0 + 15000.0 * std::fmod(t * 11.0, 1.0) };
+    }
+    return positions;
+}
+
+std::vector<Vector3> makeVelocities() {
+    std::vector<Vector3> velocities(INPUT_COUNT);
+    for (std::size_t i = 0; i < INPUT_COUNT; ++i) {
+        double heading = 2.0 * 3.14159265358979323846 * i / INPUT_COUNT;
+        double speed = 150.0 + 200.0 * std::fmod(i * 0.618, 1.0);
+        velocities[i] = { speed * std::cos(heading), 30.0 * std::sin(heading * 3.0), speed * std::sin(heading) };
+    }
+    return velocities;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    bench::CommandLine cmd = bench::parseCommandLine(argc, argv, bench::BenchOptions(), "bench_kernels.json");
+    const std::string outputPath = cmd.positional.empty() ? cmd.jsonPath : cmd.positional.front();
+
+    std::cout << "=== 热点内核微基准 ===" << std::endl;
+    std::cout << "SIMD级别: " << getSimdLevelName(getActiveSimdLevel()) << std::endl;
+    bench::BenchHarness harness(cmd.options);
+    bench::BenchHarness::printHeader();
+
+    const std::vector<GeoPosition> positions = makePositions();
+    const std::vector<Vector3> velocities = makeVelocities();
+    const std::size_t mask = INPUT_COUNT - 1;
+    std::size_t k = 0;
+
+    // 位置积分
+    harness.run("updateGeoPosition", [&] {
+        ++k;
+        bench::doNotOptimize(updateGeoPosition(positions[k & mask], velocities[k & mask], 0.01));
+    });
+
+    // 战斗机加速度
+    FighterJet jet("F-15");
+    jet.position = positions[0];
+    harness.run("FighterJet::computeAcceleration", [&] {
+        ++k;
+        jet.velocity = velocities[k & mask];
+        bench::doNotOptimize(jet.computeAcceleration());
+    });
+
+    // 各机动模型单步更新
+    for (const char* name : MANEUVER_NAMES) {
+        std::shared_ptr<ManeuverModel> model = ManeuverModelFactory::createManeuverModel(name);
+        ManeuverParameters params = ManeuverModelFactory::getDefaultParameters(name);
+        FighterJet aircraft("F-15");
+        aircraft.position = positions[0];
+        aircraft.velocity = { 250.0, 0.0, 0.0 };
+        const GeoPosition initialPosition = aircraft.position;
+        const Vector3 initialVelocity = aircraft.velocity;
+        model->initialize(params);
+        std::size_t calls = 0;
+        harness.run(std::string("ManeuverModel::update/") + name, [&] {
+            if (++calls % MANEUVER_RESET_INTERVAL == 0) {
+                aircraft.position = initialPosition;
+                aircraft.velocity = initialVelocity;
+                aircraft.setAttitude(AttitudeAngles());
+                model->reset();
+                model->initialize(params);
+            }
+            model->update(aircraft, 0.01);
+            bench::doNotOptimize(aircraft.velocity);
+        });
+    }
+
+    // 机动查找与创建：字符串工厂（堆分配）vs 编译期注册表（原位构造）
+    const std::size_t nameCount = sizeof(MANEUVER_NAMES) / sizeof(MANEUVER_NAMES[0]);
+    harness.run("ManeuverModelFactory::createManeuverModel", [&] {
+        ++k;
+        bench::doNotOptimize(ManeuverModelFactory::createManeuverModel(MANEUVER_NAMES[k % nameCount]));
+    });
+    harness.run("ManeuverRegistry::find", [&] {
+        ++k;
+        bench::doNotOptimize(ManeuverRegistry::find(MANEUVER_NAMES[k % nameCount]));
+    });
+    ManeuverSlot slot;
+    harness.run("ManeuverSlot::emplace", [&] {
+        ++k;
+        bench::doNotOptimize(slot.emplace(static_cast<ManeuverId>(k % ManeuverRegistry::count())));
+    });
+
+    // 长机动模板求值：游标顺序推进 vs 每次二分查找（1万个机动点，时间单调前进，到末尾后回绕）
+    std::vector<ManeuverPoint> scriptPoints;
+    for (int i = 0; i < 10000; ++i) {
+        scriptPoints.emplace_back(0.05 * i, std::sin(0.01 * i), std::cos(0.013 * i), 0.5, 0.2);
+    }
+    const ManeuverTemplate script("script", scriptPoints);
+    const double scriptEnd = script.getDuration();
+    double scriptTime = 0.0;
+    ManeuverTemplate::Cursor cursor;
+    harness.run("ManeuverTemplate::evaluate/cursor", [&] {
+        scriptTime = scriptTime + 0.01 < scriptEnd ? scriptTime + 0.01 : 0.0;
+        bench::doNotOptimize(script.evaluate(scriptTime, cursor));
+    });
+    harness.run("ManeuverTemplate::evaluate/binary_search", [&] {
+        scriptTime = scriptTime + 0.01 < scriptEnd ? scriptTime + 0.01 : 0.0;
+        bench::doNotOptimize(script.evaluate(scriptTime));
+    });
+
+    // 多架飞机在不同时刻求值同一模板：逐机游标插值 vs 编译样条批量求值（每次调用求值全部飞机）
+    const std::size_t fleetSize = 1024;
+    const CompiledManeuverTemplate compiledScript = CompiledManeuverTemplate::compile(script);
+    std::vector<double> fleetTimes(fleetSize);
+    for (std::size_t i = 0; i < fleetSize; ++i) {
+        fleetTimes[i] = scriptEnd * static_cast<double>(i) / fleetSize;
+    }
+    auto advanceFleetTimes = [&] {
+        for (double& t : fleetTimes) {
+            t = t + 0.01 < scriptEnd ? t + 0.01 : 0.0;
+        }
+    };
+    std::vector<ManeuverTemplate::Cursor> fleetCursors(fleetSize);
+    std::vector<double> fleetRates(5 * fleetSize);
+    harness.run("ManeuverTemplate::evaluate/cursor_x1024", [&] {
+        advanceFleetTimes();
+        for (std::size_t i = 0; i < fleetSize; ++i) {
+            ManeuverPoint p = script.evaluate(fleetTimes[i], fleetCursors[i]);
+            fleetRates[i] = p.turnRate;
+            fleetRates[fleetSize + i] = p.climbRate;
+            fleetRates[2 * fleetSize + i] = p.rollRate;
+            fleetRates[3 * fleetSize + i] = p.pitchRate;
+            fleetRates[4 * fleetSize + i] = p.yawRate;
+        }
+        bench::doNotOptimize(fleetRates[fleetSize - 1]);
+    });
+    std::vector<CompiledManeuverTemplate::Cursor> splineCursors(fleetSize);
+    const ManeuverRateArrays fleetOutput = { &fleetRates[0], &fleetRates[fleetSize], &fleetRates[2 * fleetSize],
+                                             &fleetRates[3 * fleetSize], &fleetRates[4 * fleetSize] };
+    harness.run("CompiledManeuverTemplate::evaluateBatch/x1024", [&] {
+        advanceFleetTimes();
+        compiledScript.evaluateBatch(fleetTimes.data(), fleetSize, fleetOutput, splineCursors.data());
+        bench::doNotOptimize(fleetRates[fleetSize - 1]);
+    });
+
+    // 60秒后的状态：解析外推（耗时与外推时长无关）vs 以0.01秒步长逐步仿真6000步
+    const char* propagatedNames[] = { "s", "l_maneuver" };
+    for (const char* name : propagatedNames) {
+        FighterJet aircraft("F-15");
+        aircraft.position = positions[0];
+        aircraft.velocity = { 250.0, 0.0, 0.0 };
+        aircraft.setManeuverModel(ManeuverModelFactory::createManeuverModel(name));
+        aircraft.initializeManeuver(ManeuverModelFactory::getDefaultParameters(name));
+        PropagatedState state;
+        harness.run(std::string("AnalyticPropagator::propagateTo/") + name + "_60s", [&] {
+            AnalyticPropagator::propagateTo(aircraft, 60.0, state);
+            bench::doNotOptimize(state);
+        });
+        std::shared_ptr<ManeuverModel> model = ManeuverModelFactory::createManeuverModel(name);
+        const ManeuverParameters params = ManeuverModelFactory::getDefaultParameters(name);
+        FighterJet stepped("F-15");
+        harness.run(std::string("ManeuverModel::update/") + name + "_60s_x6000", [&] {
+            stepped.position = aircraft.position;
+            stepped.velocity = aircraft.velocity;
+            model->initialize(params);
+            for (int step = 0; step < 6000; ++step) {
+                model->update(stepped, 0.01);
+                stepped.position = updateGeoPosition(stepped.position, stepped.velocity, 0.01);
+            }
+            bench::doNotOptimize(stepped.position);
+        });
+    }
+
+    // 机群一步运动学：经纬高积分 vs ECEF积分（不读取经纬高）vs ECEF积分后批量换算经纬高
+    AircraftFleet geodeticFleet(fleetSize);
+    for (std::size_t i = 0; i < fleetSize; ++i) {
+        geodeticFleet.addAircraft(positions[i & mask], velocities[i & mask], AircraftPerformance());
+    }
+    AircraftFleet ecefFleet = geodeticFleet;
+    ecefFleet.setKinematicsFrame(KinematicsFrame::ECEF);
+    harness.run("AircraftFleet::stepKinematics/geodetic_x1024", [&] {
+        geodeticFleet.stepKinematics(1e-6);
+        bench::doNotOptimize(geodeticFleet.latitudeData()[fleetSize - 1]);
+    });
+    harness.run("AircraftFleet::stepKinematics/ecef_x1024", [&] {
+        ecefFleet.stepKinematics(1e-6);
+        bench::doNotOptimize(ecefFleet.ecefXData()[fleetSize - 1]);
+    });
+    harness.run("AircraftFleet::stepKinematics/ecef+getPosition_x1024", [&] {
+        ecefFleet.stepKinematics(1e-6);
+        bench::doNotOptimize(ecefFleet.getPosition(fleetSize - 1));
+    });
+
+    // 由速度计算姿态角
+    harness.run("EulerAngleCalculator::calculateFromVelocity", [&] {
+        ++k;
+        bench::doNotOptimize(EulerAngleCalculator::calculateFromVelocity(velocities[k & mask]));
+    });
+
+    // 1024组速度/姿态：逐个精确计算 vs 批量（当前SIMD级别）；姿态角限制同样对比
+    std::vector<double> vn(INPUT_COUNT), vu(INPUT_COUNT), ve(INPUT_COUNT);
+    std::vector<double> pitch(INPUT_COUNT), roll(INPUT_COUNT), yaw(INPUT_COUNT);
+    for (std::size_t i = 0; i < INPUT_COUNT; ++i) {
+        vn[i] = velocities[i].north;
+        vu[i] = velocities[i].up;
+        ve[i] = velocities[i].east;
+    }
+    harness.run("EulerAngleCalculator::calculateFromVelocity/loop_x1024", [&] {
+        for (std::size_t i = 0; i < INPUT_COUNT; ++i) {
+            AttitudeAngles a = EulerAngleCalculator::calculateFromVelocity(velocities[i]);
+            pitch[i] = a.pitch;
+            roll[i] = a.roll;
+            yaw[i] = a.yaw;
+        }
+        bench::doNotOptimize(yaw[INPUT_COUNT - 1]);
+    });
+    harness.run("EulerAngleCalculator::calculateFromVelocityBatch/x1024", [&] {
+        EulerAngleCalculator::calculateFromVelocityBatch(vn.data(), vu.data(), ve.data(),
+                                                         pitch.data(), roll.data(), yaw.data(), INPUT_COUNT);
+        bench::doNotOptimize(yaw[INPUT_COUNT - 1]);
+    });
+    // 每次先把偏航放大到多周之外，使回绕循环真正执行
+    harness.run("EulerAngleCalculator::limitAttitudeAngles/loop_x1024", [&] {
+        for (std::size_t i = 0; i < INPUT_COUNT; ++i) {
+            AttitudeAngles a;
+            a.pitch = pitch[i];
+            a.roll = roll[i];
+            a.yaw = yaw[i] * 7.0;
+            a = EulerAngleCalculator::limitAttitudeAngles(a);
+            roll[i] = a.roll;
+        }
+        bench::doNotOptimize(roll[INPUT_COUNT - 1]);
+    });
+    std::vector<double> wrapped(INPUT_COUNT);
+    harness.run("EulerAngleCalculator::limitAttitudeAnglesBatch/x1024", [&] {
+        for (std::size_t i = 0; i < INPUT_COUNT; ++i) {
+            wrapped[i] = yaw[i] * 7.0;
+        }
+        EulerAngleCalculator::limitAttitudeAnglesBatch(pitch.data(), roll.data(), wrapped.data(), INPUT_COUNT);
+        bench::doNotOptimize(wrapped[INPUT_COUNT - 1]);
+    });
+
+    // 四元数姿态：机体系向量（传感器视轴）变换，每次由欧拉角经三角函数重建 vs 缓存的方向余弦矩阵只做乘加；
+    // 输出时整批换算为欧拉角和方向余弦矩阵
+    std::vector<double> qw(INPUT_COUNT), qx(INPUT_COUNT), qy(INPUT_COUNT), qz(INPUT_COUNT);
+    std::vector<AttitudeAngles> attitudes(INPUT_COUNT);
+    std::vector<DirectionCosineMatrix> matrices(INPUT_COUNT);
+    for (std::size_t i = 0; i < INPUT_COUNT; ++i) {
+        attitudes[i].pitch = pitch[i];
+        attitudes[i].roll = 0.5 * std::sin(0.1 * i);
+        attitudes[i].yaw = yaw[i];
+        Quaternion q = EulerAngleCalculator::toQuaternion(attitudes[i]);
+        qw[i] = q.w;
+        qx[i] = q.x;
+        qy[i] = q.y;
+        qz[i] = q.z;
+        matrices[i] = EulerAngleCalculator::toDCM(q);
+    }
+    const BodyVector boresight = { 0.94, 0.0, 0.34 };
+    harness.run("BodyVector->NUE/euler_trig", [&] {
+        ++k;
+        bench::doNotOptimize(EulerAngleCalculator::toDCM(EulerAngleCalculator::toQuaternion(attitudes[k & mask]))
+                                 .toNUE(boresight));
+    });
+    harness.run("BodyVector->NUE/cached_dcm", [&] {
+        ++k;
+        bench::doNotOptimize(matrices[k & mask].toNUE(boresight));
+    });
+    harness.run("EulerAngleCalculator::quaternionToEulerBatch/x1024", [&] {
+        EulerAngleCalculator::quaternionToEulerBatch(qw.data(), qx.data(), qy.data(), qz.data(),
+                                                     pitch.data(), roll.data(), wrapped.data(), INPUT_COUNT);
+        bench::doNotOptimize(wrapped[INPUT_COUNT - 1]);
+    });
+    harness.run("EulerAngleCalculator::quaternionToDCMBatch/x1024", [&] {
+        EulerAngleCalculator::quaternionToDCMBatch(qw.data(), qx.data(), qy.data(), qz.data(),
+                                                   matrices.data(), INPUT_COUNT);
+        bench::doNotOptimize(matrices[INPUT_COUNT - 1].m[2][2]);
+    });
+
+#ifdef USE_EIGEN
+    // 坐标正/逆变换
+    std::vector<Eigen::Vector3d> ecef(INPUT_COUNT);
+    for (std::size_t i = 0; i < INPUT_COUNT; ++i) {
+        ecef[i] = CoordinateTransform::geodeticToECEF(positions[i]);
+    }
+    harness.run("CoordinateTransform::geodeticToECEF", [&] {
+        ++k;
+        bench::doNotOptimize(CoordinateTransform::geodeticToECEF(positions[k & mask]));
+    });
+    harness.run("CoordinateTransform::ecefToGeodetic", [&] {
+        ++k;
+        bench::doNotOptimize(CoordinateTransform::ecefToGeodetic(ecef[k & mask]));
+    });
+#else
+    std::cout << "（未启用Eigen，跳过 CoordinateTransform 基准）" << std::endl;
+#endif
+
+    // 改进坐标变换
+    harness.run("ImprovedCoordinateTransform::calculateDistanceImproved", [&] {
+        ++k;
+        bench::doNotOptimize(ImprovedCoordinateTransform::calculateDistanceImproved(
+            positions[k & mask], positions[(k * 7 + 3) & mask]));
+    });
+    harness.run("ImprovedCoordinateTransform::calculateEarthRadius", [&] {
+        ++k;
+        bench::doNotOptimize(ImprovedCoordinateTransform::calculateEarthRadius(positions[k & mask].latitude));
+    });
+
+    // 曲率半径查表：单次调用与每步位置更新（两次半径计算）在精确公式与查表之间的差别
+    const Vector3 cruise = { 180.0, 2.0, 240.0 };
+    harness.run("ImprovedCoordinateTransform::updateGeoPositionImproved", [&] {
+        ++k;
+        bench::doNotOptimize(ImprovedCoordinateTransform::updateGeoPositionImproved(positions[k & mask], cruise, 0.01));
+    });
+    ImprovedCoordinateTransform::setCurvatureEvaluation(CurvatureEvaluation::Table);
+    bench::doNotOptimize(ImprovedCoordinateTransform::calculateEarthRadius(0.0));   // 纬度表在此生成，不计入计时
+    harness.run("ImprovedCoordinateTransform::calculateEarthRadius (Table)", [&] {
+        ++k;
+        bench::doNotOptimize(ImprovedCoordinateTransform::calculateEarthRadius(positions[k & mask].latitude));
+    });
+    harness.run("ImprovedCoordinateTransform::updateGeoPositionImproved (Table)", [&] {
+        ++k;
+        bench::doNotOptimize(ImprovedCoordinateTransform::updateGeoPositionImproved(positions[k & mask], cruise, 0.01));
+    });
+    ImprovedCoordinateTransform::setCurvatureEvaluation(CurvatureEvaluation::Exact);
+
+    std::vector<std::pair<std::string, std::string>> meta = {
+        { "benchmark", "bench_kernels" },
+        { "compiler", bench::compilerName() },
+        { "simd_level", getSimdLevelName(getActiveSimdLevel()) }
+    };
+    if (!harness.writeJson(outputPath, meta)) {
+        std::cerr << "无法写入结果文件: " << outputPath << std::endl;
+        return 1;
+    }
+    std::cout << "结果已写入 " << outputPath << std::endl;
+    return 0;
+}
@@ -0,0 +1,125 @@
+// 功能模块存储基准：每架飞机挂 4 个模块时，
+// 对比 Aircraft::getModule<T>（线性查找 + dynamic_pointer_cast）与 ModuleRegistry::get<T>（按类型下标访问），
+// 以及逐机 updateModules（每模块一次虚函数调用，模块散布在堆上）与 ModuleRegistry::update（按类型连续循环）
+// 用法：bench_module_registry [飞机数，默认 10000] [--filter 子串] [--samples N] [--json 路径]
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <vector>
+#include "BenchHarness.h"
+#include "AircraftModelLibrary.h"
+#include "AircraftModule.h"
+#include "FighterJet.h"
+#include "ModuleRegistry.h"
+
+namespace {
+
+class FuelModule : public AircraftModule {
+public:
+    std::string getModuleName() const override { return "Fuel"; }
+    void update(Aircraft&, double dt) override { fuel -= burnRate * dt; }
+    double fuel = 5000.0;
+    double burnRate = 1.2;
+};
+
+class SensorModule : public AircraftModule {
+public:
+    std::string getModuleName() const override { return "Sensor"; }
+    void update(Aircraft&, double dt) override {
+        sinceScan += dt;
+        if (sinceScan >= scanInterval) {
+            sinceScan -= scanInterval;
+            ++scans;
+        }
+    }
+    double sinceScan = 0.0;
+    double scanInterval = 0.5;
+    long scans = 0;
+};
+
+class DatalinkModule : public AircraftModule {
+public:
+    std::string getModuleName() const override { return "Datalink"; }
+    void update(Aircraft& aircraft, double) override { lastAltitude = aircraft.position.altitude; }
+    double lastAltitude = 0.0;
+};
+
+// 中位数（微秒），基准被过滤跳过时为0
+double medianUs(const bench::BenchHarness& harness, const std::string& name) {
+    const bench::BenchResult* r = harness.find(name);
+    return r ? r->medianNs * 1e-3 : 0.0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    bench::CommandLine cmd = bench::parseCommandLine(argc, argv, bench::BenchOptions(), "bench_module_registry.json");
+    std::size_t count = static_cast<std::size_t>(cmd.number(0, 10000));
+    std::cout << "=== 功能模块存储基准（" << count << " 架，每架 4 个模块）===" << std::endl;
+
+    // 原方式：模块按飞机依次创建，与其他堆分配交错，查找的 FuelModule 排在最后
+    std::vector<std::unique_ptr<Aircraft>> fleet;
+    std::vector<std::unique_ptr<std::string>> noise;
+    for (std::size_t i = 0; i < count; ++i) {
+        fleet.push_back(std::make_unique<FighterJet>("F-15"));
+        fleet.back()->addModule(std::make_shared<JammerModule>());
+        noise.push_back(std::make_unique<std::string>(64, 'x'));
+        fleet.back()->addModule(std::make_shared<SensorModule>());
+        fleet.back()->addModule(std::make_shared<DatalinkModule>());
+        noise.push_back(std::make_unique<std::string>(64, 'x'));
+        fleet.back()->addModule(std::make_shared<FuelModule>());
+    }
+
+    ModuleRegistry registry;
+    std::vector<EntityId> ids;
+    for (std::size_t i = 0; i < count; ++i) {
+        EntityId id = registry.createEntity(*fleet[i]);
+        ids.push_back(id);
+        registry.addModule<JammerModule>(id);
+        registry.addModule<SensorModule>(id);
+        registry.addModule<DatalinkModule>(id);
+        registry.addModule<FuelModule>(id);
+    }
+
+    // 每次调用遍历整个机群
+    bench::BenchHarness harness(cmd.options);
+    bench::BenchHarness::printHeader();
+    double sum = 0.0;
+    harness.run("Aircraft::getModule<FuelModule>", [&]() {
+        for (auto& a : fleet) sum += a->getModule<FuelModule>()->fuel;
+        bench::doNotOptimize(sum);
+    });
+    harness.run("ModuleRegistry::get<FuelModule>", [&]() {
+        for (EntityId id : ids) sum += registry.get<FuelModule>(id)->fuel;
+        bench::doNotOptimize(sum);
+    });
+    harness.run("Aircraft::updateModules", [&]() {
+        for (auto& a : fleet) a->updateModules(0.01);
+    });
+    harness.run("ModuleRegistry::update", [&]() { registry.update(0.01); });
+    double scanUs = medianUs(harness, "Aircraft::getModule<FuelModule>");
+    double lookupUs = medianUs(harness, "ModuleRegistry::get<FuelModule>");
+    double legacyUs = medianUs(harness, "Aircraft::updateModules");
+    double systemUs = medianUs(harness, "ModuleRegistry::update");
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "getModule<T> 线性查找:      " << scanUs << " us（每次 " << scanUs * 1e3 / count << " ns）" << std::endl;
+    std::cout << "ModuleRegistry::get<T>:     " << lookupUs << " us（每次 " << lookupUs * 1e3 / count << " ns），加速 "
+              << scanUs / lookupUs << "x" << std::endl;
+    std::cout << "逐机 updateModules:         " << legacyUs << " us" << std::endl;
+    std::cout << "ModuleRegistry::update:     " << systemUs << " us，加速 " << legacyUs / systemUs << "x" << std::endl;
+    std::cout << "（校验和 " << sum << "）" << std::endl;
+
+    std::vector<std::pair<std::string, std::string>> meta = {
+        { "benchmark", "bench_module_registry" },
+        { "compiler", bench::compilerName() },
+        { "aircraft", std::to_string(count) }
+    };
+    if (!harness.writeJson(cmd.jsonPath, meta)) {
+        std::cerr << "无法写入结果文件: " << cmd.jsonPath << std::endl;
+        return 1;
+    }
+    std::cout << "结果已写入 " << cmd.jsonPath << std::endl;
+    return 0;
+}
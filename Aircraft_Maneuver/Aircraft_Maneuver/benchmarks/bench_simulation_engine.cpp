@@ -0,0 +1,82 @@
+// 多机仿真引擎吞吐基准：不同线程数下每步推进全部飞机的耗时
+// 用法：bench_simulation_engine [飞机数，默认 20000] [--filter 子串] [--samples N] [--json 路径]
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchHarness.h"
+#include "AircraftModelLibrary.h"
+#include "FighterJet.h"
+#include "ManeuverModel.h"
+#include "SimulationEngine.h"
+
+namespace {
+
+const char* MANEUVERS[] = { "s", "loop", "roll", "split_s", "immelmann", "barrel_roll",
+                            "evasive_dive", "l_maneuver", "constant" };
+const double DT = 0.02;
+
+std::string caseName(std::size_t threads) {
+    return "SimulationEngine::step/" + std::to_string(threads) + " threads";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    // 每次调用推进整个机群一步（毫秒级），样本数即计时步数
+    bench::BenchOptions defaults;
+    defaults.samples = 50;
+    bench::CommandLine cmd = bench::parseCommandLine(argc, argv, defaults, "bench_simulation_engine.json");
+    std::size_t count = static_cast<std::size_t>(cmd.number(0, 20000));
+    std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    std::cout << "=== 多机仿真引擎基准 ===" << std::endl;
+    std::cout << "飞机数: " << count << "，硬件线程数: " << hardware << std::endl;
+    bench::BenchHarness harness(cmd.options);
+    bench::BenchHarness::printHeader();
+
+    std::vector<std::size_t> threadCounts;
+    for (std::size_t threads = 1; threads <= hardware; threads *= 2) {
+        threadCounts.push_back(threads);
+        if (threads * 2 > hardware && threads != hardware) threads = hardware / 2;
+    }
+    for (std::size_t threads : threadCounts) {
+        SimulationEngine engine(threads);
+        for (std::size_t i = 0; i < count; ++i) {
+            auto aircraft = std::make_shared<FighterJet>("F-15");
+            aircraft->position = { 116.0 + 1e-4 * i, 39.0, 1000.0 };
+            aircraft->velocity = { 200.0, 0.0, 0.0 };
+            std::string name = MANEUVERS[i % (sizeof(MANEUVERS) / sizeof(MANEUVERS[0]))];
+            aircraft->setManeuverModel(ManeuverModelFactory::createManeuverModel(name));
+            aircraft->initializeManeuver(ManeuverModelFactory::getDefaultParameters(name));
+            engine.addAircraft(aircraft);
+        }
+        harness.run(caseName(threads), [&] { engine.step(DT); });
+    }
+
+    const bench::BenchResult* single = harness.find(caseName(1));
+    if (single) {
+        std::cout << std::fixed << std::setprecision(3);
+        for (std::size_t threads : threadCounts) {
+            const bench::BenchResult* r = harness.find(caseName(threads));
+            if (!r) continue;
+            std::cout << std::setw(4) << threads << " 线程: " << std::setw(9) << r->medianNs * 1e-6 << " ms/步"
+                      << "  加速比 " << std::setw(6) << single->medianNs / r->medianNs << std::endl;
+        }
+    }
+
+    std::vector<std::pair<std::string, std::string>> meta = {
+        { "benchmark", "bench_simulation_engine" },
+        { "compiler", bench::compilerName() },
+        { "aircraft", std::to_string(count) },
+        { "hardware_threads", std::to_string(hardware) }
+    };
+    if (!harness.writeJson(cmd.jsonPath, meta)) {
+        std::cerr << "无法写入结果文件: " << cmd.jsonPath << std::endl;
+        return 1;
+    }
+    std::cout << "结果已写入 " << cmd.jsonPath << std::endl;
+    return 0;
+}
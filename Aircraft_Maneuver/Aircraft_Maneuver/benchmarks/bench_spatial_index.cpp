@@ -0,0 +1,107 @@
+// 机群空间索引基准：大机群每步重建索引、全机群邻近对检测与 k 近邻查询的耗时，
+// 与逐对精确计算比较（逐对计算在部分飞机上实测后按 N² 外推）
+// 用法：bench_spatial_index [飞机数，默认 100000] [邻近半径（米），默认 5000] [--filter 子串] [--samples N] [--json 路径]
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <string>
+#include <vector>
+#include "BenchHarness.h"
+#include "AircraftFleet.h"
+#include "FleetSpatialIndex.h"
+#include "SimdSupport.h"
+
+namespace {
+
+// 飞机集中在中国东部空域约 15°×10° 的范围内，高度 1~12 公里
+AircraftFleet makeFleet(std::size_t count) {
+    AircraftFleet fleet(count);
+    unsigned long long state = 2024;
+    auto next = [&state]() {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<double>(state >> 11) / 9007199254740992.0;
+    };
+    for (std::size_t i = 0; i < count; ++i) {
+        GeoPosition position = { 105.0 + 15.0 * next(), 25.0 + 10.0 * next(), 1000.0 + 11000.0 * next() };
+        fleet.addAircraft(position, { 200.0, 0.0, 0.0 }, AircraftPerformance());
+    }
+    return fleet;
+}
+
+// 中位数（毫秒），基准被过滤跳过时为0
+double medianMs(const bench::BenchHarness& harness, const std::string& name) {
+    const bench::BenchResult* r = harness.find(name);
+    return r ? r->medianNs * 1e-6 : 0.0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    // 每次调用处理整个机群（毫秒级）
+    bench::BenchOptions defaults;
+    defaults.samples = 5;
+    bench::CommandLine cmd = bench::parseCommandLine(argc, argv, defaults, "bench_spatial_index.json");
+    std::size_t count = static_cast<std::size_t>(cmd.number(0, 100000));
+    double radius = cmd.number(1, 5000.0);
+    std::cout << "=== 机群空间索引基准（" << count << " 架，邻近半径 " << radius << " 米，SIMD级别 "
+              << getSimdLevelName(getActiveSimdLevel()) << "）===" << std::endl;
+
+    bench::BenchHarness harness(cmd.options);
+    bench::BenchHarness::printHeader();
+    AircraftFleet fleet = makeFleet(count);
+    FleetSpatialIndex index(radius);
+    if (!harness.run("FleetSpatialIndex::rebuild", [&]() { index.rebuild(fleet); })) {
+        index.rebuild(fleet);   // 被过滤跳过时仍需建好索引供后续查询
+    }
+
+    std::vector<ProximityPair> pairs;
+    harness.run("FleetSpatialIndex::findPairs", [&]() { index.findPairs(radius, pairs); });
+
+    std::vector<SpatialNeighbor> neighbors;
+    const std::size_t queries = std::min<std::size_t>(count, 1000);
+    const std::string nearestName = "FleetSpatialIndex::queryNearest k=8 x" + std::to_string(queries);
+    harness.run(nearestName, [&]() {
+        for (std::size_t q = 0; q < queries; ++q) index.queryNearest(q * (count / queries), 8, neighbors);
+    });
+
+    // 逐对精确计算：前 sample 架飞机与全机群比较，按 N²/2 对外推
+    const std::size_t sample = std::min<std::size_t>(count, 20);
+    const std::string bruteName = "FleetSpatialIndex::distance brute force x" + std::to_string(sample) + " aircraft";
+    std::size_t bruteFound = 0;
+    harness.run(bruteName, [&]() {
+        bruteFound = 0;
+        for (std::size_t i = 0; i < sample; ++i) {
+            GeoPosition p = fleet.getPosition(i);
+            for (std::size_t j = 0; j < count; ++j) {
+                if (j != i && FleetSpatialIndex::distance(p, fleet.getPosition(j)) <= radius) ++bruteFound;
+            }
+        }
+    });
+    double rebuildMs = medianMs(harness, "FleetSpatialIndex::rebuild");
+    double pairsMs = medianMs(harness, "FleetSpatialIndex::findPairs");
+    double nearestMs = medianMs(harness, nearestName);
+    double bruteMs = medianMs(harness, bruteName) / sample * count / 2.0;
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "重建索引:            " << rebuildMs << " ms" << std::endl;
+    std::cout << "邻近对检测:          " << pairsMs << " ms（" << pairs.size() << " 对）" << std::endl;
+    std::cout << "8 近邻查询 x" << queries << ":   " << nearestMs << " ms" << std::endl;
+    std::cout << "逐对精确计算（外推）: " << bruteMs << " ms（抽样 " << sample << " 架找到 " << bruteFound << " 个邻居）"
+              << std::endl;
+    std::cout << "每步重建+邻近对相对逐对计算加速: " << bruteMs / (rebuildMs + pairsMs) << "x" << std::endl;
+
+    std::vector<std::pair<std::string, std::string>> meta = {
+        { "benchmark", "bench_spatial_index" },
+        { "compiler", bench::compilerName() },
+        { "simd_level", getSimdLevelName(getActiveSimdLevel()) },
+        { "aircraft", std::to_string(count) },
+        { "radius_m", std::to_string(radius) }
+    };
+    if (!harness.writeJson(cmd.jsonPath, meta)) {
+        std::cerr << "无法写入结果文件: " << cmd.jsonPath << std::endl;
+        return 1;
+    }
+    std::cout << "结果已写入 " << cmd.jsonPath << std::endl;
+    return 0;
+}
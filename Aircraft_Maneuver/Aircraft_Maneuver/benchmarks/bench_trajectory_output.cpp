@@ -0,0 +1,104 @@
+// 轨迹输出对仿真步耗时的影响：同步 TrajectoryRecorder vs 异步 AsyncTrajectoryWriter（各背压策略）
+// 每次调用为一步仿真加一次记录，每个样本一次调用，块写入发生在哪一步就计入哪一步；
+// 与不记录的仿真步对比，差值即记录调用的耗时（中位数 / p99 / 最大值）
+// 用法：bench_trajectory_output [--filter 子串] [--samples N] [--json 路径]
+#include <iostream>
+#include <iomanip>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "BenchHarness.h"
+#include "AircraftModelLibrary.h"
+#include "AsyncTrajectoryWriter.h"
+#include "FighterJet.h"
+#include "LocalTangentFrame.h"
+#include "ManeuverModel.h"
+#include "TrajectoryRecorder.h"
+
+namespace {
+
+const double DT = 0.01;
+const char* PATH = "bench_trajectory_output.bin";
+
+// 从同一初始状态开始逐步仿真并记录
+template<class Record>
+void runCase(bench::BenchHarness& harness, const std::string& name, FighterJet aircraft, Record record) {
+    double t = 0.0;
+    harness.run(name, [&] {
+        aircraft.updateManeuver(DT);
+        aircraft.updateKinematics(DT);
+        t += DT;
+        record(t, aircraft);
+    });
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    bench::BenchOptions defaults;
+    defaults.samples = 500000;
+    defaults.minSampleSeconds = 0.0;
+    bench::CommandLine cmd = bench::parseCommandLine(argc, argv, defaults, "bench_trajectory_output.json");
+    std::cout << "=== 轨迹输出步耗时基准（" << cmd.options.samples << " 步，含ECEF/NUE列）===" << std::endl;
+    bench::BenchHarness harness(cmd.options);
+    bench::BenchHarness::printHeader();
+
+    FighterJet aircraft("F-15");
+    aircraft.position = { 116.4074, 39.9042, 1000.0 };
+    aircraft.velocity = { 200.0, 0.0, 0.0 };
+    aircraft.setReferencePosition(aircraft.position);
+    aircraft.setManeuverModel(ManeuverModelFactory::createManeuverModel("s"));
+    aircraft.initializeManeuver(ManeuverModelFactory::getDefaultParameters("s"));
+    const unsigned columns = TrajectoryRecorder::RECORD_ECEF | TrajectoryRecorder::RECORD_NUE;
+
+    const std::string baselineName = "step only (no output)";
+    runCase(harness, baselineName, aircraft, [](double, const Aircraft&) {});
+
+    std::vector<std::pair<std::string, std::string>> notes;
+    {
+        TrajectoryRecorder recorder(PATH, columns);
+        runCase(harness, "step + TrajectoryRecorder", aircraft, [&](double t, const Aircraft& a) { recorder.record(t, a); });
+        notes.emplace_back("step + TrajectoryRecorder", "");
+    }
+
+    const BackpressurePolicy policies[] = { BackpressurePolicy::Block, BackpressurePolicy::Drop, BackpressurePolicy::Decimate };
+    const char* names[] = { "step + AsyncTrajectoryWriter/Block", "step + AsyncTrajectoryWriter/Drop",
+                            "step + AsyncTrajectoryWriter/Decimate" };
+    for (int p = 0; p < 3; ++p) {
+        AsyncWriterOptions options;
+        options.policy = policies[p];
+        AsyncTrajectoryWriter writer(PATH, columns, aircraft.getReferenceFrame(), options);
+        runCase(harness, names[p], aircraft, [&](double t, const Aircraft& a) { writer.submit(t, a); });
+        writer.close();
+        AsyncTrajectoryWriter::Stats stats = writer.getStats();
+        notes.emplace_back(names[p], "丢弃 " + std::to_string(stats.dropped) + "，抽稀 " + std::to_string(stats.decimated) +
+                                     "，峰值深度 " + std::to_string(stats.maxQueueDepth));
+    }
+    std::remove(PATH);
+
+    // 记录调用耗时 = 各项减去不记录时的中位数
+    const bench::BenchResult* baseline = harness.find(baselineName);
+    if (baseline) {
+        std::cout << "\n记录调用耗时（减去仿真步中位数 " << std::fixed << std::setprecision(1) << baseline->medianNs
+                  << " ns）" << std::endl;
+        for (const auto& note : notes) {
+            const bench::BenchResult* r = harness.find(note.first);
+            if (!r) continue;
+            std::cout << std::left << std::setw(40) << note.first << std::right
+                      << " 中位数 " << std::setw(8) << r->medianNs - baseline->medianNs << " ns"
+                      << "  p99 " << std::setw(9) << r->p99Ns - baseline->medianNs << " ns"
+                      << "  最大 " << std::setw(11) << r->maxNs - baseline->medianNs << " ns  " << note.second << std::endl;
+        }
+    }
+
+    std::vector<std::pair<std::string, std::string>> meta = {
+        { "benchmark", "bench_trajectory_output" },
+        { "compiler", bench::compilerName() }
+    };
+    if (!harness.writeJson(cmd.jsonPath, meta)) {
+        std::cerr << "无法写入结果文件: " << cmd.jsonPath << std::endl;
+        return 1;
+    }
+    std::cout << "结果已写入 " << cmd.jsonPath << std::endl;
+    return 0;
+}
@@ -1,12 +1,16 @@
 #include <iostream>
 #include <memory>
 #include <iomanip>
+#include <cmath>
+#include <cstdint>
 #include "AircraftModelLibrary.h"
 #include "FighterJet.h"
 #include "ManeuverModel.h"   // 新的机动模型接口
 #include "AircraftModule.h"  // 新的功能模块接口
 #include "CoordinateTransform.h"
 #include "ImprovedCoordinateTransform.h"
+#include "AsyncTrajectoryWriter.h"
+#include "MultiRateScheduler.h"
 
 // 示例：自定义干扰模块
 class JammerModule : public AircraftModule {
@@ -69,8 +73,12 @@ int main() {
 
 	aircraft->velocity = { 200.0, 0.0, 0.0 }; // 初始速度：北向 200 m/s
 
-	const double dt = 0.1;
-	const int steps = 50;
+	// 多速率仿真：运动学 100Hz，机动与功能模块 10Hz，轨迹每 0.1s 记录一次
+	const double tickRate = 100.0;
+	const double maneuverRate = 10.0;
+	const double moduleRate = 10.0;
+	const double recordRate = 10.0;
+	const double duration = 5.0;
 
 	// 1. 创建机动模型
 	auto maneuverModel = ManeuverModelFactory::createManeuverModel(maneuver);
@@ -89,49 +97,38 @@ int main() {
 	std::cout << "初始位置: 北京 (" << aircraft->position.latitude << "°, " 
 	          << aircraft->position.longitude << "°, " << aircraft->position.altitude << "m)" << std::endl;
 	std::cout << "机动类型: " << maneuver << std::endl;
-	std::cout << "时间步长: " << dt << "s" << std::endl;
-	std::cout << "仿真步数: " << steps << std::endl;
+	std::cout << "运动学/机动/模块/记录频率: " << tickRate << "/" << maneuverRate << "/" << moduleRate << "/"
+	          << recordRate << " Hz" << std::endl;
+	std::cout << "仿真时长: " << duration << "s" << std::endl;
 	std::cout << "=====================================" << std::endl;
 
-	// 4. 仿真循环
-	for (int i = 0; i < steps; ++i) {
-		aircraft->updateModules(dt);      // 更新所有功能模块
-		aircraft->updateManeuver(dt);      // 步进函数
-		aircraft->updateKinematics(dt);    // 运动学更新
-		
-		// 计算坐标转换
-		Vector3 ecefPos = aircraft->getECEFPosition();
-		Vector3 localNUE = aircraft->getLocalNUEPosition();
-		double distanceFromRef = aircraft->getDistanceFromReference();
-		double bearingFromRef = aircraft->getBearingFromReference();
-		
-		// 输出位置信息
-		std::cout << std::fixed << std::setprecision(6);
-		std::cout << "Step " << i << " (t=" << (i+1)*dt << "s):\n";
-		std::cout << "  地理坐标: Lat=" << aircraft->position.latitude 
-		          << "°, Lon=" << aircraft->position.longitude 
-		          << "°, Alt=" << aircraft->position.altitude << "m\n";
-		
-		std::cout << "  地球坐标系 (ECEF): X=" << ecefPos.north 
-		          << "m, Y=" << ecefPos.up << "m, Z=" << ecefPos.east << "m\n";
-		std::cout << "  当地地理系 (NUE): North=" << localNUE.north 
-		          << "m, Up=" << localNUE.up << "m, East=" << localNUE.east << "m\n";
-		std::cout << "  相对参考点: 距离=" << distanceFromRef/1000.0 
-		          << "km, 方位角=" << bearingFromRef << "°\n";
-		
-		std::cout << "  速度: North=" << aircraft->velocity.north 
-		          << "m/s, Up=" << aircraft->velocity.up 
-		          << "m/s, East=" << aircraft->velocity.east << "m/s\n";
-		std::cout << "  姿态: Pitch=" << aircraft->attitude.getPitchDegrees() 
-		          << "°, Roll=" << aircraft->attitude.getRollDegrees() 
-		          << "°, Yaw=" << aircraft->attitude.getYawDegrees() << "°\n";
-		std::cout << std::endl;
+	// 4. 仿真循环（每步状态快照交给写线程写入列式二进制轨迹文件，仿真线程不做格式化和磁盘I/O）
+	const std::string trajectoryPath = "trajectory.bin";
+	AsyncTrajectoryWriter recorder(trajectoryPath, TrajectoryRecorder::RECORD_ECEF | TrajectoryRecorder::RECORD_NUE,
+	                              aircraft->getReferenceFrame());
+	// 同一节拍内按注册顺序执行，与原单速率循环相同：功能模块 -> 机动 -> 运动学 -> 记录（每个记录周期的最后一个节拍）
+	MultiRateScheduler scheduler(tickRate);
+	for (const auto& module : aircraft->getModules()) {
+		scheduler.addModule(*aircraft, module, moduleRate);
 	}
-
+	scheduler.addStage("maneuver", maneuverRate, 0, [&](double, double dt) { aircraft->updateManeuver(dt); });
+	scheduler.addStage("kinematics", tickRate, 0, [&](double, double dt) { aircraft->updateKinematics(dt); });
+	scheduler.addStage("recorder", recordRate, static_cast<std::uint64_t>(tickRate / recordRate) - 1,
+	                   [&](double time, double) { recorder.submit(time, *aircraft); });
+	scheduler.run(static_cast<std::uint64_t>(std::llround(duration * tickRate)));
+	recorder.close();
+
+	std::cout << std::fixed << std::setprecision(6);
 	std::cout << "=== 仿真完成 ===" << std::endl;
 	std::cout << "最终位置: (" << aircraft->position.latitude << "°, " 
 	          << aircraft->position.longitude << "°, " << aircraft->position.altitude << "m)" << std::endl;
 	std::cout << "总飞行距离: " << aircraft->getDistanceFromReference()/1000.0 << " km" << std::endl;
+	const AttitudeStats& attitudeStats = aircraft->getAttitudeStats();
+	std::cout << "姿态按需计算: " << attitudeStats.computed << " 次（省去 " << attitudeStats.avoided() << " 次）" << std::endl;
+	std::cout << "轨迹已写入 " << trajectoryPath << "（" << recorder.getStats().written
+	          << " 步），可用 trajectory_to_csv 转换为CSV" << std::endl;
+	std::cout << "\n=== 各阶段运行统计 ===" << std::endl;
+	scheduler.printReport(std::cout);
 
 	return 0;
 }
@@ -0,0 +1,106 @@
+#include <iostream>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "AircraftModelLibrary.h"
+#include "AircraftFleet.h"
+#include "FighterJet.h"
+#include "ManeuverModel.h"
+#include "SimdSupport.h"
+
+int main() {
+    std::cout << "=== 机群容器测试 ===" << std::endl;
+
+    const double dt = 0.01;
+    const int steps = 500;
+    const int count = 64;
+
+    // 测试1：标量内核下批量运动学更新与逐对象更新结果逐位一致
+    setActiveSimdLevel(SimdLevel::Scalar);
+    std::vector<std::unique_ptr<Aircraft>> aircraftList;
+    AircraftFleet fleet(count);
+    AircraftFleet simdFleet(count);
+    for (int i = 0; i < count; ++i) {
+        // 混合型号：Su-27 的推力与阻力系数不同于性能参数表的默认值
+        auto aircraft = std::make_unique<FighterJet>(i % 2 ? "Su-27" : "F-15");
+        aircraft->position = {116.0 + 0.01 * i, 39.0 + 0.5 * i, 1000.0 + 10.0 * i};
+        aircraft->velocity = {200.0 - i, 5.0 * (i % 3), 30.0 + i};
+        fleet.addAircraft(*aircraft);
+        simdFleet.addAircraft(*aircraft);
+        aircraftList.push_back(std::move(aircraft));
+    }
+
+    for (int s = 0; s < steps; ++s) {
+        for (auto& aircraft : aircraftList) {
+            aircraft->updateKinematics(dt);
+        }
+        fleet.stepKinematics(dt);
+    }
+
+    for (int i = 0; i < count; ++i) {
+        GeoPosition p = fleet.getPosition(i);
+        Vector3 v = fleet.getVelocity(i);
+        const Aircraft& a = *aircraftList[i];
+        if (p.latitude != a.position.latitude || p.longitude != a.position.longitude ||
+            p.altitude != a.position.altitude || v.north != a.velocity.north ||
+            v.up != a.velocity.up || v.east != a.velocity.east) {
+            std::cout << "✗ 槽位 " << i << " 与逐对象更新结果不一致" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "✓ 批量运动学与逐对象更新逐位一致" << std::endl;
+
+    // 测试2：SIMD内核结果在容差内
+    setActiveSimdLevel(detectSimdLevel());
+    std::cout << "SIMD级别: " << getSimdLevelName(getActiveSimdLevel()) << std::endl;
+    for (int s = 0; s < steps; ++s) {
+        simdFleet.stepKinematics(dt);
+    }
+    for (int i = 0; i < count; ++i) {
+        GeoPosition p = simdFleet.getPosition(i);
+        const Aircraft& a = *aircraftList[i];
+        if (std::abs(p.latitude - a.position.latitude) > 1e-9 ||
+            std::abs(p.longitude - a.position.longitude) > 1e-9 ||
+            std::abs(p.altitude - a.position.altitude) > 1e-6) {
+            std::cout << "✗ 槽位 " << i << " SIMD结果超出容差" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "✓ SIMD批量运动学结果在容差内" << std::endl;
+    setActiveSimdLevel(SimdLevel::Scalar);
+
+    // 测试3：槽位适配器可驱动已有机动模型
+    FleetSlotAircraft slot(fleet, 3);
+    FighterJet reference("Su-27");   // 与槽位3同型号
+    fleet.storeToAircraft(3, reference);
+
+    auto slotModel = ManeuverModelFactory::createManeuverModel("s");
+    auto refModel = ManeuverModelFactory::createManeuverModel("s");
+    auto params = ManeuverModelFactory::getDefaultParameters("s");
+    slot.setManeuverModel(slotModel);
+    slot.initializeManeuver(params);
+    reference.setManeuverModel(refModel);
+    reference.initializeManeuver(params);
+
+    for (int s = 0; s < 100; ++s) {
+        slot.pull();
+        slot.updateManeuver(dt);
+        slot.push();
+        fleet.stepKinematics(dt);
+
+        reference.updateManeuver(dt);
+        reference.updateKinematics(dt);
+    }
+
+    GeoPosition p = fleet.getPosition(3);
+    AttitudeAngles att = fleet.getAttitude(3);
+    if (p.latitude != reference.position.latitude || p.longitude != reference.position.longitude ||
+        att.yaw != reference.getAttitude().yaw) {
+        std::cout << "✗ 槽位适配器机动结果不一致" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 槽位适配器机动结果一致" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,135 @@
+#include <iostream>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include "AnalyticPropagator.h"
+#include "FighterJet.h"
+#include "ManeuverModel.h"
+#include "ManeuverRegistry.h"
+
+namespace {
+
+// 推力与阻力平衡的飞机（解析外推假设速度大小只由机动改变）
+class TrimmedJet : public FighterJet {
+public:
+    TrimmedJet() : FighterJet("F-15") {}
+    Vector3 computeAcceleration() const override { return { 0.0, 0.0, 0.0 }; }
+};
+
+// 两个位置之间的距离（米，局部平面近似）
+double distance(const GeoPosition& a, const GeoPosition& b) {
+    const double metersPerDegree = 6371000.0 * M_PI / 180.0;
+    double dNorth = (a.latitude - b.latitude) * metersPerDegree;
+    double dEast = (a.longitude - b.longitude) * metersPerDegree * std::cos(a.latitude * M_PI / 180.0);
+    double dUp = a.altitude - b.altitude;
+    return std::sqrt(dNorth * dNorth + dEast * dEast + dUp * dUp);
+}
+
+double velocityDifference(const Vector3& a, const Vector3& b) {
+    double dn = a.north - b.north;
+    double du = a.up - b.up;
+    double de = a.east - b.east;
+    return std::sqrt(dn * dn + du * du + de * de);
+}
+
+void stepAircraft(Aircraft& aircraft, double duration, double dt) {
+    int steps = static_cast<int>(std::lround(duration / dt));
+    for (int i = 0; i < steps; ++i) {
+        aircraft.updateManeuver(dt);
+        aircraft.updateKinematics(dt);
+    }
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== 解析外推测试 ===" << std::endl;
+
+    // 测试1：可外推的机动（含阶段切换与正弦转向）与小步长逐步仿真一致
+    const ManeuverId ids[] = { ManeuverId::GeneralS, ManeuverId::AdvancedS, ManeuverId::Snake,
+                               ManeuverId::SplitS, ManeuverId::EvasiveDive, ManeuverId::LManeuver };
+    const double warmups[] = { 0.0, 1.7, 4.2 };
+    const double dt = 0.001;
+    const double horizon = 60.0;
+    for (ManeuverId id : ids) {
+        double worstPosition = 0.0;
+        double worstVelocity = 0.0;
+        for (double warmup : warmups) {
+            TrimmedJet aircraft;
+            aircraft.position = { 116.0, 39.0, 1000.0 };
+            aircraft.velocity = { 180.0, 0.0, 120.0 };
+            aircraft.setManeuverModel(ManeuverRegistry::create(id));
+            aircraft.initializeManeuver(ManeuverRegistry::getDefaults(id).toParameters());
+            stepAircraft(aircraft, warmup, dt);
+
+            PropagatedState state;
+            if (!AnalyticPropagator::propagateTo(aircraft, horizon, state)) {
+                std::cout << "✗ " << ManeuverRegistry::getName(id) << " 不支持解析外推" << std::endl;
+                return 1;
+            }
+            stepAircraft(aircraft, horizon, dt);
+            worstPosition = std::max(worstPosition, distance(state.position, aircraft.position));
+            worstVelocity = std::max(worstVelocity, velocityDifference(state.velocity, aircraft.velocity));
+        }
+        // 逐步仿真的阶段切换时刻有一步的误差（航向相差 ω·dt），外推60秒后位置相差数米
+        if (worstPosition > 10.0 || worstVelocity > 0.5) {
+            std::cout << "✗ " << ManeuverRegistry::getName(id) << " 外推偏差 " << worstPosition << " 米 / "
+                      << worstVelocity << " 米/秒" << std::endl;
+            return 1;
+        }
+        std::cout << "✓ " << ManeuverRegistry::getName(id) << " 外推 " << horizon << " 秒与逐步仿真相差 "
+                  << worstPosition << " 米" << std::endl;
+    }
+
+    // 测试2：定常飞行仅在稳态时可外推（匀速直线），不能闭式表示的机动返回false
+    TrimmedJet cruiser;
+    cruiser.position = { 116.0, 39.0, 1000.0 };
+    cruiser.velocity = { 200.0, 0.0, 0.0 };
+    auto constant = std::make_shared<ConstantFlightModel>();
+    cruiser.setManeuverModel(constant);
+    PropagatedState cruise;
+    bool steady = AnalyticPropagator::propagateTo(cruiser, 100.0, cruise);
+    double cruiseError = distance(cruise.position, { 116.0, 39.0 + 20000.0 / (6371000.0 * M_PI / 180.0), 1000.0 });
+    constant->setTargetAltitude(3000.0);
+    PropagatedState unused;
+    bool climbing = AnalyticPropagator::propagateTo(cruiser, 100.0, unused);
+    TrimmedJet roller;
+    roller.position = { 116.0, 39.0, 1000.0 };
+    roller.velocity = { 200.0, 0.0, 0.0 };
+    bool noModel = AnalyticPropagator::propagateTo(roller, 10.0, unused);
+    roller.setManeuverModel(ManeuverRegistry::create(ManeuverId::Roll));
+    bool roll = AnalyticPropagator::propagateTo(roller, 10.0, unused);
+    if (!steady || cruiseError > 1e-3 || climbing || noModel || roll) {
+        std::cout << "✗ 外推适用范围判断错误" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 稳态定常飞行按直线外推，其它情况回退逐步仿真" << std::endl;
+
+    // 测试3：t=0 返回当前状态，负时间抛出异常，相位摆幅过大时返回false
+    TrimmedJet snake;
+    snake.position = { 116.0, 39.0, 1000.0 };
+    snake.velocity = { 150.0, 5.0, -80.0 };
+    snake.setManeuverModel(ManeuverRegistry::create(ManeuverId::Snake));
+    snake.initializeManeuver(ManeuverRegistry::getDefaults(ManeuverId::Snake).toParameters());
+    PropagatedState now;
+    bool same = AnalyticPropagator::propagateTo(snake, 0.0, now) &&
+                now.position.latitude == snake.position.latitude &&
+                now.position.longitude == snake.position.longitude &&
+                now.position.altitude == snake.position.altitude &&
+                velocityDifference(now.velocity, snake.velocity) == 0.0;
+    int caught = 0;
+    try { AnalyticPropagator::propagateTo(snake, -1.0, now); } catch (const std::invalid_argument&) { ++caught; }
+    MotionPlan wide;
+    MotionSegment& segment = wide.add(10.0);
+    segment.turnAmplitude = 1.0;
+    segment.turnFrequency = 0.001;
+    bool tooWide = AnalyticPropagator::propagate(snake.position, snake.velocity, wide, 10.0, now);
+    if (!same || caught != 1 || tooWide) {
+        std::cout << "✗ 边界情况处理错误" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 边界情况处理正确" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
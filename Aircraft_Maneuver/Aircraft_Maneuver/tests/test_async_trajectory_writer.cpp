@@ -0,0 +1,160 @@
+#include <iostream>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "AircraftModelLibrary.h"
+#include "AsyncTrajectoryWriter.h"
+#include "FighterJet.h"
+#include "LocalTangentFrame.h"
+#include "ManeuverModel.h"
+#include "SpscRing.h"
+#include "TrajectoryRecorder.h"
+
+namespace {
+
+const char* SYNC_PATH = "test_async_sync.bin";
+const char* ASYNC_PATH = "test_async_async.bin";
+
+// 生成一条机动轨迹的快照序列
+std::vector<TrajectorySample> makeSamples(int steps) {
+    FighterJet aircraft("F-15");
+    aircraft.position = { 116.4074, 39.9042, 1000.0 };
+    aircraft.velocity = { 200.0, 0.0, 0.0 };
+    aircraft.setManeuverModel(ManeuverModelFactory::createManeuverModel("barrel_roll"));
+    aircraft.initializeManeuver(ManeuverModelFactory::getDefaultParameters("barrel_roll"));
+    std::vector<TrajectorySample> samples;
+    for (int i = 0; i < steps; ++i) {
+        aircraft.updateManeuver(0.01);
+        aircraft.updateKinematics(0.01);
+        samples.push_back({ (i + 1) * 0.01, aircraft.position, aircraft.velocity, aircraft.getAttitude() });
+    }
+    return samples;
+}
+
+// 检查统计计数守恒、文件行数一致且时间严格递增
+bool checkLossyRun(const AsyncTrajectoryWriter::Stats& stats, std::size_t submitted) {
+    TrajectoryReader reader(ASYNC_PATH);
+    std::vector<double> time = reader.readColumn(TrajectoryColumn::Time);
+    for (std::size_t i = 1; i < time.size(); ++i) {
+        if (!(time[i] > time[i - 1])) return false;
+    }
+    return stats.submitted == submitted && stats.written + stats.dropped + stats.decimated == submitted &&
+           reader.getRowCount() == stats.written && stats.queueDepth == 0;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== 异步轨迹输出测试 ===" << std::endl;
+
+    // 测试1：SPSC环形队列容量、先进先出与跨线程顺序
+    SpscRing<int> small(5);
+    int value = 0;
+    int pushed = 0;
+    while (small.tryPush(pushed)) ++pushed;
+    bool fifo = small.capacity() == 8 && pushed == 8;
+    for (int i = 0; i < 8 && fifo; ++i) {
+        fifo = small.tryPop(value) && value == i;
+    }
+    fifo = fifo && !small.tryPop(value);
+
+    SpscRing<std::uint64_t> ring(64);
+    const std::uint64_t count = 1000000;
+    std::thread producer([&] {
+        for (std::uint64_t i = 0; i < count; ++i) {
+            while (!ring.tryPush(i)) std::this_thread::yield();
+        }
+    });
+    std::uint64_t expected = 0;
+    std::uint64_t item = 0;
+    while (expected < count) {
+        if (ring.tryPop(item)) {
+            if (item != expected) fifo = false;
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    if (!fifo) {
+        std::cout << "✗ 环形队列顺序错误" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 环形队列容量、先进先出与跨线程顺序正确" << std::endl;
+
+    // 测试2：Block 策略不丢数据，文件与同步记录器逐位一致（含写线程计算的ECEF/NUE）
+    const std::vector<TrajectorySample> samples = makeSamples(20000);
+    auto frame = std::make_shared<const LocalTangentFrame>(samples.front().position);
+    const unsigned columns = TrajectoryRecorder::RECORD_ECEF | TrajectoryRecorder::RECORD_NUE;
+    {
+        TrajectoryRecorder recorder(SYNC_PATH, columns, 1024);
+        for (const TrajectorySample& s : samples) {
+            recorder.record(s, LocalTangentFrame::geodeticToECEF(s.position), frame->toNUE(s.position));
+        }
+    }
+    AsyncWriterOptions options;
+    options.capacity = 16;
+    options.flushInterval = 1024;
+    AsyncTrajectoryWriter blocking(ASYNC_PATH, columns, frame, options);
+    for (const TrajectorySample& s : samples) {
+        blocking.submit(s);
+    }
+    blocking.close();
+    AsyncTrajectoryWriter::Stats stats = blocking.getStats();
+    if (stats.written != samples.size() || stats.dropped != 0 || stats.decimated != 0) {
+        std::cout << "✗ Block 策略丢失数据" << std::endl;
+        return 1;
+    }
+    {
+        TrajectoryReader syncReader(SYNC_PATH);
+        TrajectoryReader asyncReader(ASYNC_PATH);
+        for (TrajectoryColumn column : syncReader.getColumns()) {
+            if (syncReader.readColumn(column) != asyncReader.readColumn(column)) {
+                std::cout << "✗ 列 " << TrajectoryFormat::getColumnName(column) << " 与同步记录不一致" << std::endl;
+                return 1;
+            }
+        }
+    }
+    std::cout << "✓ Block 策略输出与同步记录逐位一致（等待 " << stats.blocked << " 次，峰值深度 "
+              << stats.maxQueueDepth << "）" << std::endl;
+
+    // 测试3：Drop / Decimate 策略计数守恒
+    const BackpressurePolicy lossy[] = { BackpressurePolicy::Drop, BackpressurePolicy::Decimate };
+    for (BackpressurePolicy policy : lossy) {
+        AsyncWriterOptions lossyOptions;
+        lossyOptions.capacity = 4;
+        lossyOptions.policy = policy;
+        AsyncTrajectoryWriter writer(ASYNC_PATH, 0, nullptr, lossyOptions);
+        for (const TrajectorySample& s : samples) {
+            writer.submit(s);
+        }
+        writer.close();
+        if (!checkLossyRun(writer.getStats(), samples.size())) {
+            std::cout << "✗ " << (policy == BackpressurePolicy::Drop ? "Drop" : "Decimate") << " 策略计数或输出错误" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "✓ Drop / Decimate 策略计数守恒、输出有序" << std::endl;
+
+    // 测试4：记录NUE但未提供参考坐标系时抛出异常
+    bool caught = false;
+    try {
+        AsyncTrajectoryWriter invalid(ASYNC_PATH, TrajectoryRecorder::RECORD_NUE);
+    }
+    catch (const std::invalid_argument&) {
+        caught = true;
+    }
+    std::remove(SYNC_PATH);
+    std::remove(ASYNC_PATH);
+    if (!caught) {
+        std::cout << "✗ 缺少参考坐标系未抛出异常" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 参数检查正确" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
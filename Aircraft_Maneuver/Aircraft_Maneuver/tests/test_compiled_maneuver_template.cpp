@@ -0,0 +1,194 @@
+#include <iostream>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+#include <vector>
+#include "CompiledManeuverTemplate.h"
+#include "ManeuverTemplate.h"
+#include "SimdKernels.h"
+#include "SimdSupport.h"
+
+namespace {
+
+double maxDifference(const ManeuverPoint& a, const ManeuverPoint& b) {
+    double d = std::abs(a.turnRate - b.turnRate);
+    d = std::max(d, std::abs(a.climbRate - b.climbRate));
+    d = std::max(d, std::abs(a.rollRate - b.rollRate));
+    d = std::max(d, std::abs(a.pitchRate - b.pitchRate));
+    return std::max(d, std::abs(a.yawRate - b.yawRate));
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== 编译机动模板测试 ===" << std::endl;
+
+    // 含阶跃（同一时刻重复点）与非均匀间隔的脚本
+    std::vector<ManeuverPoint> points;
+    for (int i = 0; i < 400; ++i) {
+        double t = 0.25 * i + ((i % 3 == 0) ? 0.0 : 0.07);
+        points.emplace_back(t, std::sin(0.05 * i), std::cos(0.03 * i), 0.002 * i, (i % 40 < 20) ? 0.5 : -0.5, 0.1);
+        if (i % 100 == 50) {
+            points.emplace_back(t, 0.0, 0.0);
+        }
+    }
+    ManeuverTemplate script("script", points);
+
+    // 测试1：线性编译与 ManeuverTemplate::evaluate 一致（含首点之前、阶跃处、末点之后）
+    CompiledManeuverTemplate linear = CompiledManeuverTemplate::compile(script, SplineInterpolation::Linear);
+    double linearError = 0.0;
+    for (double t = -2.0; t < script.getPoints().back().time + 2.0; t += 0.0117) {
+        linearError = std::max(linearError, maxDifference(linear.evaluate(t), script.evaluate(t)));
+    }
+    for (const ManeuverPoint& p : points) {
+        linearError = std::max(linearError, maxDifference(linear.evaluate(p.time), script.evaluate(p.time)));
+    }
+    if (linearError > 1e-12 || linear.getStartTime() != points.front().time ||
+        linear.getEndTime() != points.back().time) {
+        std::cout << "✗ 线性编译与模板插值不一致（最大误差 " << linearError << "）" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 线性编译与模板插值一致（" << linear.getSegmentCount() << " 段）" << std::endl;
+
+    // 测试2：保单调三次样条经过所有机动点，单调区间内不过冲
+    CompiledManeuverTemplate cubic = CompiledManeuverTemplate::compile(script);
+    double knotError = 0.0;
+    for (const ManeuverPoint& p : points) {
+        knotError = std::max(knotError, maxDifference(cubic.evaluate(p.time), script.evaluate(p.time)));
+    }
+    ManeuverTemplate ramp("ramp", { ManeuverPoint(0.0, 0.0, 0.0), ManeuverPoint(1.0, 0.1, 0.0),
+                                    ManeuverPoint(2.0, 0.9, 1.0), ManeuverPoint(3.0, 1.0, 1.0),
+                                    ManeuverPoint(5.0, 1.0, 0.0) });
+    CompiledManeuverTemplate rampSpline = CompiledManeuverTemplate::compile(ramp);
+    bool monotone = true;
+    double previous = -1.0;
+    for (double t = 0.0; t <= 5.0; t += 0.001) {
+        ManeuverPoint p = rampSpline.evaluate(t);
+        monotone = monotone && p.turnRate >= previous - 1e-15 && p.turnRate <= 1.0 + 1e-15 &&
+                   p.climbRate >= -1e-15 && p.climbRate <= 1.0 + 1e-15;
+        previous = p.turnRate;
+    }
+    if (knotError > 1e-12 || !monotone) {
+        std::cout << "✗ 三次样条插值错误（节点误差 " << knotError << "）" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 三次样条经过机动点且不过冲" << std::endl;
+
+    // 测试3：各SIMD级别的批量求值与单点求值一致，游标与二分结果一致
+    const std::size_t count = 1003;
+    std::vector<double> times(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        times[i] = -1.0 + 0.1 * static_cast<double>((i * 7919) % count);
+    }
+    std::vector<double> rates(5 * count);
+    ManeuverRateArrays output = { &rates[0], &rates[count], &rates[2 * count], &rates[3 * count], &rates[4 * count] };
+    std::vector<CompiledManeuverTemplate::Cursor> cursors(count);
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::AVX2, SimdLevel::AVX512 };
+    for (SimdLevel level : levels) {
+        if (!getSimdKernels(level) || level > detectSimdLevel()) continue;
+        setActiveSimdLevel(level);
+        for (int pass = 0; pass < 3; ++pass) {
+            double batchError = 0.0;
+            for (std::size_t i = 0; i < count; ++i) {
+                times[i] += 0.37;
+            }
+            cubic.evaluateBatch(times.data(), count, output, pass == 0 ? nullptr : cursors.data());
+            for (std::size_t i = 0; i < count; ++i) {
+                ManeuverPoint e = cubic.evaluate(times[i]);
+                ManeuverPoint b(times[i], output.turnRate[i], output.climbRate[i], output.rollRate[i],
+                                output.pitchRate[i], output.yawRate[i]);
+                batchError = std::max(batchError, maxDifference(e, b));
+            }
+            if (batchError > 1e-12 || (level == SimdLevel::Scalar && batchError != 0.0)) {
+                std::cout << "✗ " << getSimdLevelName(level) << " 批量求值误差 " << batchError << std::endl;
+                return 1;
+            }
+        }
+        std::cout << "✓ " << getSimdLevelName(level) << " 批量求值与单点求值一致" << std::endl;
+    }
+    setActiveSimdLevel(detectSimdLevel());
+
+    // 测试4：二进制序列化往返逐位一致，损坏数据抛出异常
+    std::vector<unsigned char> blob = cubic.toBlob();
+    CompiledManeuverTemplate restored = CompiledManeuverTemplate::fromBlob(blob.data(), blob.size());
+    const char* path = "test_compiled_template.bin";
+    cubic.save(path);
+    CompiledManeuverTemplate loaded = CompiledManeuverTemplate::load(path);
+    std::remove(path);
+    bool same = restored.getName() == "script" && loaded.getSegmentCount() == cubic.getSegmentCount() &&
+                restored.getInterpolation() == SplineInterpolation::MonotoneCubic && loaded.toBlob() == blob;
+    for (double t = -1.0; t < 110.0 && same; t += 0.3) {
+        same = maxDifference(restored.evaluate(t), cubic.evaluate(t)) == 0.0 &&
+               maxDifference(loaded.evaluate(t), cubic.evaluate(t)) == 0.0;
+    }
+    int caught = 0;
+    try { CompiledManeuverTemplate::fromBlob(blob.data(), blob.size() - 8); } catch (const std::runtime_error&) { ++caught; }
+    blob[0] = 'X';
+    try { CompiledManeuverTemplate::fromBlob(blob.data(), blob.size()); } catch (const std::runtime_error&) { ++caught; }
+    try { CompiledManeuverTemplate::load("missing_template.bin"); } catch (const std::runtime_error&) { ++caught; }
+    if (!same || caught != 3) {
+        std::cout << "✗ 序列化往返或格式检查错误" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 序列化往返逐位一致（" << loaded.toBlob().size() << " 字节）" << std::endl;
+
+    // 测试5：单点模板编译为常值段
+    CompiledManeuverTemplate single = CompiledManeuverTemplate::compile(
+        ManeuverTemplate("single", { ManeuverPoint(2.0, 0.3, -0.2, 0.1, 0.0, 0.4) }));
+    ManeuverPoint s0 = single.evaluate(0.0);
+    ManeuverPoint s1 = single.evaluate(9.0);
+    if (single.getSegmentCount() != 1 || single.getDuration() != 0.0 || s0.turnRate != 0.3 ||
+        s1.climbRate != -0.2 || s1.yawRate != 0.4) {
+        std::cout << "✗ 单点模板编译错误" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 单点模板编译为常值段" << std::endl;
+
+    // 测试6：首点、末点处的重复时间点与 ManeuverTemplate::evaluate 一致（含游标批量求值）
+    const ManeuverTemplate duplicates[] = {
+        ManeuverTemplate("trailing", { ManeuverPoint(0.0, 0.1, 0.2), ManeuverPoint(5.0, 0.3, -0.4),
+                                       ManeuverPoint(5.0, -0.5, 0.6) }),
+        ManeuverTemplate("leading", { ManeuverPoint(0.0, 0.1, 0.2), ManeuverPoint(0.0, -0.5, 0.6),
+                                      ManeuverPoint(5.0, 0.3, -0.4) }),
+        ManeuverTemplate("both", { ManeuverPoint(1.0, 0.7, 0.0), ManeuverPoint(1.0, 0.2, 0.1),
+                                   ManeuverPoint(1.0, -0.2, 0.3), ManeuverPoint(3.0, 0.4, 0.4),
+                                   ManeuverPoint(3.0, 0.9, -0.9), ManeuverPoint(4.0, 0.0, 0.5),
+                                   ManeuverPoint(4.0, -0.8, 0.2) }),
+        ManeuverTemplate("same", { ManeuverPoint(2.0, 0.3, 0.0), ManeuverPoint(2.0, -0.3, 0.1) }),
+    };
+    for (const ManeuverTemplate& t : duplicates) {
+        CompiledManeuverTemplate compiled = CompiledManeuverTemplate::compile(t, SplineInterpolation::Linear);
+        std::vector<double> sweep;
+        for (double s = -1.0; s <= 7.0; s += 0.125) {
+            sweep.push_back(s);
+        }
+        std::vector<double> sweepRates(5 * sweep.size());
+        const std::size_t m = sweep.size();
+        ManeuverRateArrays sweepOutput = { &sweepRates[0], &sweepRates[m], &sweepRates[2 * m], &sweepRates[3 * m],
+                                           &sweepRates[4 * m] };
+        std::vector<CompiledManeuverTemplate::Cursor> sweepCursors(m);
+        double duplicateError = 0.0;
+        for (double shift : { 0.0, -2.0, 3.0 }) {
+            std::vector<double> shifted(sweep);
+            for (double& s : shifted) {
+                s += shift;
+            }
+            compiled.evaluateBatch(shifted.data(), m, sweepOutput, sweepCursors.data());
+            for (std::size_t i = 0; i < m; ++i) {
+                ManeuverPoint expected = t.evaluate(shifted[i]);
+                ManeuverPoint b(shifted[i], sweepOutput.turnRate[i], sweepOutput.climbRate[i],
+                                sweepOutput.rollRate[i], sweepOutput.pitchRate[i], sweepOutput.yawRate[i]);
+                duplicateError = std::max(duplicateError, maxDifference(compiled.evaluate(shifted[i]), expected));
+                duplicateError = std::max(duplicateError, maxDifference(b, expected));
+            }
+        }
+        if (duplicateError > 1e-12) {
+            std::cout << "✗ " << t.getName() << " 重复时间点编译错误（最大误差 " << duplicateError << "）" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "✓ 首末重复时间点与模板插值一致" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
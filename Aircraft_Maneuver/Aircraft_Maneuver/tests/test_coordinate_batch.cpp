@@ -0,0 +1,67 @@
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <vector>
+#include "AircraftModelLibrary.h"
+#include "CoordinateTransform.h"
+#include "SimdKernels.h"
+
+int main() {
+    std::cout << "=== 批量坐标转换测试 ===" << std::endl;
+#ifdef USE_EIGEN
+    std::cout << "检测到的指令集: " << getSimdLevelName(detectSimdLevel()) << std::endl;
+
+    // 覆盖全球经纬度、地面到高空；点数不是向量宽度的整数倍，且超过多线程阈值
+    const std::size_t n = CoordinateTransform::BATCH_PARALLEL_THRESHOLD * 2 + 5;
+    std::vector<GeoPosition> points(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        double t = static_cast<double>(i) / n;
+        points[i].longitude = -180.0 + 360.0 * std::fmod(t * 37.0, 1.0);
+        points[i].latitude = -89.89 + 179.78 * t;
+        points[i].altitude = -400.0 + 25000.0 * std::fmod(t * 11.0, 1.0);
+    }
+
+    std::cout << std::scientific << std::setprecision(3);
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::AVX2, SimdLevel::AVX512 };
+    for (SimdLevel level : levels) {
+        if (!getSimdKernels(level) || static_cast<int>(level) > static_cast<int>(detectSimdLevel())) {
+            std::cout << "- 跳过 " << getSimdLevelName(level) << "（本机或本次编译不支持）" << std::endl;
+            continue;
+        }
+        setActiveSimdLevel(level);
+
+        Eigen::Matrix<double, 3, Eigen::Dynamic> ecef = CoordinateTransform::geodeticToECEF(points);
+        std::vector<GeoPosition> back = CoordinateTransform::ecefToGeodetic(ecef);
+
+        // 标量级别：与逐点版本逐位一致
+        // SIMD级别：ECEF与逐点版本比较；反算的迭代更充分、高度公式在高纬度更稳定，
+        // 逐点版本自身在高纬度有约1e-3米的高度误差，因此用往返误差衡量
+        bool exact = (level == SimdLevel::Scalar);
+        double maxEcef = 0.0, maxDeg = 0.0, maxAlt = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            Eigen::Vector3d expected = CoordinateTransform::geodeticToECEF(points[i]);
+            maxEcef = std::max(maxEcef, (ecef.col(i) - expected).cwiseAbs().maxCoeff());
+
+            GeoPosition geo = exact ? CoordinateTransform::ecefToGeodetic(expected) : points[i];
+            maxDeg = std::max(maxDeg, std::abs(back[i].latitude - geo.latitude));
+            maxDeg = std::max(maxDeg, std::abs(back[i].longitude - geo.longitude));
+            maxAlt = std::max(maxAlt, std::abs(back[i].altitude - geo.altitude));
+        }
+        std::cout << getSimdLevelName(level) << ": ECEF最大偏差 " << maxEcef << " 米, "
+                  << (exact ? "反算" : "往返") << "经纬度最大偏差 " << maxDeg
+                  << " 度, 高度最大偏差 " << maxAlt << " 米" << std::endl;
+
+        if (maxEcef > (exact ? 0.0 : 1e-8) || maxDeg > (exact ? 0.0 : 1e-11) || maxAlt > (exact ? 0.0 : 1e-6)) {
+            std::cout << "✗ " << getSimdLevelName(level) << " 批量坐标转换超出容差" << std::endl;
+            return 1;
+        }
+    }
+    setActiveSimdLevel(detectSimdLevel());
+    std::cout << "✓ 批量坐标转换与逐点版本一致" << std::endl;
+#else
+    std::cout << "未启用Eigen，跳过批量坐标转换测试" << std::endl;
+#endif
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,94 @@
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include "ImprovedCoordinateTransform.h"
+
+namespace {
+
+// 与库内精确公式相同的写法，用来确认 Exact 模式结果逐位不变
+double meridianReference(double latitude) {
+    double sinLat = std::sin(latitude * ImprovedCoordinateTransform::PI / 180.0);
+    double e2 = ImprovedCoordinateTransform::EARTH_ECCENTRICITY_SQ;
+    return ImprovedCoordinateTransform::EARTH_RADIUS_EQUATOR * (1 - e2) / std::pow(1 - e2 * sinLat * sinLat, 1.5);
+}
+
+double relativeError(double table, double exact) {
+    return std::abs(table / exact - 1.0);
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== 曲率半径查表测试 ===" << std::endl;
+
+    // 测试1：默认 Exact，结果与原公式逐位一致
+    if (ImprovedCoordinateTransform::getCurvatureEvaluation() != CurvatureEvaluation::Exact) {
+        std::cout << "✗ 默认计算方式不是 Exact" << std::endl;
+        return 1;
+    }
+    for (double lat = -90.0; lat <= 90.0; lat += 0.37) {
+        if (ImprovedCoordinateTransform::calculateMeridianRadius(lat) != meridianReference(lat)) {
+            std::cout << "✗ Exact 模式纬度 " << lat << " 子午圈半径与原公式不一致" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "✓ 默认 Exact 模式与原公式逐位一致" << std::endl;
+
+    // 测试2：密集采样（含节点、段中点、±90°以外的纬度），三种半径的相对误差都在声明的上界内
+    const int samples = 400001;
+    double exactMeridian[8], exactPrime[8], exactMean[8];
+    double worst[3] = { 0.0, 0.0, 0.0 };
+    for (int k = 0; k < samples; ++k) {
+        double lat = -100.0 + 200.0 * k / (samples - 1);
+        const double probes[] = { lat, std::round(lat * 4.0) / 4.0, std::round(lat * 4.0) / 4.0 + 0.125, 90.0, -90.0,
+                                  0.0, lat + 360.0, -lat - 180.0 };
+        ImprovedCoordinateTransform::setCurvatureEvaluation(CurvatureEvaluation::Exact);
+        for (int p = 0; p < 8; ++p) {
+            exactMeridian[p] = ImprovedCoordinateTransform::calculateMeridianRadius(probes[p]);
+            exactPrime[p] = ImprovedCoordinateTransform::calculatePrimeVerticalRadius(probes[p]);
+            exactMean[p] = ImprovedCoordinateTransform::calculateEarthRadius(probes[p]);
+        }
+        ImprovedCoordinateTransform::setCurvatureEvaluation(CurvatureEvaluation::Table);
+        for (int p = 0; p < 8; ++p) {
+            worst[0] = std::max(worst[0], relativeError(ImprovedCoordinateTransform::calculateMeridianRadius(probes[p]),
+                                                        exactMeridian[p]));
+            worst[1] = std::max(worst[1], relativeError(ImprovedCoordinateTransform::calculatePrimeVerticalRadius(probes[p]),
+                                                        exactPrime[p]));
+            worst[2] = std::max(worst[2], relativeError(ImprovedCoordinateTransform::calculateEarthRadius(probes[p]),
+                                                        exactMean[p]));
+        }
+    }
+    std::cout << "最大相对误差: 子午圈 " << worst[0] << "，卯酉圈 " << worst[1] << "，平均 " << worst[2] << std::endl;
+    if (*std::max_element(worst, worst + 3) > ImprovedCoordinateTransform::CURVATURE_TABLE_RELATIVE_ERROR) {
+        std::cout << "✗ 查表误差超过上界 " << ImprovedCoordinateTransform::CURVATURE_TABLE_RELATIVE_ERROR << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 查表相对误差 < " << ImprovedCoordinateTransform::CURVATURE_TABLE_RELATIVE_ERROR << std::endl;
+
+    // 测试3：非有限纬度与精确公式一样返回 NaN
+    if (!std::isnan(ImprovedCoordinateTransform::calculateEarthRadius(std::nan(""))) ||
+        !std::isnan(ImprovedCoordinateTransform::calculatePrimeVerticalRadius(INFINITY))) {
+        std::cout << "✗ 非有限纬度处理错误" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 非有限纬度返回 NaN" << std::endl;
+
+    // 测试4：查表模式下一小时积分的位置与精确模式相差不到1毫米
+    GeoPosition start = { 116.4, 39.9, 10000.0 };
+    Vector3 velocity = { 180.0, 5.0, 240.0 };
+    GeoPosition exact = start, table = start;
+    ImprovedCoordinateTransform::setCurvatureEvaluation(CurvatureEvaluation::Exact);
+    for (int step = 0; step < 36000; ++step) exact = ImprovedCoordinateTransform::updateGeoPositionImproved(exact, velocity, 0.1);
+    ImprovedCoordinateTransform::setCurvatureEvaluation(CurvatureEvaluation::Table);
+    for (int step = 0; step < 36000; ++step) table = ImprovedCoordinateTransform::updateGeoPositionImproved(table, velocity, 0.1);
+    ImprovedCoordinateTransform::setCurvatureEvaluation(CurvatureEvaluation::Exact);
+    double drift = ImprovedCoordinateTransform::calculateDistanceImproved(exact, table);
+    if (!(drift < 1e-3)) {
+        std::cout << "✗ 查表积分一小时偏差 " << drift << " 米" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 查表积分一小时与精确模式相差 " << drift << " 米" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
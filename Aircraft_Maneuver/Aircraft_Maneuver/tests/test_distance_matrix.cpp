@@ -0,0 +1,145 @@
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "ImprovedCoordinateTransform.h"
+#include "SimdKernels.h"
+#include "SimdSupport.h"
+
+namespace {
+
+// 经度、纬度按 GeoPosition 顺序；参考值由 GeographicLib（Karney 算法，精度约15纳米）计算
+struct ReferencePair {
+    GeoPosition from;
+    GeoPosition to;
+    double distance;
+    double bearing;
+};
+
+const ReferencePair REFERENCES[] = {
+    { { 20.0, 10.0, 0.0 }, { 150.0, -30.0, 0.0 }, 14400596.681976631, 120.82441715621884 },
+    { { 0.0, 0.0, 0.0 }, { 179.0, 0.5, 0.0 }, 19902751.03259346, 48.00245837898051 },
+    { { 10.0, 60.0, 0.0 }, { 100.0, -50.0, 0.0 }, 14606424.5651746, 120.64707875456193 },
+    { { 116.4, 39.9, 0.0 }, { 151.2, -33.9, 0.0 }, 8920744.757605009, 151.17248790663695 },
+    { { 0.0, 89.5, 0.0 }, { 180.0, 89.5, 0.0 }, 111693.95089655284, 0.0 },
+};
+
+// 站点：高纬、赤道、日期变更线附近；航迹：散布全球，含与站点重合、同在赤道上的点，个数不是向量宽度的整数倍
+std::vector<GeoPosition> makeSites() {
+    return { { 116.0, 39.0, 50.0 }, { 0.0, 0.0, 0.0 }, { 179.95, -12.0, 0.0 }, { -45.0, 88.0, 0.0 },
+             { 30.0, -60.0, 0.0 } };
+}
+
+std::vector<GeoPosition> makeTracks(std::size_t count) {
+    std::vector<GeoPosition> tracks;
+    for (std::size_t j = 0; j < count; ++j) {
+        double t = static_cast<double>(j);
+        tracks.push_back({ std::fmod(t * 37.3, 360.0) - 180.0, std::sin(t * 0.71 + 0.3) * 85.0, 1000.0 + 10.0 * t });
+    }
+    tracks[3] = { 116.0, 39.0, 9000.0 };        // 与站点0重合（高度不影响测地距离）
+    tracks[4] = { 60.0, 0.0, 0.0 };             // 与站点1同在赤道上
+    tracks[5] = { -179.95, -12.5, 0.0 };        // 与站点2隔日期变更线
+    return tracks;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== Vincenty距离矩阵测试 ===" << std::endl;
+
+    // 测试1：逐对Vincenty与GeographicLib参考值一致（修正前Δσ的B/6项少乘B/4，误差可达0.8米）
+    double worstDistance = 0.0, worstBearing = 0.0;
+    for (const ReferencePair& r : REFERENCES) {
+        worstDistance = std::max(worstDistance,
+                                 std::abs(ImprovedCoordinateTransform::calculateDistanceImproved(r.from, r.to) - r.distance));
+        worstBearing = std::max(worstBearing,
+                                std::abs(ImprovedCoordinateTransform::calculateBearingImproved(r.from, r.to) - r.bearing));
+    }
+    GeoPosition equatorA = { 10.0, 0.0, 0.0 };
+    GeoPosition equatorB = { 20.0, 0.0, 0.0 };
+    double equatorial = ImprovedCoordinateTransform::calculateDistanceImproved(equatorA, equatorB);
+    if (worstDistance > 1e-3 || worstBearing > 1e-6 || std::abs(equatorial - 1113194.9079327357) > 1e-3) {
+        std::cout << "✗ 与参考值相差 " << worstDistance << " 米、" << worstBearing << " 度，赤道上 " << equatorial
+                  << " 米" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 与GeographicLib相差 " << worstDistance << " 米、" << worstBearing << " 度" << std::endl;
+
+    // 测试2：各SIMD级别的矩阵与逐对计算一致（标量逐位一致）
+    std::vector<GeoPosition> sites = makeSites();
+    std::vector<GeoPosition> tracks = makeTracks(203);
+    std::vector<double> expectedDistance(sites.size() * tracks.size());
+    std::vector<double> expectedBearing(expectedDistance.size());
+    for (std::size_t i = 0; i < sites.size(); ++i) {
+        for (std::size_t j = 0; j < tracks.size(); ++j) {
+            expectedDistance[i * tracks.size() + j] = ImprovedCoordinateTransform::calculateDistanceImproved(sites[i], tracks[j]);
+            expectedBearing[i * tracks.size() + j] = ImprovedCoordinateTransform::calculateBearingImproved(sites[i], tracks[j]);
+        }
+    }
+    std::vector<double> distance(expectedDistance.size()), bearing(expectedDistance.size());
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::AVX2, SimdLevel::AVX512 };
+    for (SimdLevel level : levels) {
+        if (!getSimdKernels(level) || level > detectSimdLevel()) continue;
+        setActiveSimdLevel(level);
+        std::size_t failed = ImprovedCoordinateTransform::calculateDistanceMatrix(
+            sites.data(), sites.size(), tracks.data(), tracks.size(), distance.data(), bearing.data());
+        double dd = 0.0, db = 0.0;
+        for (std::size_t k = 0; k < distance.size(); ++k) {
+            dd = std::max(dd, std::abs(distance[k] - expectedDistance[k]));
+            // 方位角在 0/360 附近时按圆周差比较
+            double diff = std::abs(bearing[k] - expectedBearing[k]);
+            db = std::max(db, std::min(diff, 360.0 - diff));
+        }
+        bool exact = level != SimdLevel::Scalar || (distance == expectedDistance && bearing == expectedBearing);
+        std::cout << getSimdLevelName(level) << ": 距离最大偏差 " << dd << " 米，方位角最大偏差 " << db << " 度" << std::endl;
+        if (failed != 0 || !exact || dd > 1e-6 || db > 1e-9 || distance[3] != 0.0) {
+            std::cout << "✗ " << getSimdLevelName(level) << " 距离矩阵与逐对计算不一致" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "✓ 各SIMD级别距离矩阵与逐对计算一致" << std::endl;
+
+    // 测试3：近对跖点不收敛：默认回退为球面大圆距离，关闭回退时写 NaN；其余点对不受影响
+    std::vector<GeoPosition> antipodal = { { 179.7, 0.5, 0.0 }, { 60.0, 10.0, 0.0 }, { 179.5, 0.1, 0.0 } };
+    const double antipodalReference[] = { 19944127.420750458, 0.0, 19973497.493647642 };
+    GeoPosition origin = { 0.0, 0.0, 0.0 };
+    double row[3], rowBearing[3];
+    for (SimdLevel level : levels) {
+        if (!getSimdKernels(level) || level > detectSimdLevel()) continue;
+        setActiveSimdLevel(level);
+        std::size_t withFallback = ImprovedCoordinateTransform::calculateDistanceMatrix(&origin, 1, antipodal.data(), 3, row, rowBearing);
+        bool fallbackOk = withFallback == 2 && std::abs(row[0] / antipodalReference[0] - 1.0) < 0.01 &&
+                          std::abs(row[2] / antipodalReference[2] - 1.0) < 0.01 &&
+                          std::abs(row[1] - ImprovedCoordinateTransform::calculateDistanceImproved(origin, antipodal[1])) < 1e-6;
+        std::size_t withoutFallback = ImprovedCoordinateTransform::calculateDistanceMatrix(&origin, 1, antipodal.data(), 3, row,
+                                                                                          nullptr, false);
+        if (!fallbackOk || withoutFallback != 2 || !std::isnan(row[0]) || !std::isnan(row[2]) || std::isnan(row[1])) {
+            std::cout << "✗ " << getSimdLevelName(level) << " 近对跖点处理错误" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "✓ 近对跖点计数正确，回退距离与参考值相差 < 1%" << std::endl;
+
+    // 测试4：超过多线程阈值的矩阵与逐对计算逐位一致（标量级别），各行结果与线程划分无关
+    setActiveSimdLevel(SimdLevel::Scalar);
+    std::vector<GeoPosition> manySites = makeTracks(40);
+    std::vector<GeoPosition> manyTracks = makeTracks(3001);
+    std::vector<double> big(manySites.size() * manyTracks.size());
+    ImprovedCoordinateTransform::calculateDistanceMatrix(manySites.data(), manySites.size(), manyTracks.data(),
+                                                         manyTracks.size(), big.data(), nullptr, false);
+    for (std::size_t i = 0; i < manySites.size(); ++i) {
+        for (std::size_t j = 0; j < manyTracks.size(); j += 17) {
+            // 不收敛的近对跖点（NaN）逐对版本返回最后一次迭代的值，不比较
+            if (!std::isnan(big[i * manyTracks.size() + j]) && big[i * manyTracks.size() + j] !=
+                ImprovedCoordinateTransform::calculateDistanceImproved(manySites[i], manyTracks[j])) {
+                std::cout << "✗ 多线程矩阵第 " << i << " 行第 " << j << " 列与逐对计算不一致" << std::endl;
+                return 1;
+            }
+        }
+    }
+    setActiveSimdLevel(detectSimdLevel());
+    std::cout << "✓ 多线程分块的 " << manySites.size() << "×" << manyTracks.size() << " 矩阵与逐对计算逐位一致" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,183 @@
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include "AircraftFleet.h"
+#include "LocalTangentFrame.h"
+#include "SimdKernels.h"
+#include "SimdSupport.h"
+
+namespace {
+
+const double DT = 0.01;
+
+// 推力阻力为零的飞机：速度大小保持不变，便于与解析结果比较
+AircraftPerformance gliderPerformance() {
+    AircraftPerformance perf;
+    perf.mass = 10000.0;
+    perf.maxThrust = 0.0;
+    perf.dragCoefficient = 0.0;
+    return perf;
+}
+
+void run(AircraftFleet& fleet, double duration) {
+    int steps = static_cast<int>(std::lround(duration / DT));
+    for (int s = 0; s < steps; ++s) {
+        fleet.stepKinematics(DT);
+    }
+}
+
+double ecefDistance(const GeoPosition& a, const GeoPosition& b) {
+    Vector3 p = LocalTangentFrame::geodeticToECEF(a);
+    Vector3 q = LocalTangentFrame::geodeticToECEF(b);
+    double dx = p.north - q.north;
+    double dy = p.up - q.up;
+    double dz = p.east - q.east;
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+// 非整向量个数的机群：覆盖赤道、高纬、日期变更线附近与静止飞机
+AircraftFleet makeFleet() {
+    AircraftFleet fleet;
+    for (int i = 0; i < 37; ++i) {
+        AircraftPerformance perf;
+        perf.mass = 8000.0 + 500.0 * (i % 7);
+        perf.dragCoefficient = 0.01 + 0.005 * (i % 5);
+        GeoPosition position = { -179.5 + 9.7 * i, -85.0 + 4.7 * i, 500.0 + 100.0 * i };
+        Vector3 velocity = { 20.0 * (i % 19) - 60.0, 3.0 * (i % 4) - 4.0, 15.0 * (i % 11) };
+        if (i == 5) velocity = { 0.0, 0.0, 0.0 };
+        fleet.addAircraft(position, velocity, perf);
+    }
+    return fleet;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== 机群ECEF运动学测试 ===" << std::endl;
+
+    // 测试1：赤道向东平飞60秒，保持在赤道上，高度几乎不变，飞行距离等于 v·t
+    AircraftFleet fleet;
+    fleet.setKinematicsFrame(KinematicsFrame::ECEF);
+    GeoPosition start = { 10.0, 0.0, 1000.0 };
+    fleet.addAircraft(start, { 0.0, 0.0, 250.0 }, gliderPerformance());
+    run(fleet, 60.0);
+    GeoPosition p = fleet.getPosition(0);
+    double travelled = ecefDistance(start, p);
+    if (std::abs(p.latitude) > 1e-9 || std::abs(p.altitude - 1000.0) > 0.01 || std::abs(travelled - 15000.0) > 1.0) {
+        std::cout << "✗ 赤道平飞结果错误（纬度 " << p.latitude << "，高度 " << p.altitude << "，距离 "
+                  << travelled << "）" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 赤道平飞60秒：高度 " << p.altitude << " 米，飞行 " << travelled << " 米" << std::endl;
+
+    // 测试1b：大步长长时间平飞，切线直线积分的离地误差已补偿，高度漂移很小
+    AircraftFleet cruise;
+    cruise.setKinematicsFrame(KinematicsFrame::ECEF);
+    cruise.addAircraft({ 116.0, 10.0, 1000.0 }, { 250.0, 0.0, 30.0 }, gliderPerformance());
+    for (int s = 0; s < 3600; ++s) {
+        cruise.stepKinematics(1.0);
+    }
+    p = cruise.getPosition(0);
+    if (std::abs(p.altitude - 1000.0) > 0.5) {
+        std::cout << "✗ dt=1 平飞1小时高度漂移 " << p.altitude - 1000.0 << " 米" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ dt=1 平飞1小时高度漂移 " << p.altitude - 1000.0 << " 米" << std::endl;
+
+    // 测试2：飞越北极，经度跳到对侧，北向速度反号，航向不退化
+    AircraftFleet polar;
+    polar.setKinematicsFrame(KinematicsFrame::ECEF);
+    polar.addAircraft({ 30.0, 89.99, 1000.0 }, { 200.0, 0.0, 0.0 }, gliderPerformance());
+    run(polar, 60.0);
+    p = polar.getPosition(0);
+    Vector3 v = polar.getVelocity(0);
+    if (std::abs(p.longitude + 150.0) > 1e-6 || p.latitude > 89.91 || p.latitude < 89.9 ||
+        std::abs(v.north + 200.0) > 1e-3 || std::abs(v.east) > 1e-3 || std::abs(p.altitude - 1000.0) > 0.01) {
+        std::cout << "✗ 飞越极点结果错误（" << p.longitude << ", " << p.latitude << "，北向速度 " << v.north
+                  << "）" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 飞越北极：经度 " << p.longitude << "，纬度 " << p.latitude << "，北向速度 " << v.north << std::endl;
+
+    // 测试3：向东跨越日期变更线，经度回绕到 -180 附近
+    AircraftFleet dateline;
+    dateline.setKinematicsFrame(KinematicsFrame::ECEF);
+    dateline.addAircraft({ 179.9, 0.0, 1000.0 }, { 0.0, 0.0, 250.0 }, gliderPerformance());
+    run(dateline, 60.0);
+    p = dateline.getPosition(0);
+    double expected = 179.9 + 15000.0 / (6378137.0 + 1000.0) * 180.0 / M_PI - 360.0;
+    if (std::abs(p.longitude - expected) > 1e-4) {
+        std::cout << "✗ 日期变更线处理错误（经度 " << p.longitude << "，期望 " << expected << "）" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 跨越日期变更线：经度 " << p.longitude << std::endl;
+
+    // 测试4：setPosition 立即生效，切换坐标模式保留位置；ECEF 模式只支持半隐式欧拉
+    fleet.setPosition(0, { 116.0, 39.0, 3000.0 });
+    p = fleet.getPosition(0);
+    bool roundTrip = std::abs(p.longitude - 116.0) < 1e-9 && std::abs(p.latitude - 39.0) < 1e-9 &&
+                     std::abs(p.altitude - 3000.0) < 1e-6;
+    fleet.stepKinematics(DT);
+    GeoPosition before = fleet.getPosition(0);
+    fleet.setKinematicsFrame(KinematicsFrame::Geodetic);
+    GeoPosition after = fleet.getPosition(0);
+    bool kept = before.latitude == after.latitude && before.longitude == after.longitude &&
+                before.altitude == after.altitude;
+    int caught = 0;
+    IntegratorSettings rk4;
+    rk4.method = IntegrationMethod::RK4;
+    fleet.setIntegrator(rk4);
+    try { fleet.setKinematicsFrame(KinematicsFrame::ECEF); } catch (const std::invalid_argument&) { ++caught; }
+    fleet.setIntegrator(IntegratorSettings());
+    fleet.setKinematicsFrame(KinematicsFrame::ECEF);
+    try { fleet.setIntegrator(rk4); } catch (const std::invalid_argument&) { ++caught; }
+    if (!roundTrip || !kept || caught != 2 || fleet.getKinematicsFrame() != KinematicsFrame::ECEF) {
+        std::cout << "✗ 位置读写、模式切换或参数检查错误" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 位置读写与模式切换正确，ECEF 模式拒绝非欧拉积分" << std::endl;
+
+    // 测试5：各SIMD级别结果一致；局部坐标投影直接使用ECEF坐标，与经纬高路径一致
+    setActiveSimdLevel(SimdLevel::Scalar);
+    AircraftFleet reference = makeFleet();
+    reference.setKinematicsFrame(KinematicsFrame::ECEF);
+    run(reference, 10.0);
+    const SimdLevel levels[] = { SimdLevel::AVX2, SimdLevel::AVX512 };
+    for (SimdLevel level : levels) {
+        if (!getSimdKernels(level) || level > detectSimdLevel()) continue;
+        setActiveSimdLevel(level);
+        AircraftFleet vectorized = makeFleet();
+        vectorized.setKinematicsFrame(KinematicsFrame::ECEF);
+        run(vectorized, 10.0);
+        double worst = 0.0;
+        for (std::size_t i = 0; i < reference.size(); ++i) {
+            worst = std::max(worst, ecefDistance(reference.getPosition(i), vectorized.getPosition(i)));
+        }
+        if (worst > 1e-6) {
+            std::cout << "✗ " << getSimdLevelName(level) << " 与标量结果相差 " << worst << " 米" << std::endl;
+            return 1;
+        }
+        std::cout << "✓ " << getSimdLevelName(level) << " 与标量结果相差 " << worst << " 米" << std::endl;
+    }
+    setActiveSimdLevel(detectSimdLevel());
+
+    LocalTangentFrame frame({ 116.0, 39.0, 0.0 });
+    std::vector<Vector3> direct(reference.size());
+    frame.toNUE(reference, direct.data());
+    double worst = 0.0;
+    for (std::size_t i = 0; i < reference.size(); ++i) {
+        Vector3 q = frame.toNUE(reference.getPosition(i));
+        worst = std::max(worst, std::abs(q.north - direct[i].north) + std::abs(q.up - direct[i].up) +
+                                std::abs(q.east - direct[i].east));
+    }
+    if (worst > 1e-3) {
+        std::cout << "✗ ECEF 模式局部坐标投影偏差 " << worst << " 米" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ ECEF 模式局部坐标投影与经纬高路径相差 " << worst << " 米" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include "AircraftFleet.h"
+#include "SimdKernels.h"
+#include "SimdSupport.h"
+
+namespace {
+
+const double DURATION = 60.0;
+
+// 非整向量个数的机群：速度从静止到数百米/秒，纬度从南纬70°到北纬74°；
+// 每6架中有一架大阻力小质量（速度弛豫时间约1秒），使大步长时必须划分子步
+AircraftFleet makeFleet() {
+    AircraftFleet fleet;
+    for (int i = 0; i < 37; ++i) {
+        AircraftPerformance perf;
+        perf.mass = i % 6 == 0 ? 2000.0 : 8000.0 + 500.0 * (i % 7);
+        perf.dragCoefficient = i % 6 == 0 ? 2.0 : 0.01 + 0.005 * (i % 5);
+        GeoPosition position = { 116.0 + 0.3 * i, -70.0 + 4.0 * i, 500.0 + 100.0 * i };
+        Vector3 velocity = { 20.0 * (i % 19) - 60.0, 3.0 * (i % 4) - 4.0, 15.0 * (i % 11) };
+        if (i == 5) velocity = { 0.0, 0.0, 0.0 };
+        fleet.addAircraft(position, velocity, perf);
+    }
+    return fleet;
+}
+
+AircraftFleet integrate(IntegrationMethod method, double dt) {
+    AircraftFleet fleet = makeFleet();
+    IntegratorSettings settings;
+    settings.method = method;
+    fleet.setIntegrator(settings);
+    int steps = static_cast<int>(std::lround(DURATION / dt));
+    for (int s = 0; s < steps; ++s) {
+        fleet.stepKinematics(dt);
+    }
+    return fleet;
+}
+
+// 两个机群对应槽位的最大位置差（米）
+double maxPositionError(const AircraftFleet& a, const AircraftFleet& b) {
+    const double metersPerDegree = 6371000.0 * M_PI / 180.0;
+    double worst = 0.0;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        GeoPosition p = a.getPosition(i);
+        GeoPosition q = b.getPosition(i);
+        double dNorth = (p.latitude - q.latitude) * metersPerDegree;
+        double dEast = (p.longitude - q.longitude) * metersPerDegree * std::cos(q.latitude * M_PI / 180.0);
+        double dUp = p.altitude - q.altitude;
+        worst = std::max(worst, std::sqrt(dNorth * dNorth + dEast * dEast + dUp * dUp));
+    }
+    return worst;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== 机群积分方法测试 ===" << std::endl;
+
+    // 参考解：标量RK4，dt = 0.001
+    setActiveSimdLevel(SimdLevel::Scalar);
+    AircraftFleet reference = integrate(IntegrationMethod::RK4, 0.001);
+
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::AVX2, SimdLevel::AVX512 };
+    for (SimdLevel level : levels) {
+        if (!getSimdKernels(level) || level > detectSimdLevel()) continue;
+        setActiveSimdLevel(level);
+
+        // 测试1：半隐式欧拉为一阶收敛；RK4、RK45 用大20~100倍的步长仍比 dt=0.01 的欧拉更准
+        double euler = maxPositionError(integrate(IntegrationMethod::SemiImplicitEuler, 0.01), reference);
+        double eulerHalf = maxPositionError(integrate(IntegrationMethod::SemiImplicitEuler, 0.005), reference);
+        double rk4 = maxPositionError(integrate(IntegrationMethod::RK4, 0.2), reference);
+        double rk45 = maxPositionError(integrate(IntegrationMethod::RK45, 1.0), reference);
+        std::cout << getSimdLevelName(level) << ": 欧拉 dt=0.01 误差 " << euler << " 米，RK4 dt=0.2 误差 " << rk4
+                  << " 米，RK45 dt=1 误差 " << rk45 << " 米" << std::endl;
+        double ratio = euler / eulerHalf;
+        if (ratio < 1.8 || ratio > 2.2 || rk4 > 0.01 * euler || rk45 > 0.01 * euler || rk45 > 0.05) {
+            std::cout << "✗ " << getSimdLevelName(level) << " 积分精度不符合预期（欧拉步长减半误差比 " << ratio << "）" << std::endl;
+            return 1;
+        }
+        std::cout << "✓ " << getSimdLevelName(level) << " 各积分方法收敛正常" << std::endl;
+    }
+    setActiveSimdLevel(detectSimdLevel());
+
+    // 测试2：RK45 收紧容差后误差随之减小；调用间保留的子步长不影响结果精度
+    AircraftFleet loose = makeFleet();
+    AircraftFleet tight = makeFleet();
+    IntegratorSettings settings;
+    settings.method = IntegrationMethod::RK45;
+    settings.positionTolerance = 100.0;
+    settings.velocityTolerance = 10.0;
+    loose.setIntegrator(settings);
+    settings.positionTolerance = 1e-6;
+    settings.velocityTolerance = 1e-7;
+    tight.setIntegrator(settings);
+    for (int s = 0; s < 12; ++s) {
+        loose.stepKinematics(5.0);
+        tight.stepKinematics(5.0);
+    }
+    double looseError = maxPositionError(loose, reference);
+    double tightError = maxPositionError(tight, reference);
+    if (!(tightError < looseError) || tightError > 1e-3) {
+        std::cout << "✗ RK45 容差控制错误（" << looseError << " / " << tightError << " 米）" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ RK45 容差控制有效（" << looseError << " -> " << tightError << " 米）" << std::endl;
+
+    // 测试3：默认方法与参数检查
+    AircraftFleet fleet = makeFleet();
+    int caught = 0;
+    IntegratorSettings bad;
+    bad.positionTolerance = 0.0;
+    try { fleet.setIntegrator(bad); } catch (const std::invalid_argument&) { ++caught; }
+    bad.positionTolerance = 1.0;
+    bad.velocityTolerance = -1.0;
+    try { fleet.setIntegrator(bad); } catch (const std::invalid_argument&) { ++caught; }
+    if (caught != 2 || fleet.getIntegrator().method != IntegrationMethod::SemiImplicitEuler ||
+        std::string(getIntegrationMethodName(IntegrationMethod::RK45)) != "RK45") {
+        std::cout << "✗ 积分策略默认值或参数检查错误" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 默认半隐式欧拉，无效容差抛出异常" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
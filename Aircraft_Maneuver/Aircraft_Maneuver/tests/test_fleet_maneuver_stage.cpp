@@ -0,0 +1,107 @@
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include "AircraftFleet.h"
+#include "AircraftModelLibrary.h"
+#include "FighterJet.h"
+#include "FleetManeuverStage.h"
+#include "ManeuverRegistry.h"
+#include "SimdSupport.h"
+
+namespace {
+
+bool sameState(const Aircraft& aircraft, const AircraftFleet& fleet, std::size_t i) {
+    GeoPosition p = fleet.getPosition(i);
+    Vector3 v = fleet.getVelocity(i);
+    AttitudeAngles a = fleet.getAttitude(i);
+    return p.latitude == aircraft.position.latitude && p.longitude == aircraft.position.longitude &&
+           p.altitude == aircraft.position.altitude && v.north == aircraft.velocity.north &&
+           v.up == aircraft.velocity.up && v.east == aircraft.velocity.east &&
+           a.pitch == aircraft.getAttitude().pitch && a.roll == aircraft.getAttitude().roll && a.yaw == aircraft.getAttitude().yaw;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== 机群机动阶段测试 ===" << std::endl;
+
+    // 测试1：所有机动类型（含阶段切换）与逐机虚函数调用结果逐位一致
+    setActiveSimdLevel(SimdLevel::Scalar);
+    const std::size_t count = 4 * ManeuverRegistry::count();
+    const double dt = 0.01;
+    std::vector<std::unique_ptr<FighterJet>> aircraftList;
+    AircraftFleet fleet(count);
+    FleetManeuverStage stage;
+    for (std::size_t i = 0; i < count; ++i) {
+        ManeuverId id = static_cast<ManeuverId>(i % ManeuverRegistry::count());
+        auto aircraft = std::make_unique<FighterJet>("F-15");
+        aircraft->position = { 116.0 + 0.01 * i, 39.0 + 0.1 * i, 400.0 + 150.0 * (i % 12) };
+        aircraft->velocity = { 180.0 + i, 2.0 * (i % 5), 20.0 - i };
+        ManeuverParameters params = ManeuverRegistry::getDefaults(id).toParameters();
+        params.turnRate *= 1.0 + 0.05 * (i / ManeuverRegistry::count());
+        aircraft->setManeuverModel(ManeuverRegistry::create(id));
+        aircraft->initializeManeuver(params);
+        fleet.addAircraft(*aircraft);
+        stage.assign(fleet, i, id, params);
+        aircraftList.push_back(std::move(aircraft));
+    }
+    for (int step = 0; step < 800; ++step) {
+        for (auto& aircraft : aircraftList) {
+            aircraft->updateManeuver(dt);
+            aircraft->updateKinematics(dt);
+        }
+        stage.update(fleet, dt);
+        fleet.stepKinematics(dt);
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!sameState(*aircraftList[i], fleet, i)) {
+            std::cout << "✗ 槽位 " << i << "（" << ManeuverRegistry::getName(stage.getManeuver(i))
+                      << "）与逐机更新结果不一致" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "✓ " << count << " 架、" << ManeuverRegistry::count() << " 种机动 800 步与逐机虚函数调用逐位一致" << std::endl;
+
+    // 测试2：移除与重新分配后槽位映射正确，未分配槽位不被修改
+    for (std::size_t i = 0; i < count; i += 3) {
+        stage.remove(i);
+    }
+    std::size_t expected = count - (count + 2) / 3;
+    bool ok = stage.size() == expected;
+    for (std::size_t i = 0; i < count && ok; ++i) {
+        ManeuverId id = stage.getManeuver(i);
+        ok = (i % 3 == 0) ? id == ManeuverId::Count : id == static_cast<ManeuverId>(i % ManeuverRegistry::count());
+    }
+    Vector3 before = fleet.getVelocity(0);
+    stage.update(fleet, dt);
+    Vector3 after = fleet.getVelocity(0);
+    ok = ok && before.north == after.north && before.up == after.up && before.east == after.east;
+    stage.assign(fleet, 3, ManeuverId::ConstantFlight);   // 已移除的槽位：新增
+    stage.setConstantFlightTargets(3, 250.0, 2000.0, 0.5);
+    stage.assign(fleet, 4, ManeuverId::Loop);             // 已分配的槽位：替换
+    ok = ok && stage.getManeuver(3) == ManeuverId::ConstantFlight && stage.getManeuver(4) == ManeuverId::Loop &&
+         stage.size() == expected + 1;
+    stage.clear();
+    ok = ok && stage.size() == 0 && stage.getManeuver(1) == ManeuverId::Count;
+    if (!ok) {
+        std::cout << "✗ 移除/重新分配后槽位映射错误" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 移除与重新分配后槽位映射正确" << std::endl;
+
+    // 测试3：参数检查
+    int caught = 0;
+    try { stage.assign(fleet, count, ManeuverId::Loop); } catch (const std::invalid_argument&) { ++caught; }
+    try { stage.assign(fleet, 0, ManeuverId::Count); } catch (const std::invalid_argument&) { ++caught; }
+    stage.assign(fleet, 0, ManeuverId::Roll);
+    try { stage.setConstantFlightTargets(0, 200.0, 1000.0, 0.0); } catch (const std::invalid_argument&) { ++caught; }
+    if (caught != 3) {
+        std::cout << "✗ 非法参数未抛出异常" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 参数检查正确" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
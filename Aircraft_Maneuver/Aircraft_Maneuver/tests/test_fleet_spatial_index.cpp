@@ -0,0 +1,195 @@
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include "AircraftFleet.h"
+#include "FleetSpatialIndex.h"
+
+namespace {
+
+// 伪随机数（线性同余），保证各平台结果相同
+struct Random {
+    unsigned long long state = 12345;
+    double next() {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<double>(state >> 11) / 9007199254740992.0;
+    }
+};
+
+// 几个密集簇分布在赤道、日期变更线两侧与北极附近，再加少量全球散布的飞机
+AircraftFleet makeFleet(std::size_t count) {
+    const GeoPosition clusters[] = {
+        { 116.0, 39.0, 0.0 }, { 179.9, 10.0, 0.0 }, { -179.9, 10.0, 0.0 }, { 30.0, 89.9, 0.0 }, { 0.0, 0.0, 0.0 }
+    };
+    Random random;
+    AircraftFleet fleet(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        GeoPosition p;
+        if (i % 10 == 9) {
+            p = { random.next() * 360.0 - 180.0, random.next() * 170.0 - 85.0, random.next() * 15000.0 };
+        } else {
+            const GeoPosition& c = clusters[i % 5];
+            p.longitude = c.longitude + (random.next() - 0.5) * 0.6;
+            p.latitude = std::min(89.999, c.latitude + (random.next() - 0.5) * 0.4);
+            p.altitude = random.next() * 12000.0;
+            if (p.longitude > 180.0) p.longitude -= 360.0;
+            if (p.longitude < -180.0) p.longitude += 360.0;
+        }
+        // 赤道簇中一部分飞机恰好在赤道上（测地距离公式的特殊情形）
+        if (i % 5 == 4 && i % 3 == 0) p.latitude = 0.0;
+        fleet.addAircraft(p, { 200.0, 0.0, 0.0 }, AircraftPerformance());
+    }
+    return fleet;
+}
+
+std::vector<SpatialNeighbor> bruteRadius(const AircraftFleet& fleet, const GeoPosition& center, std::size_t exclude,
+                                         double radius) {
+    std::vector<SpatialNeighbor> result;
+    for (std::size_t i = 0; i < fleet.size(); ++i) {
+        if (i == exclude) continue;
+        double d = FleetSpatialIndex::distance(fleet.getPosition(i), center);
+        if (d <= radius) result.push_back({ i, d });
+    }
+    return result;
+}
+
+std::vector<SpatialNeighbor> bruteNearest(const AircraftFleet& fleet, const GeoPosition& center, std::size_t exclude,
+                                          std::size_t k) {
+    std::vector<SpatialNeighbor> result = bruteRadius(fleet, center, exclude, 1e300);
+    std::sort(result.begin(), result.end(), [](const SpatialNeighbor& a, const SpatialNeighbor& b) {
+        return a.distance < b.distance || (a.distance == b.distance && a.slot < b.slot);
+    });
+    if (result.size() > k) result.resize(k);
+    return result;
+}
+
+bool sameSlots(std::vector<SpatialNeighbor> a, std::vector<SpatialNeighbor> b) {
+    if (a.size() != b.size()) return false;
+    auto bySlot = [](const SpatialNeighbor& x, const SpatialNeighbor& y) { return x.slot < y.slot; };
+    std::sort(a.begin(), a.end(), bySlot);
+    std::sort(b.begin(), b.end(), bySlot);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if (a[i].slot != b[i].slot || a[i].distance != b[i].distance) return false;
+    }
+    return true;
+}
+
+bool sortedByDistance(const std::vector<SpatialNeighbor>& result) {
+    for (std::size_t i = 1; i < result.size(); ++i) {
+        if (result[i].distance < result[i - 1].distance) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== 机群空间索引测试 ===" << std::endl;
+    const std::size_t count = 3000;
+    AircraftFleet fleet = makeFleet(count);
+    FleetSpatialIndex index(5000.0);
+    index.rebuild(fleet);
+
+    // 测试1：按槽位与按位置的半径查询与逐对精确计算一致（含日期变更线两侧与极点附近）
+    const double radii[] = { 0.0, 2000.0, 8000.0, 30000.0 };
+    std::vector<SpatialNeighbor> result;
+    std::size_t totalFound = 0;
+    for (std::size_t slot = 0; slot < count; slot += 7) {
+        double radius = radii[slot % 4];
+        index.queryRadius(slot, radius, result);
+        if (!sameSlots(result, bruteRadius(fleet, fleet.getPosition(slot), slot, radius)) || !sortedByDistance(result)) {
+            std::cout << "✗ 槽位 " << slot << " 半径 " << radius << " 米查询结果与逐对计算不一致" << std::endl;
+            return 1;
+        }
+        totalFound += result.size();
+    }
+    const GeoPosition centers[] = { { 180.0, 10.0, 5000.0 }, { -120.0, 90.0, 0.0 }, { 116.1, 39.0, 20000.0 } };
+    for (const GeoPosition& center : centers) {
+        index.queryRadius(center, 25000.0, result);
+        if (!sameSlots(result, bruteRadius(fleet, center, count, 25000.0)) || result.empty()) {
+            std::cout << "✗ 位置 (" << center.longitude << ", " << center.latitude << ") 半径查询结果与逐对计算不一致"
+                      << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "✓ 半径查询与逐对精确计算一致（共找到 " << totalFound << " 个邻居）" << std::endl;
+
+    // 测试2：k近邻与逐对计算一致；全球散布的孤立飞机需要多次扩大搜索半径
+    const std::size_t ks[] = { 1, 5, 40 };
+    for (std::size_t slot = 0; slot < count; slot += 13) {
+        std::size_t k = ks[slot % 3];
+        index.queryNearest(slot, k, result);
+        std::vector<SpatialNeighbor> expected = bruteNearest(fleet, fleet.getPosition(slot), slot, k);
+        if (result.size() != k || !sortedByDistance(result) ||
+            result.back().distance != expected.back().distance || !sameSlots(result, expected)) {
+            std::cout << "✗ 槽位 " << slot << " 的 " << k << " 近邻与逐对计算不一致" << std::endl;
+            return 1;
+        }
+    }
+    index.queryNearest({ -40.0, -60.0, 0.0 }, 3, result);
+    if (!sameSlots(result, bruteNearest(fleet, { -40.0, -60.0, 0.0 }, count, 3))) {
+        std::cout << "✗ 远离机群位置的 k 近邻错误" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ k近邻查询与逐对精确计算一致" << std::endl;
+
+    // 测试3：全机群邻近对与逐对计算一致
+    std::vector<ProximityPair> pairs;
+    index.findPairs(3000.0, pairs);
+    std::vector<ProximityPair> expectedPairs;
+    for (std::size_t i = 0; i < count; ++i) {
+        for (std::size_t j = i + 1; j < count; ++j) {
+            double d = FleetSpatialIndex::distance(fleet.getPosition(i), fleet.getPosition(j));
+            if (d <= 3000.0) expectedPairs.push_back({ i, j, d });
+        }
+    }
+    bool samePairs = pairs.size() == expectedPairs.size();
+    for (std::size_t p = 0; samePairs && p < pairs.size(); ++p) {
+        samePairs = pairs[p].first == expectedPairs[p].first && pairs[p].second == expectedPairs[p].second &&
+                    pairs[p].distance == expectedPairs[p].distance;
+    }
+    if (!samePairs || pairs.empty()) {
+        std::cout << "✗ 邻近对 " << pairs.size() << " 个，逐对计算 " << expectedPairs.size() << " 个" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 3 公里内邻近对 " << pairs.size() << " 个，与逐对精确计算一致" << std::endl;
+
+    // 测试4：ECEF 运动学模式直接使用机群ECEF坐标；飞行后重建，结果跟随新位置
+    AircraftFleet moving = makeFleet(500);
+    moving.setKinematicsFrame(KinematicsFrame::ECEF);
+    for (int step = 0; step < 100; ++step) moving.stepKinematics(0.1);
+    FleetSpatialIndex movingIndex;
+    movingIndex.rebuild(moving);
+    for (std::size_t slot = 0; slot < moving.size(); slot += 11) {
+        movingIndex.queryRadius(slot, 10000.0, result);
+        if (!sameSlots(result, bruteRadius(moving, moving.getPosition(slot), slot, 10000.0))) {
+            std::cout << "✗ ECEF 模式槽位 " << slot << " 查询结果错误" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "✓ ECEF 模式机群重建后查询正确" << std::endl;
+
+    // 测试5：空机群、k 超过机群大小与非法参数
+    AircraftFleet empty;
+    FleetSpatialIndex emptyIndex;
+    emptyIndex.rebuild(empty);
+    emptyIndex.queryRadius({ 0.0, 0.0, 0.0 }, 1e6, result);
+    bool emptyOk = result.empty();
+    emptyIndex.queryNearest({ 0.0, 0.0, 0.0 }, 3, result);
+    emptyOk = emptyOk && result.empty();
+    index.queryNearest(0, count + 10, result);
+    bool allOk = result.size() == count - 1 && sortedByDistance(result);
+    int caught = 0;
+    try { FleetSpatialIndex bad(0.0); } catch (const std::invalid_argument&) { ++caught; }
+    try { index.queryRadius(0, -1.0, result); } catch (const std::invalid_argument&) { ++caught; }
+    try { index.queryNearest(count, 1, result); } catch (const std::invalid_argument&) { ++caught; }
+    if (!emptyOk || !allOk || caught != 3) {
+        std::cout << "✗ 边界情况处理错误" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 空机群、超大 k 与非法参数处理正确" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
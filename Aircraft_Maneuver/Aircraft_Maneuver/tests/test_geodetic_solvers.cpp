@@ -0,0 +1,102 @@
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <vector>
+#include "AircraftModelLibrary.h"
+#include "GeodeticSolvers.h"
+
+namespace {
+
+const long double PI_L = 3.141592653589793238462643383279502884L;
+
+// 参考解：long double 精度下迭代到收敛
+void referenceSolve(long double x, long double y, long double z,
+                    long double& lat, long double& lon, long double& h) {
+    const long double a = GeodeticSolvers::WGS84_A;
+    const long double e2 = GeodeticSolvers::WGS84_E2;
+    long double p = std::sqrt(x * x + y * y);
+    long double c = p * (1 - e2);
+    for (int i = 0; i < 60; ++i) {
+        long double r = std::sqrt(c * c + (1 - e2) * z * z);
+        c = p - e2 * a * c / r;
+    }
+    long double norm = std::sqrt(c * c + z * z);
+    long double sinLat = z / norm, cosLat = c / norm;
+    lat = std::atan2(z, c);
+    lon = std::atan2(y, x);
+    h = p * cosLat + z * sinLat - a * std::sqrt(1 - e2 * sinLat * sinLat);
+}
+
+// 大地坐标 -> ECEF（long double）
+void toECEF(long double latDeg, long double lonDeg, long double h,
+            long double& x, long double& y, long double& z) {
+    const long double a = GeodeticSolvers::WGS84_A;
+    const long double e2 = GeodeticSolvers::WGS84_E2;
+    long double lat = latDeg * PI_L / 180, lon = lonDeg * PI_L / 180;
+    long double N = a / std::sqrt(1 - e2 * std::sin(lat) * std::sin(lat));
+    x = (N + h) * std::cos(lat) * std::cos(lon);
+    y = (N + h) * std::cos(lat) * std::sin(lon);
+    z = (N * (1 - e2) + h) * std::sin(lat);
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== ECEF->大地坐标求解器精度测试 ===" << std::endl;
+    std::cout << "范围: 纬度 -90~90°, 经度 -180~180°, 高度 -1km~100km" << std::endl;
+
+    // 网格采样（含两极与赤道）
+    std::vector<double> xs, ys, zs, lats;
+    for (int i = 0; i <= 360; ++i) {
+        for (int j = 0; j < 12; ++j) {
+            for (int k = 0; k <= 20; ++k) {
+                long double x, y, z;
+                toECEF(-90.0L + 0.5L * i, -180.0L + 30.0L * j + 0.37L, -1000.0L + 5050.0L * k, x, y, z);
+                xs.push_back(static_cast<double>(x));
+                ys.push_back(static_cast<double>(y));
+                zs.push_back(static_cast<double>(z));
+                lats.push_back(-90.0 + 0.5 * i);
+            }
+        }
+    }
+
+    // 各算法的误差上限（米），与 GeodeticSolvers.h 中的说明一致
+    // 迭代法的高度公式 p/cosφ 在两极退化，只统计 |纬度| <= 89.5° 的点
+    struct Case { GeodeticSolver solver; double latTol; double altTol; double maxAbsLat; };
+    const Case cases[] = {
+        { GeodeticSolver::Iterative, 1e-5, 5e-4, 89.5 },
+        { GeodeticSolver::Bowring, 5e-9, 5e-9, 90.0 },
+        { GeodeticSolver::Olson, 5e-9, 5e-9, 90.0 },
+        { GeodeticSolver::Vermeille, 5e-9, 5e-9, 90.0 },
+    };
+
+    std::cout << std::scientific << std::setprecision(3);
+    bool ok = true;
+    for (const Case& c : cases) {
+        double maxLat = 0.0, maxLon = 0.0, maxAlt = 0.0;
+        for (std::size_t i = 0; i < xs.size(); ++i) {
+            if (std::abs(lats[i]) > c.maxAbsLat) continue;
+            long double lat, lon, h;
+            referenceSolve(xs[i], ys[i], zs[i], lat, lon, h);
+            GeoPosition g = GeodeticSolvers::solve(xs[i], ys[i], zs[i], c.solver);
+            // 纬度误差折算为子午线方向的地面距离
+            double dLat = static_cast<double>(std::abs(g.latitude * PI_L / 180 - lat) * GeodeticSolvers::WGS84_A);
+            double dLon = static_cast<double>(std::abs(g.longitude * PI_L / 180 - lon) * std::cos(lat) * GeodeticSolvers::WGS84_A);
+            maxLat = std::max(maxLat, dLat);
+            maxLon = std::max(maxLon, dLon);
+            maxAlt = std::max(maxAlt, static_cast<double>(std::abs(g.altitude - h)));
+        }
+        std::cout << std::left << std::setw(10) << GeodeticSolvers::getName(c.solver) << std::right
+                  << " 纬度误差 " << maxLat << " 米, 经度误差 " << maxLon
+                  << " 米, 高度误差 " << maxAlt << " 米" << std::endl;
+        if (maxLat > c.latTol || maxLon > c.latTol || maxAlt > c.altTol) {
+            std::cout << "✗ " << GeodeticSolvers::getName(c.solver) << " 超出说明的误差上限" << std::endl;
+            ok = false;
+        }
+    }
+    if (!ok) return 1;
+    std::cout << "✓ 各求解器误差均在说明范围内" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,120 @@
+#include <iostream>
+#include <memory>
+#include <vector>
+#include "AircraftFleet.h"
+#include "EulerAngleCalculation.h"
+#include "FighterJet.h"
+#include "FleetManeuverStage.h"
+#include "ManeuverRegistry.h"
+#include "SimdSupport.h"
+
+namespace {
+
+bool sameAttitude(const AttitudeAngles& a, const AttitudeAngles& b) {
+    return a.pitch == b.pitch && a.roll == b.roll && a.yaw == b.yaw;
+}
+
+std::unique_ptr<FighterJet> makeJet(ManeuverId id) {
+    auto jet = std::make_unique<FighterJet>("F-15");
+    jet->position = { 116.0, 39.0, 1000.0 };
+    jet->velocity = { 200.0, 5.0, 30.0 };
+    jet->setManeuverModel(ManeuverRegistry::create(id));
+    jet->initializeManeuver(ManeuverRegistry::getDefaults(id).toParameters());
+    return jet;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== 按需姿态计算测试 ===" << std::endl;
+    const double dt = 0.01;
+
+    // 测试1：100 Hz 步进、10 Hz 读取，读到的姿态等于读取时速度推导的姿态，只计算读取的次数
+    auto jet = makeJet(ManeuverId::GeneralS);
+    for (int step = 1; step <= 100; ++step) {
+        jet->updateManeuver(dt);
+        jet->updateKinematics(dt);
+        if (step % 10 == 0) {
+            AttitudeAngles expected = EulerAngleCalculator::calculateFromVelocity(jet->velocity);
+            if (!sameAttitude(jet->getAttitude(), expected) || !sameAttitude(jet->getAttitude(), expected)) {
+                std::cout << "✗ 第 " << step << " 步读取的姿态与速度不符" << std::endl;
+                return 1;
+            }
+        }
+    }
+    const AttitudeStats& stats = jet->getAttitudeStats();
+    if (stats.requested != 100 || stats.computed != 10 || stats.avoided() != 90) {
+        std::cout << "✗ 统计错误（请求 " << stats.requested << "，计算 " << stats.computed << "）" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 100步读取10次：计算 " << stats.computed << " 次，省去 " << stats.avoided() << " 次" << std::endl;
+
+    // 测试2：显式设置姿态的机动（Immelmann）从速度推导的姿态起逐步累加俯仰角，不被速度覆盖
+    auto immelmann = makeJet(ManeuverId::Immelmann);
+    immelmann->invalidateAttitude();
+    AttitudeAngles expected = EulerAngleCalculator::calculateFromVelocity(immelmann->velocity);
+    double pitchRate = ManeuverRegistry::getDefaults(ManeuverId::Immelmann).toParameters()
+                           .getActualPitchRate(immelmann->getPerformance());
+    for (int step = 0; step < 20; ++step) {
+        immelmann->updateManeuver(dt);
+        immelmann->updateKinematics(dt);
+        expected.pitch += pitchRate * dt;
+        expected = EulerAngleCalculator::limitAttitudeAngles(expected);
+    }
+    if (!sameAttitude(immelmann->getAttitude(), expected) || immelmann->isAttitudeStale()) {
+        std::cout << "✗ Immelmann 显式姿态错误（俯仰 " << immelmann->getAttitude().pitch << "，期望 "
+                  << expected.pitch << "）" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ Immelmann 显式姿态逐步累加（俯仰 " << immelmann->getAttitude().pitch << "）" << std::endl;
+
+    // 测试3：机群阶段按需计算，10 Hz 读取时与逐机模型逐位一致；槽位适配器传递过期状态
+    setActiveSimdLevel(SimdLevel::Scalar);
+    const std::size_t count = 2 * ManeuverRegistry::count();
+    std::vector<std::unique_ptr<FighterJet>> jets;
+    AircraftFleet fleet(count);
+    FleetManeuverStage stage;
+    for (std::size_t i = 0; i < count; ++i) {
+        ManeuverId id = static_cast<ManeuverId>(i % ManeuverRegistry::count());
+        jets.push_back(makeJet(id));
+        jets.back()->velocity.east += i;
+        fleet.addAircraft(*jets.back());
+        stage.assign(fleet, i, id);
+    }
+    for (int step = 1; step <= 200; ++step) {
+        for (auto& aircraft : jets) {
+            aircraft->updateManeuver(dt);
+            aircraft->updateKinematics(dt);
+        }
+        stage.update(fleet, dt);
+        fleet.stepKinematics(dt);
+        if (step % 10 != 0) continue;
+        const double* pitch = fleet.pitchData();
+        for (std::size_t i = 0; i < count; ++i) {
+            if (!sameAttitude(fleet.getAttitude(i), jets[i]->getAttitude()) || pitch[i] != jets[i]->getAttitude().pitch) {
+                std::cout << "✗ 槽位 " << i << "（" << ManeuverRegistry::getName(stage.getManeuver(i))
+                          << "）第 " << step << " 步姿态与逐机模型不一致" << std::endl;
+                return 1;
+            }
+        }
+    }
+    const AttitudeStats& fleetStats = fleet.getAttitudeStats();
+    if (fleetStats.avoided() == 0 || fleetStats.computed > fleetStats.requested) {
+        std::cout << "✗ 机群统计错误" << std::endl;
+        return 1;
+    }
+    stage.update(fleet, dt);
+    FleetSlotAircraft slot(fleet, 0);
+    bool staleCopied = slot.isAttitudeStale();
+    slot.push();
+    if (!staleCopied || !fleet.isAttitudeStale(0) ||
+        !sameAttitude(slot.getAttitude(), EulerAngleCalculator::calculateFromVelocity(slot.velocity))) {
+        std::cout << "✗ 槽位适配器未传递姿态过期状态" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 机群按需姿态与逐机一致：计算 " << fleetStats.computed << " 次，省去 " << fleetStats.avoided()
+              << " 次" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include <iostream>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "AircraftModelLibrary.h"
+#include "AircraftFleet.h"
+#include "FighterJet.h"
+#include "LocalTangentFrame.h"
+
+namespace {
+
+// 原 Aircraft::getLocalNUEPosition 的逐次计算（每次重算参考点ECEF与三角函数）
+Vector3 legacyLocalNUE(const GeoPosition& position, const GeoPosition& reference) {
+    const double PI = 3.14159265358979323846;
+    const double a = 6378137.0;
+    const double e2 = 0.006694379990141316;
+
+    double lat = position.latitude * PI / 180.0;
+    double lon = position.longitude * PI / 180.0;
+    double N = a / sqrt(1 - e2 * sin(lat) * sin(lat));
+    Vector3 ecef;
+    ecef.north = (N + position.altitude) * cos(lat) * cos(lon);
+    ecef.up = (N + position.altitude) * cos(lat) * sin(lon);
+    ecef.east = (N * (1 - e2) + position.altitude) * sin(lat);
+
+    double refLat = reference.latitude * PI / 180.0;
+    double refLon = reference.longitude * PI / 180.0;
+    double refN = a / sqrt(1 - e2 * sin(refLat) * sin(refLat));
+    Vector3 rel;
+    rel.north = ecef.north - (refN + reference.altitude) * cos(refLat) * cos(refLon);
+    rel.up = ecef.up - (refN + reference.altitude) * cos(refLat) * sin(refLon);
+    rel.east = ecef.east - (refN * (1 - e2) + reference.altitude) * sin(refLat);
+
+    double sinLat = sin(refLat), cosLat = cos(refLat);
+    double sinLon = sin(refLon), cosLon = cos(refLon);
+    Vector3 nue;
+    nue.north = -sinLat * cosLon * rel.north - sinLat * sinLon * rel.up + cosLat * rel.east;
+    nue.up = cosLat * cosLon * rel.north + cosLat * sinLon * rel.up + sinLat * rel.east;
+    nue.east = -sinLon * rel.north + cosLon * rel.up;
+    return nue;
+}
+
+bool sameVector(const Vector3& a, const Vector3& b, double tol) {
+    return std::abs(a.north - b.north) <= tol && std::abs(a.up - b.up) <= tol &&
+           std::abs(a.east - b.east) <= tol;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== 当地切平面坐标系测试 ===" << std::endl;
+
+    GeoPosition site = { 116.4074, 39.9042, 50.0 };
+    std::vector<GeoPosition> tracks;
+    for (int i = 0; i < 1001; ++i) {
+        tracks.push_back({ 116.4074 + 0.003 * (i % 97) - 0.15, 39.9042 + 0.002 * (i % 89) - 0.09,
+                           300.0 + 12.0 * i });
+    }
+
+    // 测试1：单点投影与原逐次计算逐位一致
+    auto frame = std::make_shared<const LocalTangentFrame>(site);
+    for (const GeoPosition& p : tracks) {
+        if (!sameVector(frame->toNUE(p), legacyLocalNUE(p, site), 0.0)) {
+            std::cout << "✗ 单点投影与原实现不一致" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "✓ 单点投影与原实现逐位一致" << std::endl;
+
+    // 测试2：多架飞机共享同一坐标系，结果与各自设置参考位置相同
+    FighterJet shared("F-15");
+    FighterJet own("F-15");
+    shared.setReferenceFrame(frame);
+    own.setReferencePosition(site);
+    shared.position = own.position = tracks[500];
+    if (shared.getReferenceFrame() != frame ||
+        !sameVector(shared.getLocalNUEPosition(), own.getLocalNUEPosition(), 0.0) ||
+        shared.getDistanceFromReference() != own.getDistanceFromReference() ||
+        shared.getBearingFromReference() != own.getBearingFromReference()) {
+        std::cout << "✗ 共享坐标系结果不一致" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 共享坐标系与独立参考位置结果一致" << std::endl;
+
+    // 测试3：批量投影（数组与机群）与单点投影一致（批量ECEF由SIMD内核计算）
+    std::vector<Vector3> batch(tracks.size());
+    frame->toNUE(tracks.data(), tracks.size(), batch.data());
+    AircraftFleet fleet(tracks.size());
+    for (const GeoPosition& p : tracks) {
+        fleet.addAircraft(p, { 0.0, 0.0, 0.0 });
+    }
+    std::vector<Vector3> fleetNUE(fleet.size());
+    frame->toNUE(fleet, fleetNUE.data());
+    for (std::size_t i = 0; i < tracks.size(); ++i) {
+        Vector3 expected = frame->toNUE(tracks[i]);
+        if (!sameVector(batch[i], expected, 1e-8) || !sameVector(fleetNUE[i], expected, 1e-8)) {
+            std::cout << "✗ 批量投影第 " << i << " 个点超出容差" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "✓ 批量投影与单点投影一致" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,175 @@
+#include <iostream>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "FighterJet.h"
+#include "ManeuverModel.h"
+#include "ManeuverRegistry.h"
+
+// 统计全局内存分配次数，用于检查原位构造不分配内存
+static std::atomic<std::size_t> allocationCount(0);
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+struct ExpectedDefaults {
+    const char* name;
+    const char* modelName;
+    ManeuverDefaults defaults;
+};
+
+// 原 getDefaultParameters / createManeuverModel 字符串分支的取值
+const ExpectedDefaults EXPECTED[] = {
+    { "s",               "General S Maneuver",               { 0.6,  0.0, 0.5, 0.3,  4.0, 1.0, 0.0 } },
+    { "S",               "General S Maneuver",               { 0.6,  0.0, 0.5, 0.3,  4.0, 1.0, 0.0 } },
+    { "s_advanced",      "General S Maneuver",               { 0.5,  0.3, 0.5, 0.3,  6.0, 1.0, 3.0 } },
+    { "advanced_s",      "General S Maneuver",               { 0.5,  0.3, 0.5, 0.3,  6.0, 1.0, 3.0 } },
+    { "snake",           "General S Maneuver",               { 0.8,  0.0, 0.5, 0.3,  2.0, 0.8, 0.0 } },
+    { "loop",            nullptr,                            { 0.0,  0.8, 0.5, 0.3, 10.0, 1.0, 5.0 } },
+    { "roll",            nullptr,                            { 0.0,  0.0, 0.8, 0.3,  2.0, 1.0, 0.0 } },
+    { "split_s",         nullptr,                            { 0.7,  0.6, 0.5, 0.3,  8.0, 1.0, 4.0 } },
+    { "immelmann",       nullptr,                            { 0.0,  0.7, 0.8, 0.6,  6.0, 1.0, 3.0 } },
+    { "barrel_roll",     nullptr,                            { 0.0,  0.0, 0.9, 0.4,  4.0, 1.0, 0.0 } },
+    { "evasive_dive",    nullptr,                            { 0.8, -0.9, 0.5, 0.3,  6.0, 1.0, 3.0 } },
+    { "l_maneuver",      nullptr,                            { 0.9,  0.0, 0.5, 0.3,  4.0, 1.0, 0.0 } },
+    { "constant",        "Constant Speed & Altitude Flight", { 0.0,  0.0, 0.0, 0.0,  0.0, 0.0, 0.0 } },
+    { "constant_flight", "Constant Speed & Altitude Flight", { 0.0,  0.0, 0.0, 0.0,  0.0, 0.0, 0.0 } },
+};
+
+bool sameParameters(const ManeuverParameters& p, const ManeuverDefaults& d) {
+    return p.turnRate == d.turnRate && p.climbRate == d.climbRate && p.rollRate == d.rollRate &&
+           p.pitchRate == d.pitchRate && p.period == d.period && p.amplitude == d.amplitude &&
+           p.altitudePeriod == d.altitudePeriod;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== 编译期机动注册表测试 ===" << std::endl;
+
+    // 测试1：所有名称与别名的默认参数、模型类型与原工厂一致；未知名称返回兜底参数并在创建时抛出异常
+    for (const ExpectedDefaults& e : EXPECTED) {
+        ManeuverId id = ManeuverRegistry::find(e.name);
+        if (!ManeuverRegistry::isValid(id) || !sameParameters(ManeuverModelFactory::getDefaultParameters(e.name), e.defaults)) {
+            std::cout << "✗ " << e.name << " 默认参数不一致" << std::endl;
+            return 1;
+        }
+        std::shared_ptr<ManeuverModel> model = ManeuverModelFactory::createManeuverModel(e.name);
+        if (e.modelName && model->getName() != e.modelName) {
+            std::cout << "✗ " << e.name << " 模型类型错误：" << model->getName() << std::endl;
+            return 1;
+        }
+    }
+    bool caught = false;
+    try {
+        ManeuverModelFactory::createManeuverModel("unknown");
+    }
+    catch (const std::invalid_argument&) {
+        caught = true;
+    }
+    ManeuverParameters fallback = ManeuverModelFactory::getDefaultParameters("unknown");
+    if (!caught || ManeuverRegistry::find("") != ManeuverId::Count || ManeuverRegistry::find("Loop") != ManeuverId::Count ||
+        fallback.turnRate != 0.5 || fallback.climbRate != 0.2 || fallback.altitudePeriod != 3.0) {
+        std::cout << "✗ 未知名称处理错误" << std::endl;
+        return 1;
+    }
+    static_assert(ManeuverRegistry::find("barrel_roll") == ManeuverId::BarrelRoll, "compile-time lookup");
+    static_assert(ManeuverRegistry::getDefaults(ManeuverId::Loop).period == 10.0, "compile-time defaults");
+    std::cout << "✓ " << sizeof(EXPECTED) / sizeof(EXPECTED[0]) << " 个名称的默认参数与模型类型与原工厂一致" << std::endl;
+
+    // 测试2：原位构造与切换不分配堆内存，机动轨迹与工厂创建的模型逐位一致
+    FighterJet reference("F-15");
+    FighterJet inPlace("F-15");
+    reference.position = inPlace.position = { 116.4074, 39.9042, 1000.0 };
+    reference.velocity = inPlace.velocity = { 200.0, 0.0, 0.0 };
+    ManeuverSlot slot;
+    std::size_t allocations = 0;
+    for (std::size_t i = 0; i < ManeuverRegistry::count(); ++i) {
+        ManeuverId id = static_cast<ManeuverId>(i);
+        ManeuverParameters params = ManeuverRegistry::getDefaults(id).toParameters();
+        std::shared_ptr<ManeuverModel> heap = ManeuverRegistry::create(id);
+        heap->initialize(params);
+
+        std::size_t before = allocationCount.load();
+        ManeuverModel* model = slot.emplace(id);
+        model->initialize(params);
+        for (int step = 0; step < 200; ++step) {
+            model->update(inPlace, 0.01);
+        }
+        allocations += allocationCount.load() - before;
+
+        for (int step = 0; step < 200; ++step) {
+            heap->update(reference, 0.01);
+        }
+        if (slot.getId() != id || inPlace.velocity.north != reference.velocity.north ||
+            inPlace.velocity.up != reference.velocity.up || inPlace.velocity.east != reference.velocity.east ||
+            inPlace.position.latitude != reference.position.latitude) {
+            std::cout << "✗ " << ManeuverRegistry::getName(id) << " 原位构造模型结果不一致" << std::endl;
+            return 1;
+        }
+    }
+    if (allocations != 0) {
+        std::cout << "✗ 原位构造期间发生 " << allocations << " 次堆分配" << std::endl;
+        return 1;
+    }
+    std::shared_ptr<ManeuverModel> shared = slot.share();
+    if (shared.get() != slot.get() || shared.use_count() != 0) {
+        std::cout << "✗ share() 应返回不持有所有权的指针" << std::endl;
+        return 1;
+    }
+    alignas(ManeuverRegistry::STORAGE_ALIGNMENT) unsigned char tooSmall[8];
+    caught = false;
+    try {
+        ManeuverRegistry::construct(ManeuverId::Loop, tooSmall, sizeof(tooSmall));
+    }
+    catch (const std::invalid_argument&) {
+        caught = true;
+    }
+    if (!caught) {
+        std::cout << "✗ 存储不足未抛出异常" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 原位构造与切换零分配，结果与堆上模型逐位一致" << std::endl;
+
+    // 测试3：多线程并发查询
+    std::atomic<int> mismatches(0);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&] {
+            for (int i = 0; i < 100000; ++i) {
+                const ExpectedDefaults& e = EXPECTED[i % (sizeof(EXPECTED) / sizeof(EXPECTED[0]))];
+                ManeuverDefaults d = ManeuverRegistry::getDefaults(ManeuverRegistry::find(e.name));
+                if (d.turnRate != e.defaults.turnRate || d.period != e.defaults.period) mismatches.fetch_add(1);
+            }
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+    if (mismatches.load() != 0) {
+        std::cout << "✗ 并发查询结果错误" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 多线程并发查询结果正确" << std::endl;
+
+    // 测试4：传统 setManeuver 接口通过注册表解析内置机动名称
+    FighterJet legacy("F-15");
+    legacy.setManeuver("immelmann");
+    if (!sameParameters(legacy.getManeuverParameters(), ManeuverRegistry::getDefaults(ManeuverId::Immelmann))) {
+        std::cout << "✗ setManeuver 未加载内置机动" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ setManeuver 解析内置机动名称" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,124 @@
+#include <iostream>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "ManeuverSweep.h"
+
+// 统计全局内存分配次数，用于检查仿真步内不分配内存
+static std::atomic<std::size_t> allocationCount(0);
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+bool sameResult(const SweepRunResult& a, const SweepRunResult& b) {
+    return a.runIndex == b.runIndex && a.parameters.turnRate == b.parameters.turnRate &&
+           a.parameters.period == b.parameters.period && a.initialSpeed == b.initialSpeed &&
+           a.initialHeading == b.initialHeading && a.finalDisplacement == b.finalDisplacement &&
+           a.finalAltitudeChange == b.finalAltitudeChange && a.minAltitude == b.minAltitude &&
+           a.maxAltitude == b.maxAltitude && a.peakTurnRate == b.peakTurnRate &&
+           a.peakClimbRate == b.peakClimbRate && a.finalSpeed == b.finalSpeed;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== 机动参数蒙特卡洛扫描测试 ===" << std::endl;
+
+    ManeuverSweepConfig config("s");
+    config.turnRate = SweepDistribution::uniform(0.2, 0.8);
+    config.period = SweepDistribution::uniform(2.0, 8.0);
+    config.amplitude = SweepDistribution::normal(1.0, 0.1);
+    config.speed = SweepDistribution::normal(220.0, 15.0);
+    config.heading = SweepDistribution::uniform(0.0, 360.0);
+    config.altitudeOffset = SweepDistribution::uniform(-200.0, 200.0);
+    config.runs = 257;
+    config.steps = 400;
+    config.dt = 0.02;
+    config.seed = 42;
+    ManeuverSweep sweep(config);
+
+    // 测试1：结果与线程数无关，且与单次运行一致
+    std::vector<SweepRunResult> serial = sweep.run(1);
+    std::vector<SweepRunResult> parallel = sweep.run(4);
+    for (std::size_t i = 0; i < serial.size(); ++i) {
+        if (!sameResult(serial[i], parallel[i]) || !sameResult(serial[i], sweep.runSingle(i))) {
+            std::cout << "✗ 第 " << i << " 次运行结果与线程数有关" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "✓ 1/4线程及单次运行结果逐位一致" << std::endl;
+
+    // 测试2：采样落在分布范围内，固定参数保持不变，指标合理
+    ManeuverParameters defaults = ManeuverModelFactory::getDefaultParameters("s");
+    for (const SweepRunResult& r : serial) {
+        if (r.parameters.turnRate < 0.2 || r.parameters.turnRate >= 0.8 ||
+            r.parameters.period < 2.0 || r.parameters.period >= 8.0 ||
+            r.parameters.climbRate != defaults.climbRate ||
+            r.minAltitude > r.maxAltitude || r.finalDisplacement <= 0.0 || r.peakTurnRate <= 0.0) {
+            std::cout << "✗ 第 " << r.runIndex << " 次运行采样或指标异常" << std::endl;
+            return 1;
+        }
+    }
+    if (serial[0].parameters.turnRate == serial[1].parameters.turnRate) {
+        std::cout << "✗ 不同运行的采样相同" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 采样范围与汇总指标正确" << std::endl;
+
+    // 测试3：分配次数与步数无关（仿真步内不分配内存）
+    ManeuverSweepConfig shortConfig = config;
+    shortConfig.steps = 10;
+    ManeuverSweepConfig longConfig = config;
+    longConfig.steps = 5000;
+    ManeuverSweep shortSweep(shortConfig);
+    ManeuverSweep longSweep(longConfig);
+    std::size_t before = allocationCount.load();
+    shortSweep.runSingle(3);
+    std::size_t shortAllocations = allocationCount.load() - before;
+    before = allocationCount.load();
+    longSweep.runSingle(3);
+    std::size_t longAllocations = allocationCount.load() - before;
+    if (shortAllocations != longAllocations) {
+        std::cout << "✗ 仿真步内发生内存分配（" << shortAllocations << " vs " << longAllocations << "）" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 仿真步内无内存分配（每次运行 " << shortAllocations << " 次）" << std::endl;
+
+    // 测试4：CSV表格行数、非法配置
+    std::ostringstream csv;
+    ManeuverSweep::writeCsv(csv, serial);
+    std::size_t lines = 0;
+    for (char c : csv.str()) lines += (c == '\n');
+    if (lines != serial.size() + 1) {
+        std::cout << "✗ CSV行数错误" << std::endl;
+        return 1;
+    }
+    bool caught = false;
+    try {
+        ManeuverSweepConfig bad = config;
+        bad.period = SweepDistribution::uniform(5.0, 1.0);
+        ManeuverSweep badSweep(bad);
+    }
+    catch (const std::invalid_argument&) {
+        caught = true;
+    }
+    if (!caught) {
+        std::cout << "✗ 非法分布未抛出异常" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ CSV输出与参数检查正确" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,118 @@
+#include <iostream>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "FighterJet.h"
+#include "ManeuverModel.h"
+#include "ManeuverTemplate.h"
+
+namespace {
+
+bool samePoint(const ManeuverPoint& a, const ManeuverPoint& b) {
+    return a.turnRate == b.turnRate && a.climbRate == b.climbRate && a.rollRate == b.rollRate &&
+           a.pitchRate == b.pitchRate && a.yawRate == b.yawRate;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== 机动模板测试 ===" << std::endl;
+
+    // 测试1：线性插值、首末点外的取值、时长与完成判断
+    ManeuverTemplate simple("simple", { ManeuverPoint(1.0, 0.0, 0.0), ManeuverPoint(3.0, 1.0, -0.5, 0.2, 0.4, 0.6) });
+    ManeuverPoint mid = simple.evaluate(2.0);
+    ManeuverParameters params = simple.interpolateParameters(2.5);
+    if (mid.turnRate != 0.5 || mid.climbRate != -0.25 || std::abs(mid.yawRate - 0.3) > 1e-15 ||
+        !samePoint(simple.evaluate(0.0), simple.getPoints().front()) ||
+        !samePoint(simple.evaluate(10.0), simple.getPoints().back()) ||
+        params.turnRate != 0.75 || params.period != 2.0 || simple.getDuration() != 2.0 ||
+        simple.isCompleted(2.9) || !simple.isCompleted(3.0)) {
+        std::cout << "✗ 插值结果错误" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 线性插值与边界取值正确" << std::endl;
+
+    // 测试2：长模板上游标求值与二分查找结果逐位一致（顺序前进、大步跳转、回退）
+    std::vector<ManeuverPoint> points;
+    for (int i = 0; i < 5000; ++i) {
+        double t = 0.1 * i + ((i % 7 == 0) ? 0.0 : 0.03);
+        points.emplace_back(t, std::sin(0.01 * i), std::cos(0.02 * i), 0.001 * i, -0.5, 0.1);
+        if (i % 500 == 0) {
+            points.emplace_back(t, 0.0, 0.0);   // 同一时刻的阶跃
+        }
+    }
+    ManeuverTemplate script("script", points);
+    ManeuverTemplate::Cursor cursor;
+    int mismatches = 0;
+    for (double t = -1.0; t < script.getPoints().back().time + 1.0; t += 0.013) {
+        if (!samePoint(script.evaluate(t, cursor), script.evaluate(t))) ++mismatches;
+    }
+    const double jumps[] = { 3.0, 250.0, 10.0, 499.9, 0.5, 123.456, 123.456, 123.5, -5.0, 1000.0 };
+    for (double t : jumps) {
+        if (!samePoint(script.evaluate(t, cursor), script.evaluate(t))) ++mismatches;
+    }
+    if (mismatches != 0) {
+        std::cout << "✗ 游标求值与二分查找有 " << mismatches << " 处不一致" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 游标求值与二分查找结果逐位一致（" << points.size() << " 个机动点）" << std::endl;
+
+    // 测试3：模板管理器预置模板、注册与查找
+    const char* builtins[] = { "loop", "roll", "s", "snake", "cobra", "scissors", "barrel_roll",
+                               "high_g_turn", "vertical_climb", "dive_attack" };
+    for (const char* name : builtins) {
+        if (ManeuverTemplateManager::getTemplate(name).getName() != name) {
+            std::cout << "✗ 缺少预置模板 " << name << std::endl;
+            return 1;
+        }
+    }
+    ManeuverTemplateManager::registerTemplate(script);
+    bool caught = false;
+    try {
+        ManeuverTemplateManager::getTemplate("missing");
+    }
+    catch (const std::invalid_argument&) {
+        caught = true;
+    }
+    try {
+        ManeuverTemplate invalid("invalid", { ManeuverPoint(1.0, 0.0, 0.0), ManeuverPoint(0.5, 0.0, 0.0) });
+        caught = false;
+    }
+    catch (const std::invalid_argument&) {
+    }
+    if (!caught || ManeuverTemplateManager::getAvailableTemplates().size() != 11) {
+        std::cout << "✗ 模板注册或参数检查错误" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 预置模板、注册与参数检查正确" << std::endl;
+
+    // 测试4：模板驱动飞机：高G转弯改变航向，眼镜蛇保持航向，结束后保持末点
+    auto runTemplate = [](const std::string& name, double seconds, bool& completed) {
+        FighterJet aircraft("F-15");
+        aircraft.position = { 116.4074, 39.9042, 3000.0 };
+        aircraft.velocity = { 200.0, 0.0, 0.0 };
+        auto model = ManeuverTemplateManager::createManeuverModel(name);
+        aircraft.setManeuverModel(model);
+        aircraft.initializeManeuver(ManeuverParameters());
+        for (double t = 0.0; t < seconds; t += 0.01) {
+            aircraft.updateManeuver(0.01);
+            aircraft.updateKinematics(0.01);
+        }
+        completed = std::static_pointer_cast<TemplateManeuverModel>(model)->isCompleted();
+        return std::atan2(aircraft.velocity.east, aircraft.velocity.north);
+    };
+    bool turnCompleted = false;
+    bool cobraCompleted = false;
+    double turnHeading = runTemplate("high_g_turn", 9.0, turnCompleted);
+    double cobraHeading = runTemplate("cobra", 4.0, cobraCompleted);
+    if (!turnCompleted || !cobraCompleted || std::abs(turnHeading) < 0.5 || std::abs(cobraHeading) > 1e-12) {
+        std::cout << "✗ 模板驱动结果错误（高G转弯航向 " << turnHeading << "，眼镜蛇航向 " << cobraHeading << "）" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 模板驱动飞机机动正确（高G转弯航向变化 " << turnHeading << " rad）" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,161 @@
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include "AircraftModelLibrary.h"
+#include "AircraftModule.h"
+#include "FighterJet.h"
+#include "ModuleRegistry.h"
+
+namespace {
+
+// 燃油模块：按消耗率扣减燃油，并把高度当作"已运行时间"累加，用于核对调用的飞机是否正确
+class FuelModule : public AircraftModule {
+public:
+    FuelModule(int tag, double burnRate) : tag(tag), burnRate(burnRate) {}
+    std::string getModuleName() const override { return "Fuel"; }
+    void update(Aircraft& aircraft, double dt) override {
+        fuel -= burnRate * dt;
+        aircraft.position.altitude += dt;
+    }
+    int tag;
+    double burnRate;
+    double fuel = 1000.0;
+};
+
+// 传感器模块：每次更新计数，记录最后一次更新的飞机
+class SensorModule : public AircraftModule {
+public:
+    std::string getModuleName() const override { return "Sensor"; }
+    void update(Aircraft& aircraft, double) override {
+        ++scans;
+        lastAircraft = &aircraft;
+    }
+    int scans = 0;
+    const Aircraft* lastAircraft = nullptr;
+};
+
+// 纯数据组件（不是 AircraftModule），由自定义系统更新
+struct HeatSignature {
+    double value;
+};
+
+std::vector<std::unique_ptr<Aircraft>> makeAircraft(std::size_t count) {
+    std::vector<std::unique_ptr<Aircraft>> list;
+    for (std::size_t i = 0; i < count; ++i) {
+        list.push_back(std::make_unique<FighterJet>("F-15"));
+        list.back()->position = { 116.0, 39.0, 0.0 };
+    }
+    return list;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== 模块实体-组件存储测试 ===" << std::endl;
+    const std::size_t count = 90;
+
+    // 测试1：按类型O(1)访问，未添加的类型返回空
+    auto fleet = makeAircraft(count);
+    ModuleRegistry registry;
+    std::vector<EntityId> ids;
+    for (std::size_t i = 0; i < count; ++i) {
+        EntityId id = registry.createEntity(*fleet[i]);
+        ids.push_back(id);
+        if (i % 2 == 0) registry.addModule<FuelModule>(id, static_cast<int>(i), 1.0 + i);
+        if (i % 3 == 0) registry.addModule<JammerModule>(id).activateJamming();
+    }
+    bool accessOk = registry.entityCount() == count && registry.systemCount() == 2;
+    for (std::size_t i = 0; i < count; ++i) {
+        const FuelModule* fuel = registry.get<FuelModule>(ids[i]);
+        accessOk = accessOk && (i % 2 == 0 ? fuel && fuel->tag == static_cast<int>(i) : fuel == nullptr);
+        accessOk = accessOk && registry.has<JammerModule>(ids[i]) == (i % 3 == 0) && !registry.has<SensorModule>(ids[i]);
+        accessOk = accessOk && &registry.getAircraft(ids[i]) == fleet[i].get();
+    }
+    if (!accessOk || !registry.get<JammerModule>(ids[0])->isJamming()) {
+        std::cout << "✗ 类型化访问结果错误" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 按类型访问 " << count << " 个实体的组件正确" << std::endl;
+
+    // 测试2：按类型系统更新与逐机 updateModules 结果一致
+    auto legacyFleet = makeAircraft(count);
+    std::vector<std::shared_ptr<FuelModule>> legacyFuel(count);
+    for (std::size_t i = 0; i < count; i += 2) {
+        legacyFuel[i] = std::make_shared<FuelModule>(static_cast<int>(i), 1.0 + i);
+        legacyFleet[i]->addModule(legacyFuel[i]);
+    }
+    for (int step = 0; step < 50; ++step) {
+        registry.update(0.1);
+        for (auto& a : legacyFleet) a->updateModules(0.1);
+    }
+    for (std::size_t i = 0; i < count; i += 2) {
+        if (registry.get<FuelModule>(ids[i])->fuel != legacyFuel[i]->fuel ||
+            fleet[i]->position.altitude != legacyFleet[i]->position.altitude || fleet[i + 1]->position.altitude != 0.0) {
+            std::cout << "✗ 实体 " << i << " 的系统更新结果与 updateModules 不一致" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "✓ 按类型系统更新与逐机 updateModules 逐位一致" << std::endl;
+
+    // 测试3：删除组件后其余实体的访问仍正确；销毁实体删除全部组件并复用编号
+    for (std::size_t i = 0; i < count; i += 4) registry.remove<FuelModule>(ids[i]);
+    registry.destroyEntity(ids[6]);
+    bool removeOk = registry.pool<FuelModule>().size() == count / 2 - (count + 3) / 4 - 1 && !registry.isAlive(ids[6]);
+    for (std::size_t i = 0; i < count; i += 2) {
+        const FuelModule* fuel = registry.get<FuelModule>(ids[i]);
+        bool expected = i % 4 != 0 && i != 6;
+        removeOk = removeOk && (expected ? fuel && fuel->tag == static_cast<int>(i) : fuel == nullptr);
+    }
+    EntityId reused = registry.createEntity(*fleet[6]);
+    removeOk = removeOk && reused == ids[6] && !registry.has<JammerModule>(reused) && !registry.has<FuelModule>(reused);
+    if (!removeOk) {
+        std::cout << "✗ 删除组件或销毁实体后访问错误" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 删除组件、销毁并复用实体后访问正确" << std::endl;
+
+    // 测试4：纯数据组件由自定义系统在连续循环中更新
+    for (std::size_t i = 0; i < count; i += 5) registry.add<HeatSignature>(ids[i], HeatSignature{ static_cast<double>(i) });
+    registry.addSystem<HeatSignature>([](Aircraft&, HeatSignature& heat, double dt) { heat.value += dt; });
+    registry.update(0.5);
+    if (registry.get<HeatSignature>(ids[5])->value != 5.5 || registry.has<HeatSignature>(ids[6]) ||
+        registry.systemCount() != 3) {
+        std::cout << "✗ 自定义系统更新错误" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 自定义系统更新纯数据组件" << std::endl;
+
+    // 测试5：兼容路径，飞机上已挂载的 shared_ptr 模块接入注册表后由同一 update 驱动
+    auto adopted = makeAircraft(2);
+    auto sensor = std::make_shared<SensorModule>();
+    auto fuel = std::make_shared<FuelModule>(0, 2.0);
+    adopted[0]->addModule(sensor);
+    adopted[0]->addModule(fuel);
+    ModuleRegistry compat;
+    EntityId a0 = compat.createEntity(*adopted[0]);
+    EntityId a1 = compat.createEntity(*adopted[1]);
+    std::size_t adoptedCount = compat.adoptModules(a0) + compat.adoptModules(a0) + compat.adoptModules(a1);
+    compat.update(0.25);
+    if (adoptedCount != 4 || sensor->scans != 1 || sensor->lastAircraft != adopted[0].get() || fuel->fuel != 999.5 ||
+        compat.has<LegacyModuleList>(a1)) {
+        std::cout << "✗ 兼容路径接入的模块更新错误" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ shared_ptr 模块经兼容路径接入并更新" << std::endl;
+
+    // 测试6：非法操作
+    int caught = 0;
+    try { registry.addModule<FuelModule>(ids[2], 0, 1.0); } catch (const std::invalid_argument&) { ++caught; }
+    try { registry.add<HeatSignature>(static_cast<EntityId>(count + 10)); } catch (const std::invalid_argument&) { ++caught; }
+    try { registry.getAircraft(static_cast<EntityId>(count)); } catch (const std::invalid_argument&) { ++caught; }
+    try { compat.destroyEntity(7); } catch (const std::invalid_argument&) { ++caught; }
+    if (caught != 4 || registry.remove<SensorModule>(ids[0])) {
+        std::cout << "✗ 非法操作只捕获 " << caught << " 个" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 重复添加、无效实体抛出 std::invalid_argument" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,151 @@
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include "AircraftModelLibrary.h"
+#include "AircraftModule.h"
+#include "FighterJet.h"
+#include "ManeuverModel.h"
+#include "MultiRateScheduler.h"
+
+namespace {
+
+// 记录每次调用的时刻与步长
+class CountingModule : public AircraftModule {
+public:
+    std::string getModuleName() const override { return "counter"; }
+    void update(Aircraft&, double dt) override { steps.push_back(dt); }
+    std::vector<double> steps;
+};
+
+struct Call {
+    int stage;
+    std::uint64_t tick;
+    double time;
+    double dt;
+};
+
+std::unique_ptr<Aircraft> makeAircraft() {
+    auto aircraft = std::make_unique<FighterJet>("F-15");
+    aircraft->position = { 116.4, 39.9, 3000.0 };
+    aircraft->velocity = { 200.0, 0.0, 0.0 };
+    aircraft->setManeuverModel(ManeuverModelFactory::createManeuverModel("s"));
+    ManeuverParameters params;
+    params.turnRate = 0.3;
+    params.period = 4.0;
+    params.amplitude = 1.0;
+    aircraft->initializeManeuver(params);
+    return aircraft;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== 多速率调度器测试 ===" << std::endl;
+
+    // 测试1：各阶段按频率与相位在正确节拍运行，同一节拍内按注册顺序执行，时刻与步长精确
+    MultiRateScheduler scheduler(100.0);
+    std::vector<Call> calls;
+    auto recorder = [&](int stage) {
+        return [&calls, &scheduler, stage](double time, double dt) { calls.push_back({ stage, scheduler.getTick(), time, dt }); };
+    };
+    scheduler.addStage("fast", 100.0, 0, recorder(0));
+    scheduler.addStage("slow", 10.0, 3, recorder(1));
+    scheduler.addStage("sensor", 5.0, 19, recorder(2));
+    scheduler.run(1000);
+    const std::uint64_t periods[] = { 1, 10, 20 };
+    const std::uint64_t phases[] = { 0, 3, 19 };
+    const double dts[] = { 0.01, 0.1, 0.2 };
+    std::uint64_t lastTick = 0;
+    int lastStage = -1;
+    for (const Call& c : calls) {
+        bool ordered = c.tick > lastTick || c.stage > lastStage || (lastStage == -1);
+        if (c.tick % periods[c.stage] != phases[c.stage] || c.time != static_cast<double>(c.tick + 1) / 100.0 ||
+            c.dt != dts[c.stage] || !ordered) {
+            std::cout << "✗ 阶段 " << c.stage << " 在节拍 " << c.tick << " 运行（时刻 " << c.time << "，步长 " << c.dt
+                      << "）" << std::endl;
+            return 1;
+        }
+        lastTick = c.tick;
+        lastStage = c.stage;
+    }
+    if (scheduler.getStats(0).runs != 1000 || scheduler.getStats(1).runs != 100 || scheduler.getStats(2).runs != 50 ||
+        scheduler.getTime() != 10.0) {
+        std::cout << "✗ 运行次数 " << scheduler.getStats(0).runs << "/" << scheduler.getStats(1).runs << "/"
+                  << scheduler.getStats(2).runs << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 100/10/5 Hz 阶段运行 1000/100/50 次，相位、顺序、时刻与步长正确" << std::endl;
+
+    // 测试2：长时间运行时刻不漂移（浮点累加 0.01 一百万次偏差约 2e-7 秒）
+    MultiRateScheduler longRun(100.0);
+    double lastTime = 0.0, accumulated = 0.0;
+    longRun.addStage("clock", 100.0, 0, [&](double time, double dt) { lastTime = time; accumulated += dt; });
+    longRun.run(1000000);
+    if (lastTime != 10000.0 || longRun.getTime() != 10000.0) {
+        std::cout << "✗ 一百万节拍后时刻为 " << lastTime << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 一百万节拍后时刻精确为 10000 秒（浮点累加步长偏差 " << accumulated - 10000.0 << " 秒）" << std::endl;
+
+    // 测试3：所有阶段同频时与原仿真循环逐位一致；功能模块以自身频率与步长更新
+    auto expected = makeAircraft();
+    auto scheduled = makeAircraft();
+    auto module = std::make_shared<CountingModule>();
+    scheduled->addModule(module);
+    for (int i = 0; i < 200; ++i) {
+        expected->updateManeuver(0.1);
+        expected->updateKinematics(0.1);
+    }
+    MultiRateScheduler sameRate(10.0);
+    std::size_t moduleStage = sameRate.addModule(*scheduled, module, 2.0, 1);
+    sameRate.addStage("maneuver", 10.0, 0, [&](double, double dt) { scheduled->updateManeuver(dt); });
+    sameRate.addStage("kinematics", 10.0, 0, [&](double, double dt) { scheduled->updateKinematics(dt); });
+    sameRate.run(200);
+    if (scheduled->position.latitude != expected->position.latitude ||
+        scheduled->position.longitude != expected->position.longitude ||
+        scheduled->position.altitude != expected->position.altitude || module->steps.size() != 40 ||
+        module->steps[0] != 0.5 || sameRate.getStats(moduleStage).name != "counter") {
+        std::cout << "✗ 调度结果与原仿真循环不一致或模块调用错误（模块 " << module->steps.size() << " 次）" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 同频调度与原仿真循环逐位一致，2Hz 模块运行 40 次，步长 0.5 秒" << std::endl;
+
+    // 测试4：运行中途注册的阶段从下一个满足相位的节拍开始；统计清零与报告
+    MultiRateScheduler late(10.0);
+    late.run(7);
+    std::vector<std::uint64_t> lateTicks;
+    late.addStage("late", 2.0, 3, [&](double, double) { lateTicks.push_back(late.getTick()); });
+    late.run(10);
+    std::ostringstream report;
+    late.printReport(report);
+    bool lateOk = lateTicks.size() == 2 && lateTicks[0] == 8 && lateTicks[1] == 13 &&
+                  report.str().find("late") != std::string::npos;
+    late.resetStats();
+    if (!lateOk || late.getStats(0).runs != 0 || late.getStats(0).totalSeconds != 0.0) {
+        std::cout << "✗ 中途注册的阶段或统计清零错误" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 中途注册阶段按相位开始，统计清零与报告正常" << std::endl;
+
+    // 测试5：非法参数
+    int caught = 0;
+    auto noop = [](double, double) {};
+    try { MultiRateScheduler bad(0.0); } catch (const std::invalid_argument&) { ++caught; }
+    try { scheduler.addStage("odd", 3.0, 0, noop); } catch (const std::invalid_argument&) { ++caught; }
+    try { scheduler.addStage("faster", 200.0, 0, noop); } catch (const std::invalid_argument&) { ++caught; }
+    try { scheduler.addStage("zero", 0.0, 0, noop); } catch (const std::invalid_argument&) { ++caught; }
+    try { scheduler.addStage("phase", 10.0, 10, noop); } catch (const std::invalid_argument&) { ++caught; }
+    try { scheduler.addStage("empty", 10.0, 0, nullptr); } catch (const std::invalid_argument&) { ++caught; }
+    try { scheduler.addModule(*scheduled, nullptr, 10.0); } catch (const std::invalid_argument&) { ++caught; }
+    try { scheduler.getStats(3); } catch (const std::invalid_argument&) { ++caught; }
+    if (caught != 8 || scheduler.stageCount() != 3) {
+        std::cout << "✗ 非法参数只捕获 " << caught << " 个" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 非法参数抛出 std::invalid_argument" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
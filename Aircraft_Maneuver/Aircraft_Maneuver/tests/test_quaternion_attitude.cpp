@@ -0,0 +1,174 @@
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "AircraftModelLibrary.h"
+#include "EulerAngleCalculation.h"
+#include "FighterJet.h"
+#include "ManeuverRegistry.h"
+#include "SimdKernels.h"
+#include "SimdSupport.h"
+
+namespace {
+
+double distance(const Vector3& a, const Vector3& b) {
+    return std::sqrt((a.north - b.north) * (a.north - b.north) + (a.up - b.up) * (a.up - b.up) +
+                     (a.east - b.east) * (a.east - b.east));
+}
+
+double quaternionDistance(const Quaternion& a, const Quaternion& b) {
+    // q 与 -q 表示同一旋转
+    double dot = std::abs(a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z);
+    return 1.0 - std::min(1.0, dot);
+}
+
+std::unique_ptr<FighterJet> makeJet(ManeuverId id) {
+    auto jet = std::make_unique<FighterJet>("F-15");
+    jet->position = { 116.0, 39.0, 3000.0 };
+    jet->velocity = { 0.0, 0.0, 250.0 };
+    jet->setManeuverModel(ManeuverRegistry::create(id));
+    jet->initializeManeuver(ManeuverRegistry::getDefaults(id).toParameters());
+    jet->invalidateAttitude();          // 初始姿态随速度（向东平飞），启用四元数后读取时换算
+    jet->setQuaternionAttitude(true);
+    return jet;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== 四元数姿态测试 ===" << std::endl;
+
+    // 测试1：欧拉角 -> 四元数 -> 欧拉角往返；方向余弦矩阵的机体前轴与速度方向一致
+    double worstRoundTrip = 0.0;
+    for (int i = 0; i < 2000; ++i) {
+        AttitudeAngles a;
+        a.roll = -3.1 + 0.0031 * i;
+        a.pitch = -1.5 + 0.0015 * i;
+        a.yaw = 3.1 - 0.0031 * ((i * 7) % 2000);
+        AttitudeAngles b = EulerAngleCalculator::fromQuaternion(EulerAngleCalculator::toQuaternion(a));
+        worstRoundTrip = std::max(worstRoundTrip, std::abs(a.roll - b.roll) + std::abs(a.pitch - b.pitch) +
+                                                  std::abs(a.yaw - b.yaw));
+    }
+    Vector3 velocity = { 120.0, 60.0, -200.0 };
+    double speed = std::sqrt(120.0 * 120.0 + 60.0 * 60.0 + 200.0 * 200.0);
+    Quaternion q = EulerAngleCalculator::toQuaternion(EulerAngleCalculator::calculateFromVelocity(velocity));
+    Vector3 forward = EulerAngleCalculator::toDCM(q).toNUE({ 1.0, 0.0, 0.0 });
+    Vector3 expected = { velocity.north / speed, velocity.up / speed, velocity.east / speed };
+    if (worstRoundTrip > 1e-12 || distance(forward, expected) > 1e-12) {
+        std::cout << "✗ 换算错误（往返偏差 " << worstRoundTrip << "，前轴偏差 " << distance(forward, expected) << "）" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 欧拉角往返偏差 " << worstRoundTrip << "，机体前轴与速度方向一致" << std::endl;
+
+    // 测试2：恒定机体滚转角速度4秒转一整圈后回到初始姿态且保持单位长度；
+    // 原欧拉角加减再截断的做法在滚转90°处卡住
+    FighterJet jet("F-15");
+    AttitudeAngles start;
+    start.pitch = 0.3;
+    start.yaw = 1.0;
+    jet.setAttitude(start);
+    jet.setQuaternionAttitude(true);
+    Quaternion initial = jet.getAttitudeQuaternion();
+    AttitudeAngles euler = start;
+    double maxRoll = 0.0;
+    for (int step = 0; step < 400; ++step) {
+        jet.rotateBody(M_PI / 2.0, 0.0, 0.0, 0.01);
+        maxRoll = std::max(maxRoll, std::abs(jet.getAttitude().roll));
+        euler.roll += M_PI / 2.0 * 0.01;
+        euler = EulerAngleCalculator::limitAttitudeAngles(euler);
+    }
+    Quaternion end = jet.getAttitudeQuaternion();
+    if (quaternionDistance(initial, end) > 1e-12 || std::abs(end.norm() - 1.0) > 1e-14 ||
+        maxRoll < 3.1 || std::abs(euler.roll - M_PI / 2.0) > 1e-12) {
+        std::cout << "✗ 机体角速度积分错误（偏差 " << quaternionDistance(initial, end) << "，最大滚转 "
+                  << maxRoll << "）" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 滚转一整圈回到初始姿态（偏差 " << quaternionDistance(initial, end)
+              << "），欧拉角截断做法停在 " << euler.roll * 180.0 / M_PI << "°" << std::endl;
+
+    // 测试3：四元数姿态下的 Immelmann：上仰半圈后航向反转、倒飞，再滚转半圈改平
+    auto immelmann = makeJet(ManeuverId::Immelmann);
+    const double dt = 0.01;
+    for (int step = 0; step < 2000; ++step) {
+        immelmann->updateManeuver(dt);
+    }
+    DirectionCosineMatrix dcm = immelmann->getBodyToNUE();
+    Vector3 nose = dcm.toNUE({ 1.0, 0.0, 0.0 });
+    Vector3 belly = dcm.toNUE({ 0.0, 0.0, 1.0 });
+    if (distance(nose, { 0.0, 0.0, -1.0 }) > 1e-9 || distance(belly, { 0.0, -1.0, 0.0 }) > 1e-9) {
+        std::cout << "✗ Immelmann 终态错误（机头 " << nose.north << ", " << nose.up << ", " << nose.east << "）" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 四元数 Immelmann：航向反转 180°，改平后机腹朝下" << std::endl;
+
+    // 测试4：四元数姿态下的桶滚与逐步 rotateBody 一致；默认仍为欧拉角实现
+    auto barrel = makeJet(ManeuverId::BarrelRoll);
+    FighterJet reference("F-15");
+    reference.velocity = barrel->velocity;
+    reference.invalidateAttitude();
+    reference.setQuaternionAttitude(true);
+    ManeuverParameters params = ManeuverRegistry::getDefaults(ManeuverId::BarrelRoll).toParameters();
+    double time = 0.0;
+    for (int step = 0; step < 500; ++step) {
+        barrel->updateManeuver(dt);
+        time += dt;
+        reference.rotateBody(params.getActualRollRate(reference.getPerformance()),
+                             params.getActualPitchRate(reference.getPerformance()) * std::sin(time), 0.0, dt);
+    }
+    FighterJet plain("F-15");
+    if (quaternionDistance(barrel->getAttitudeQuaternion(), reference.getAttitudeQuaternion()) > 1e-14 ||
+        plain.usesQuaternionAttitude()) {
+        std::cout << "✗ 四元数桶滚与逐步积分不一致" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 四元数桶滚与逐步机体角速度积分一致" << std::endl;
+
+    // 测试5：各SIMD级别批量换算与逐个版本一致（含不足一个向量的尾部）
+    const std::size_t n = 1003;
+    std::vector<double> w(n), x(n), y(n), z(n), pitch(n), roll(n), yaw(n);
+    std::vector<Quaternion> quaternions(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        AttitudeAngles a;
+        a.roll = std::sin(0.37 * i) * 3.0;
+        a.pitch = std::cos(0.11 * i) * 1.5;
+        a.yaw = std::sin(0.05 * i + 1.0) * 3.1;
+        quaternions[i] = EulerAngleCalculator::toQuaternion(a);
+        w[i] = quaternions[i].w;
+        x[i] = quaternions[i].x;
+        y[i] = quaternions[i].y;
+        z[i] = quaternions[i].z;
+    }
+    std::vector<DirectionCosineMatrix> matrices(n);
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::AVX2, SimdLevel::AVX512 };
+    for (SimdLevel level : levels) {
+        if (!getSimdKernels(level) || level > detectSimdLevel()) continue;
+        setActiveSimdLevel(level);
+        EulerAngleCalculator::quaternionToEulerBatch(w.data(), x.data(), y.data(), z.data(),
+                                                     pitch.data(), roll.data(), yaw.data(), n);
+        EulerAngleCalculator::quaternionToDCMBatch(w.data(), x.data(), y.data(), z.data(), matrices.data(), n);
+        double worstEuler = 0.0, worstDCM = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            AttitudeAngles e = EulerAngleCalculator::fromQuaternion(quaternions[i]);
+            worstEuler = std::max(worstEuler, std::abs(pitch[i] - e.pitch) + std::abs(roll[i] - e.roll) +
+                                              std::abs(yaw[i] - e.yaw));
+            DirectionCosineMatrix m = EulerAngleCalculator::toDCM(quaternions[i]);
+            for (int r = 0; r < 3; ++r) {
+                for (int c = 0; c < 3; ++c) {
+                    worstDCM = std::max(worstDCM, std::abs(matrices[i].m[r][c] - m.m[r][c]));
+                }
+            }
+        }
+        std::cout << getSimdLevelName(level) << ": 欧拉角最大偏差 " << worstEuler << "，矩阵最大偏差 " << worstDCM << std::endl;
+        if (worstEuler > 1e-12 || worstDCM > 1e-14) {
+            std::cout << "✗ " << getSimdLevelName(level) << " 批量换算超出容差" << std::endl;
+            return 1;
+        }
+    }
+    setActiveSimdLevel(detectSimdLevel());
+    std::cout << "✓ 批量欧拉角与方向余弦矩阵换算与逐个版本一致" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
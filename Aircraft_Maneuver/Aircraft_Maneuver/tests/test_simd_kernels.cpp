@@ -0,0 +1,146 @@
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <vector>
+#include "AircraftModelLibrary.h"
+#include "EulerAngleCalculation.h"
+#include "SimdKernels.h"
+#include "SimdMath.h"
+
+int main() {
+    std::cout << "=== SIMD内核测试 ===" << std::endl;
+    std::cout << "检测到的指令集: " << getSimdLevelName(detectSimdLevel()) << std::endl;
+
+    // 测试1：向量化初等函数精度（标量实例，与各指令集版本算法相同）
+    double maxSinErr = 0.0, maxCosErr = 0.0, maxAtanErr = 0.0;
+    for (int i = -200000; i <= 200000; ++i) {
+        double x = i * 1e-3 + 1e-7;
+        simd::VecScalar s, c;
+        simd::sincos(simd::VecScalar(x), s, c);
+        maxSinErr = std::max(maxSinErr, std::abs(s.v - std::sin(x)));
+        maxCosErr = std::max(maxCosErr, std::abs(c.v - std::cos(x)));
+        maxCosErr = std::max(maxCosErr, std::abs(simd::cos(simd::VecScalar(x * 5.0)).v - std::cos(x * 5.0)));
+        double y = std::sin(x * 0.37) * (1.0 + i % 7);
+        double z = std::cos(x * 1.31) * (1.0 + i % 5);
+        maxAtanErr = std::max(maxAtanErr, std::abs(simd::atan2(simd::VecScalar(y), simd::VecScalar(z)).v - std::atan2(y, z)));
+    }
+    std::cout << std::scientific << std::setprecision(3);
+    std::cout << "sin最大误差: " << maxSinErr << ", cos最大误差: " << maxCosErr
+              << ", atan2最大误差: " << maxAtanErr << std::endl;
+    if (maxSinErr > 5e-16 || maxCosErr > 5e-16 || maxAtanErr > 5e-16) {
+        std::cout << "✗ 初等函数精度超出说明的误差界" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 初等函数精度测试通过" << std::endl;
+
+    // 测试2：各级别批量位置积分与标量 updateGeoPosition 对比（含不足一个向量的尾部）
+    const std::size_t n = 1003;
+    const double dt = 0.1;
+    std::vector<GeoPosition> reference(n);
+    std::vector<Vector3> velocity(n);
+    std::vector<double> latitude(n), longitude(n), altitude(n), vn(n), vu(n), ve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        reference[i] = { -179.0 + 0.35 * i, -89.5 + 0.178 * i, 100.0 * i };
+        velocity[i] = { 300.0 * std::sin(0.1 * i), 20.0 * std::cos(0.3 * i), 250.0 * std::cos(0.07 * i) };
+    }
+
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::AVX2, SimdLevel::AVX512 };
+    for (SimdLevel level : levels) {
+        const SimdKernelTable* table = getSimdKernels(level);
+        if (!table || static_cast<int>(level) > static_cast<int>(detectSimdLevel())) {
+            std::cout << "- 跳过 " << getSimdLevelName(level) << "（本机或本次编译不支持）" << std::endl;
+            continue;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            latitude[i] = reference[i].latitude;
+            longitude[i] = reference[i].longitude;
+            altitude[i] = reference[i].altitude;
+            vn[i] = velocity[i].north;
+            vu[i] = velocity[i].up;
+            ve[i] = velocity[i].east;
+        }
+        table->updateGeoPosition(latitude.data(), longitude.data(), altitude.data(),
+                                 vn.data(), vu.data(), ve.data(), n, dt);
+
+        double maxDeg = 0.0, maxAlt = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            GeoPosition expected = updateGeoPosition(reference[i], velocity[i], dt);
+            maxDeg = std::max(maxDeg, std::abs(latitude[i] - expected.latitude));
+            maxDeg = std::max(maxDeg, std::abs(longitude[i] - expected.longitude));
+            maxAlt = std::max(maxAlt, std::abs(altitude[i] - expected.altitude));
+        }
+        std::cout << getSimdLevelName(level) << ": 经纬度最大偏差 " << maxDeg
+                  << " 度, 高度最大偏差 " << maxAlt << " 米" << std::endl;
+        double degTol = (level == SimdLevel::Scalar) ? 0.0 : 1e-12;
+        double altTol = (level == SimdLevel::Scalar) ? 0.0 : 1e-9;
+        if (maxDeg > degTol || maxAlt > altTol) {
+            std::cout << "✗ " << getSimdLevelName(level) << " 批量位置积分超出容差" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "✓ 批量位置积分与标量函数一致" << std::endl;
+
+    // 测试3：快速反正切误差界；各级别批量姿态角与逐个精确版本对比（含静止、正北、正南与偏航回绕边界）
+    double maxFastErr = 0.0;
+    for (int i = -200000; i <= 200000; ++i) {
+        double x = i * 1e-3 + 1e-7;
+        double y = std::sin(x * 0.37) * (1.0 + i % 7);
+        double z = std::cos(x * 1.31) * (1.0 + i % 5);
+        maxFastErr = std::max(maxFastErr, std::abs(simd::atan2Fast(simd::VecScalar(y), simd::VecScalar(z)).v - std::atan2(y, z)));
+    }
+    std::cout << "atan2Fast最大误差: " << maxFastErr << std::endl;
+    if (maxFastErr > 3e-7) {
+        std::cout << "✗ atan2Fast 超出说明的误差界" << std::endl;
+        return 1;
+    }
+    velocity[0] = { 0.0, 0.0, 0.0 };
+    velocity[1] = { 250.0, 0.0, 0.0 };
+    velocity[2] = { -250.0, 0.0, 0.0 };
+    velocity[3] = { -250.0, 10.0, -0.0 };
+    velocity[4] = { 0.0, -300.0, 0.0 };
+    std::vector<double> pitch(n), roll(n), yaw(n), limited(3 * n);
+    for (SimdLevel level : levels) {
+        const SimdKernelTable* table = getSimdKernels(level);
+        if (!table || static_cast<int>(level) > static_cast<int>(detectSimdLevel())) continue;
+        for (std::size_t i = 0; i < n; ++i) {
+            vn[i] = velocity[i].north;
+            vu[i] = velocity[i].up;
+            ve[i] = velocity[i].east;
+        }
+        table->attitudeFromVelocity(vn.data(), vu.data(), ve.data(), pitch.data(), roll.data(), yaw.data(), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            // 超出限制范围的角度，偏航含 ±pi 边界与多周
+            limited[i] = (i % 9) * 0.3 - 1.2;
+            limited[n + i] = (i % 13) * 0.4 - 2.4;
+            limited[2 * n + i] = (i % 5 == 0) ? (i % 2 ? M_PI : -M_PI) : (static_cast<double>(i) - 500.0) * 0.05;
+        }
+        std::vector<double> expectedLimited = limited;
+        table->limitAttitude(limited.data(), limited.data() + n, limited.data() + 2 * n, n, M_PI / 3.0, M_PI / 2.0);
+
+        double maxAttErr = 0.0, maxLimitErr = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            AttitudeAngles expected = EulerAngleCalculator::calculateFromVelocity(velocity[i]);
+            maxAttErr = std::max(maxAttErr, std::abs(pitch[i] - expected.pitch) + std::abs(roll[i] - expected.roll) +
+                                            std::abs(yaw[i] - expected.yaw));
+            AttitudeAngles raw;
+            raw.pitch = expectedLimited[i];
+            raw.roll = expectedLimited[n + i];
+            raw.yaw = expectedLimited[2 * n + i];
+            AttitudeAngles ref = EulerAngleCalculator::limitAttitudeAngles(raw);
+            maxLimitErr = std::max(maxLimitErr, std::abs(limited[i] - ref.pitch) + std::abs(limited[n + i] - ref.roll) +
+                                                std::abs(limited[2 * n + i] - ref.yaw));
+        }
+        std::cout << getSimdLevelName(level) << ": 姿态角最大偏差 " << maxAttErr
+                  << " 弧度, 限制后最大偏差 " << maxLimitErr << " 弧度" << std::endl;
+        double attTol = (level == SimdLevel::Scalar) ? 0.0 : 6e-7;
+        double limitTol = (level == SimdLevel::Scalar) ? 0.0 : 1e-12;
+        if (maxAttErr > attTol || maxLimitErr > limitTol) {
+            std::cout << "✗ " << getSimdLevelName(level) << " 批量姿态角超出容差" << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "✓ 批量姿态角与逐个精确版本一致（在误差界内）" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
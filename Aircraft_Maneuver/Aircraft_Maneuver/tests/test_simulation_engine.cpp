@@ -0,0 +1,135 @@
+#include <iostream>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "AircraftModelLibrary.h"
+#include "FighterJet.h"
+#include "ManeuverModel.h"
+#include "SimulationEngine.h"
+#include "ThreadPool.h"
+
+namespace {
+
+const char* MANEUVERS[] = { "s", "loop", "roll", "split_s", "immelmann", "barrel_roll",
+                            "evasive_dive", "l_maneuver", "constant", "snake" };
+
+// 构造一架带机动模型的飞机（各机动耗时不同，用于检验工作窃取下的确定性）
+std::shared_ptr<Aircraft> makeAircraft(int i) {
+    auto aircraft = std::make_shared<FighterJet>("F-15");
+    aircraft->position = { 116.0 + 0.01 * i, 39.0 + 0.003 * i, 1000.0 + 5.0 * i };
+    aircraft->velocity = { 200.0 + (i % 7), 2.0 * (i % 5), 10.0 * (i % 3) };
+    std::string name = MANEUVERS[i % (sizeof(MANEUVERS) / sizeof(MANEUVERS[0]))];
+    aircraft->setManeuverModel(ManeuverModelFactory::createManeuverModel(name));
+    aircraft->initializeManeuver(ManeuverModelFactory::getDefaultParameters(name));
+    return aircraft;
+}
+
+bool sameState(const Aircraft& a, const Aircraft& b) {
+    return a.position.latitude == b.position.latitude && a.position.longitude == b.position.longitude &&
+           a.position.altitude == b.position.altitude && a.velocity.north == b.velocity.north &&
+           a.velocity.up == b.velocity.up && a.velocity.east == b.velocity.east &&
+           a.getAttitude().pitch == b.getAttitude().pitch && a.getAttitude().roll == b.getAttitude().roll &&
+           a.getAttitude().yaw == b.getAttitude().yaw;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== 多机仿真引擎测试 ===" << std::endl;
+
+    const int count = 203;
+    const int steps = 300;
+    const double dt = 0.02;
+
+    // 测试1：线程池每个元素恰好处理一次，异常传回调用线程
+    ThreadPool pool(4);
+    std::vector<std::atomic<int>> hits(10007);
+    for (int round = 0; round < 20; ++round) {
+        pool.parallelFor(hits.size(), 13, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) hits[i].fetch_add(1);
+        });
+    }
+    for (const auto& h : hits) {
+        if (h.load() != 20) {
+            std::cout << "✗ 线程池遗漏或重复处理元素" << std::endl;
+            return 1;
+        }
+    }
+    bool caught = false;
+    try {
+        pool.parallelFor(100, 1, [](std::size_t begin, std::size_t) {
+            if (begin == 57) throw std::runtime_error("chunk failed");
+        });
+    }
+    catch (const std::runtime_error&) {
+        caught = true;
+    }
+    if (!caught) {
+        std::cout << "✗ 线程池未传播异常" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 线程池覆盖完整且传播异常" << std::endl;
+
+    // 参照：与 main.cpp 相同的单机顺序循环
+    std::vector<std::shared_ptr<Aircraft>> reference;
+    for (int i = 0; i < count; ++i) {
+        reference.push_back(makeAircraft(i));
+    }
+    for (int s = 0; s < steps; ++s) {
+        for (auto& a : reference) {
+            a->updateModules(dt);
+            a->updateManeuver(dt);
+            a->updateKinematics(dt);
+        }
+    }
+
+    // 测试2：不同线程数、不同块大小下结果与顺序循环逐位一致
+    const std::size_t threadCounts[] = { 1, 2, 3, 8 };
+    const std::size_t grains[] = { 1, 8, 64 };
+    for (std::size_t threads : threadCounts) {
+        for (std::size_t grain : grains) {
+            SimulationEngine engine(threads);
+            engine.setGrainSize(grain);
+            for (int i = 0; i < count; ++i) {
+                engine.addAircraft(makeAircraft(i));
+            }
+            std::size_t callbacks = 0;
+            engine.setStepCallback([&](const SimulationEngine&) { ++callbacks; });
+            engine.run(steps, dt);
+            if (callbacks != static_cast<std::size_t>(steps) || engine.getStepCount() != static_cast<std::size_t>(steps)) {
+                std::cout << "✗ 步数或回调次数错误" << std::endl;
+                return 1;
+            }
+            for (int i = 0; i < count; ++i) {
+                if (!sameState(engine.getAircraft(i), *reference[i])) {
+                    std::cout << "✗ " << threads << " 线程、块大小 " << grain << " 时第 " << i
+                              << " 架飞机与顺序结果不一致" << std::endl;
+                    return 1;
+                }
+            }
+        }
+    }
+    std::cout << "✓ 各线程数下结果与顺序循环逐位一致" << std::endl;
+
+    // 测试3：重复添加同一架飞机抛出异常
+    SimulationEngine engine(2);
+    auto aircraft = makeAircraft(0);
+    engine.addAircraft(aircraft);
+    caught = false;
+    try {
+        engine.addAircraft(aircraft);
+    }
+    catch (const std::invalid_argument&) {
+        caught = true;
+    }
+    if (!caught) {
+        std::cout << "✗ 重复添加未抛出异常" << std::endl;
+        return 1;
+    }
+    std::cout << "✓ 重复添加飞机被拒绝" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
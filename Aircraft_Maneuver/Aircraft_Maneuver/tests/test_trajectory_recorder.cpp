@@ -0,0 +1,138 @@
+#include <iostream>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "AircraftModelLibrary.h"
+#include "FighterJet.h"
+#include "ManeuverModel.h"
+#include "TrajectoryRecorder.h"
+
+namespace {
+
+const char* PATH = "test_trajectory.bin";
+
+// 每行期望写入的值（与 TrajectoryRecorder 列顺序一致）
+std::vector<double> rowValues(double time, const Aircraft& a) {
+    Vector3 ecef = a.getECEFPosition();
+    Vector3 nue = a.getLocalNUEPosition();
+    return { time, a.position.latitude, a.position.longitude, a.position.altitude,
+             a.velocity.north, a.velocity.up, a.velocity.east,
+             a.getAttitude().pitch, a.getAttitude().roll, a.getAttitude().yaw,
+             ecef.north, ecef.up, ecef.east, nue.north, nue.up, nue.east };
+}
+
+bool throwsRuntimeError(const std::string& path) {
+    try {
+        TrajectoryReader reader(path);
+    }
+    catch (const std::runtime_error&) {
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== 轨迹记录器测试 ===" << std::endl;
+
+    const int steps = 1000;
+    const double dt = 0.05;
+    FighterJet aircraft("F-15");
+    aircraft.position = { 116.4074, 39.9042, 1000.0 };
+    aircraft.velocity = { 200.0, 0.0, 0.0 };
+    aircraft.setReferencePosition(aircraft.position);
+    aircraft.setManeuverModel(ManeuverModelFactory::createManeuverModel("loop"));
+    aircraft.initializeManeuver(ManeuverModelFactory::getDefaultParameters("loop"));
+
+    // 测试1：多块写入（块大小64，最后一块不满）后逐位读回
+    std::vector<std::vector<double>> expected;
+    {
+        TrajectoryRecorder recorder(PATH, TrajectoryRecorder::RECORD_ECEF | TrajectoryRecorder::RECORD_NUE, 64);
+        for (int i = 0; i < steps; ++i) {
+            aircraft.updateManeuver(dt);
+            aircraft.updateKinematics(dt);
+            recorder.record((i + 1) * dt, aircraft);
+            expected.push_back(rowValues((i + 1) * dt, aircraft));
+        }
+        // 未关闭的文件不可读取
+        recorder.flush();
+        if (!throwsRuntimeError(PATH)) {
+            std::cout << "✗ 未关闭的文件被当作有效文件" << std::endl;
+            return 1;
+        }
+    }
+
+    {
+        TrajectoryReader reader(PATH);
+        if (reader.getVersion() != TrajectoryFormat::VERSION || reader.getRowCount() != static_cast<std::size_t>(steps) ||
+            reader.getBlockCount() != (steps + 63) / 64 || reader.getColumns().size() != expected[0].size()) {
+            std::cout << "✗ 文件头信息错误" << std::endl;
+            return 1;
+        }
+        for (std::size_t c = 0; c < reader.getColumns().size(); ++c) {
+            TrajectoryColumn column = reader.getColumns()[c];
+            std::vector<double> values = reader.readColumn(column);
+            for (int i = 0; i < steps; ++i) {
+                if (values[i] != expected[i][c] || reader.getValue(column, i) != expected[i][c]) {
+                    std::cout << "✗ 列 " << TrajectoryFormat::getColumnName(column) << " 第 " << i << " 行不一致" << std::endl;
+                    return 1;
+                }
+            }
+        }
+        std::cout << "✓ 多块写入后逐位读回（" << reader.getBlockCount() << " 块）" << std::endl;
+
+        // 测试2：零拷贝块访问
+        std::size_t rows = 0;
+        const double* altitude = reader.getBlockColumn(1, TrajectoryColumn::Altitude, &rows);
+        if (altitude == nullptr || rows != 64 || altitude[0] != expected[64][3] ||
+            reinterpret_cast<std::uintptr_t>(altitude) % alignof(double) != 0) {
+            std::cout << "✗ 块列访问错误" << std::endl;
+            return 1;
+        }
+        std::cout << "✓ 块列数据可直接按 double 数组访问" << std::endl;
+
+        // 测试3：CSV转换
+        std::ostringstream csv;
+        reader.writeCsv(csv);
+        std::string text = csv.str();
+        std::size_t lines = 0;
+        for (char ch : text) lines += (ch == '\n');
+        if (lines != static_cast<std::size_t>(steps) + 1 || text.compare(0, 22, "time,latitude,longitud") != 0) {
+            std::cout << "✗ CSV输出错误" << std::endl;
+            return 1;
+        }
+        std::cout << "✓ CSV转换正确" << std::endl;
+    }
+
+    // 测试4：不含可选列、截断文件、非轨迹文件
+    {
+        TrajectoryRecorder recorder(PATH);
+        recorder.record(0.0, aircraft);
+    }
+    {
+        TrajectoryReader minimal(PATH);
+        if (minimal.hasColumn(TrajectoryColumn::EcefX) || minimal.getRowCount() != 1 ||
+            minimal.getValue(TrajectoryColumn::Latitude, 0) != aircraft.position.latitude) {
+            std::cout << "✗ 仅基本列的文件读取错误" << std::endl;
+            return 1;
+        }
+    }
+    {
+        std::ofstream bad(PATH, std::ios::binary | std::ios::trunc);
+        bad << "not a trajectory";
+    }
+    if (!throwsRuntimeError(PATH) || !throwsRuntimeError("missing_trajectory.bin")) {
+        std::cout << "✗ 非法文件未被拒绝" << std::endl;
+        return 1;
+    }
+    std::remove(PATH);
+    std::cout << "✓ 可选列与非法文件处理正确" << std::endl;
+
+    std::cout << "\n=== 所有测试通过 ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,32 @@
+// 轨迹文件 -> CSV 转换工具
+// 用法：trajectory_to_csv <轨迹文件> [输出CSV，缺省输出到标准输出]
+#include <iostream>
+#include <fstream>
+#include <stdexcept>
+#include "TrajectoryRecorder.h"
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "用法: " << argv[0] << " <轨迹文件> [输出CSV]" << std::endl;
+        return 1;
+    }
+    try {
+        TrajectoryReader reader(argv[1]);
+        if (argc > 2) {
+            std::ofstream out(argv[2]);
+            if (!out) {
+                std::cerr << "无法写入 " << argv[2] << std::endl;
+                return 1;
+            }
+            reader.writeCsv(out);
+            std::cerr << "已转换 " << reader.getRowCount() << " 行到 " << argv[2] << std::endl;
+        } else {
+            reader.writeCsv(std::cout);
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}